@@ -10,6 +10,7 @@ cmake_policy(SET CMP0083 NEW)
 
 include(CheckPIESupported)
 include(CheckCXXCompilerFlag)
+include(CheckCXXSourceCompiles)
 
 # All code we build should be compiled as position independent
 check_pie_supported(OUTPUT_VARIABLE PIE_SUPPORT_OUTPUT LANGUAGES CXX)
@@ -536,6 +537,26 @@ if (CLR_CMAKE_PLATFORM_UNIX)
   endif(CLR_CMAKE_PLATFORM_DARWIN)
 endif(CLR_CMAKE_PLATFORM_UNIX)
 
+if(CLR_CMAKE_PLATFORM_UNIX_ARM64)
+   # Let the compiler emit atomics that use the ARMv8.1 LSE instructions (ldadd, cas, swp)
+   # when the processor supports them and fall back to LL/SC loops otherwise.
+   # This needs clang 12 or GCC 10 and a libgcc/compiler-rt that provides the __aarch64_*
+   # helpers, so it is a link test rather than a flag test. The compilers build.sh accepts
+   # today (clang 3.5 - 9) don't support the flag, so with them the option is not added.
+   set(CMAKE_REQUIRED_FLAGS -moutline-atomics)
+   check_cxx_source_compiles("
+     int main()
+     {
+       long value = 0;
+       __atomic_fetch_add(&value, 1, __ATOMIC_SEQ_CST);
+       return (int)__sync_val_compare_and_swap(&value, 1, 2);
+     }" COMPILER_SUPPORTS_OUTLINE_ATOMICS)
+   unset(CMAKE_REQUIRED_FLAGS)
+   if(COMPILER_SUPPORTS_OUTLINE_ATOMICS)
+     add_compile_options(-moutline-atomics)
+   endif()
+endif(CLR_CMAKE_PLATFORM_UNIX_ARM64)
+
 if(CLR_CMAKE_PLATFORM_UNIX_ARM)
    # Because we don't use CMAKE_C_COMPILER/CMAKE_CXX_COMPILER to use clang
    # we have to set the triple by adding a compiler argument
@@ -80,6 +80,13 @@ void CommandLine::DumpHelp(const char* program)
     printf("         t - method throughput time\n");
     printf("         * - all available method stats\n");
     printf("\n");
+    printf(" -repeatCount <count>\n");
+    printf("     Collect throughput by recompiling each method 'count' more times and keeping\n");
+    printf("     the fastest compiles. Total compile cycles and code size are reported for each\n");
+    printf("     JIT at the end, along with the number of methods whose code size differs.\n");
+    printf("     Per-method code size differences are logged with -v v.\n");
+    printf("     Default: with -emitMethodStats t, 10 repeats.\n");
+    printf("\n");
     printf(" -a[pplyDiff]\n");
     printf("     Compare the compile result generated from the provided JIT with the\n");
     printf("     compile result stored with the MC. If two JITs are provided, this\n");
@@ -365,6 +372,22 @@ bool CommandLine::Parse(int argc, char* argv[], /* OUT */ Options* o)
 
                 o->methodStatsTypes = argv[i];
             }
+            else if ((_strnicmp(&argv[i][1], "repeatCount", argLen) == 0))
+            {
+                if (++i >= argc)
+                {
+                    DumpHelp(argv[0]);
+                    return false;
+                }
+
+                o->repeatCount = atoi(argv[i]);
+                if (o->repeatCount < 1)
+                {
+                    LogError("Arg '%s' is invalid, the repeat count must be at least 1.", argv[i]);
+                    DumpHelp(argv[0]);
+                    return false;
+                }
+            }
             else if ((_strnicmp(&argv[i][1], "applyDiff", argLen) == 0))
             {
                 o->applyDiff = true;
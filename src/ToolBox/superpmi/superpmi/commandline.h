@@ -36,6 +36,7 @@ public:
             , indexes(nullptr)
             , hash(nullptr)
             , methodStatsTypes(nullptr)
+            , repeatCount(-1)
             , mclFilename(nullptr)
             , diffMCLFilename(nullptr)
             , targetArchitecture(nullptr)
@@ -65,6 +66,7 @@ public:
         int*  indexes;
         char* hash;
         char* methodStatsTypes;
+        int   repeatCount; // Number of timed recompiles per method. -1 means don't collect throughput unless asked.
         char* mclFilename;
         char* diffMCLFilename;
         char* targetArchitecture;
@@ -30,6 +30,9 @@ JitInstance* JitInstance::InitJit(char*                         nameOfJit,
 
     jit->options = options;
 
+    jit->throughputSampleCount = 10;
+    jit->lastCodeSize          = 0;
+
     jit->environment.getIntConfigValue   = nullptr;
     jit->environment.getStingConfigValue = nullptr;
 
@@ -295,8 +298,9 @@ JitInstance::Result JitInstance::CompileMethod(MethodContext* MethodToCompile, i
     // store to instance field our raw values, so we can figure things out a bit later...
     mc = MethodToCompile;
 
-    times[0] = 0;
-    times[1] = 0;
+    times[0]     = 0;
+    times[1]     = 0;
+    lastCodeSize = 0;
 
     stj.Start();
 
@@ -340,6 +344,7 @@ JitInstance::Result JitInstance::CompileMethod(MethodContext* MethodToCompile, i
             pParam->pThis->mc->cr->recAllocGCInfoCapture();
 
             pParam->pThis->mc->cr->recMessageLog("Successful Compile");
+            pParam->pThis->lastCodeSize = NCodeSizeBlock;
         }
         else
         {
@@ -383,7 +388,7 @@ void JitInstance::timeResult(CORINFO_METHOD_INFO info, unsigned flags)
     BYTE* NEntryBlock    = nullptr;
     ULONG NCodeSizeBlock = 0;
 
-    int sampleSize = 10;
+    int sampleSize = throughputSampleCount;
     // Save 2 smallest times. To help reduce noise, we will look at the closest pair of these.
     unsigned __int64 time;
 
@@ -43,6 +43,8 @@ public:
     CycleTimer       lt;
     MethodContext*   mc;
     ULONGLONG        times[2];
+    int              throughputSampleCount; // Number of extra compiles timeResult does when collecting throughput
+    ULONG            lastCodeSize;          // Hot code size of the last successful CompileMethod
     ICorJitCompiler* pJitInstance;
 
     // Allocate and initialize the jit provided
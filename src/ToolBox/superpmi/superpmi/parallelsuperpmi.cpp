@@ -190,6 +190,17 @@ Cleanup:
         fclose(fp);
 }
 
+// Throughput totals reported by each child, summed up for the final summary.
+struct ThroughputTotals
+{
+    ULONGLONG cycles1;
+    ULONGLONG codeSize1;
+    ULONGLONG cycles2;
+    ULONGLONG codeSize2;
+    int       codeSizeDiffs;
+    bool      reported;
+};
+
 void ProcessChildStdOut(const CommandLine::Options& o,
                         char*                       stdoutFilename,
                         int*                        loaded,
@@ -197,6 +208,7 @@ void ProcessChildStdOut(const CommandLine::Options& o,
                         int*                        failed,
                         int*                        excluded,
                         int*                        diffs,
+                        ThroughputTotals*           throughput,
                         bool*                       usageError)
 {
     char buff[MAX_LOG_LINE_SIZE];
@@ -268,6 +280,23 @@ void ProcessChildStdOut(const CommandLine::Options& o,
             *failed += childFailed;
             *excluded += childExcluded;
         }
+        else if (strncmp(buff, g_ThroughputFormatStringFixedPrefix, strlen(g_ThroughputFormatStringFixedPrefix)) == 0)
+        {
+            ThroughputTotals child = {};
+            int converted = sscanf_s(buff, g_ThroughputSummaryFormatString, &child.cycles1, &child.codeSize1,
+                                     &child.cycles2, &child.codeSize2, &child.codeSizeDiffs);
+            if (converted != 5)
+            {
+                LogError("Couldn't parse throughput message: \"%s\"", buff);
+                continue;
+            }
+            throughput->cycles1 += child.cycles1;
+            throughput->codeSize1 += child.codeSize1;
+            throughput->cycles2 += child.cycles2;
+            throughput->codeSize2 += child.codeSize2;
+            throughput->codeSizeDiffs += child.codeSizeDiffs;
+            throughput->reported = true;
+        }
     }
 
 Cleanup:
@@ -382,6 +411,11 @@ char* ConstructChildProcessArgs(const CommandLine::Options& o)
     ADDARG_STRING(o.reproName, "-reproName");
     ADDARG_STRING(o.writeLogFile, "-writeLogFile");
     ADDARG_STRING(o.methodStatsTypes, "-emitMethodStats");
+    if (o.repeatCount > 0)
+    {
+        bytesWritten +=
+            sprintf_s(spmiArgs + bytesWritten, MAX_CMDLINE_SIZE - bytesWritten, " -repeatCount %d", o.repeatCount);
+    }
     ADDARG_STRING(o.reproName, "-reproName");
     ADDARG_STRING(o.hash, "-matchHash");
     ADDARG_STRING(o.targetArchitecture, "-target");
@@ -603,14 +637,16 @@ int doParallelSuperPMI(CommandLine::Options& o)
 
         bool usageError = false; // variable to flag if we hit a usage error in SuperPMI
 
-        int loaded = 0, jitted = 0, failed = 0, excluded = 0, diffs = 0;
+        int              loaded = 0, jitted = 0, failed = 0, excluded = 0, diffs = 0;
+        ThroughputTotals throughput = {};
 
         // Read the stderr files and log them as errors
         // Read the stdout files and parse them for counts and log any MISSING or ISSUE errors
         for (int i = 0; i < o.workerCount; i++)
         {
             ProcessChildStdErr(arrStdErrorPath[i]);
-            ProcessChildStdOut(o, arrStdOutputPath[i], &loaded, &jitted, &failed, &excluded, &diffs, &usageError);
+            ProcessChildStdOut(o, arrStdOutputPath[i], &loaded, &jitted, &failed, &excluded, &diffs, &throughput,
+                               &usageError);
             if (usageError)
                 break;
         }
@@ -637,6 +673,12 @@ int doParallelSuperPMI(CommandLine::Options& o)
             {
                 LogInfo(g_SummaryFormatString, loaded, jitted, failed, excluded);
             }
+
+            if (throughput.reported)
+            {
+                LogInfo(g_ThroughputSummaryFormatString, throughput.cycles1, throughput.codeSize1, throughput.cycles2,
+                        throughput.codeSize2, throughput.codeSizeDiffs);
+            }
         }
 
         st.Stop();
@@ -29,6 +29,18 @@ const char* const g_AllFormatStringFixedPrefix  = "Loaded ";
 const char* const g_SummaryFormatString         = "Loaded %d  Jitted %d  FailedCompile %d Excluded %d";
 const char* const g_AsmDiffsSummaryFormatString = "Loaded %d  Jitted %d  FailedCompile %d Excluded %d Diffs %d";
 
+// The throughput summary is only written when throughput is collected. It deliberately doesn't share
+// the prefix above so that it doesn't get parsed as one of the status strings.
+const char* const g_ThroughputFormatStringFixedPrefix = "Throughput ";
+const char* const g_ThroughputSummaryFormatString =
+    "Throughput Jit1Cycles %llu Jit1CodeSize %llu  Jit2Cycles %llu Jit2CodeSize %llu  CodeSizeDiffs %d";
+
+// Returns the fastest of the two compile times a JitInstance keeps when collecting throughput.
+static ULONGLONG FastestCompileCycles(JitInstance* jit)
+{
+    return (jit->times[0] < jit->times[1]) ? jit->times[0] : jit->times[1];
+}
+
 //#define SuperPMI_ChewMemory 0x7FFFFFFF //Amount of address space to consume on startup
 
 SPMI_TARGET_ARCHITECTURE SpmiTargetArchitecture;
@@ -193,6 +205,11 @@ int __cdecl main(int argc, char* argv[])
         collectThroughput = true;
     }
 
+    if (o.repeatCount > 0)
+    {
+        collectThroughput = true;
+    }
+
     LogVerbose("Using jit(%s) with input (%s)", o.nameOfJit, o.nameOfInputMethodContextFile);
     std::string indexesStr = " indexCount=";
     indexesStr += std::to_string(o.indexCount);
@@ -218,6 +235,9 @@ int __cdecl main(int argc, char* argv[])
     if (o.offset > 0 && o.increment > 0)
         LogVerbose(" offset=%d increment=%d", o.offset, o.increment);
 
+    if (o.repeatCount > 0)
+        LogVerbose(" repeatCount=%d", o.repeatCount);
+
     if (o.methodStatsTypes != nullptr)
     {
         methodStatsEmitter = new MethodStatsEmitter(o.nameOfInputMethodContextFile);
@@ -251,6 +271,13 @@ int __cdecl main(int argc, char* argv[])
     int index             = 0;
     int excludedCount     = 0;
 
+    // Throughput totals. The cycles are the sum of the fastest compile of each method.
+    ULONGLONG totalCycles1      = 0;
+    ULONGLONG totalCycles2      = 0;
+    ULONGLONG totalCodeSize1    = 0;
+    ULONGLONG totalCodeSize2    = 0;
+    int       codeSizeDiffCount = 0;
+
     st1.Start();
     NearDiffer nearDiffer(o.targetArchitecture, o.useCoreDisTools);
 
@@ -318,6 +345,10 @@ int __cdecl main(int argc, char* argv[])
                 // InitJit already printed a failure message
                 return (int)SpmiResult::JitFailedToInit;
             }
+            if (o.repeatCount > 0)
+            {
+                jit->throughputSampleCount = o.repeatCount;
+            }
 
             if (o.nameOfJit2 != nullptr)
             {
@@ -328,6 +359,10 @@ int __cdecl main(int argc, char* argv[])
                     // InitJit already printed a failure message
                     return (int)SpmiResult::JitFailedToInit;
                 }
+                if (o.repeatCount > 0)
+                {
+                    jit2->throughputSampleCount = o.repeatCount;
+                }
             }
         }
 
@@ -405,6 +440,27 @@ int __cdecl main(int argc, char* argv[])
         {
             if (collectThroughput)
             {
+                // Only count methods that every JIT compiled, so the totals stay comparable
+                if (o.nameOfJit2 == nullptr)
+                {
+                    totalCycles1 += FastestCompileCycles(jit);
+                    totalCodeSize1 += jit->lastCodeSize;
+                }
+                else if (res2 == JitInstance::RESULT_SUCCESS)
+                {
+                    totalCycles1 += FastestCompileCycles(jit);
+                    totalCycles2 += FastestCompileCycles(jit2);
+                    totalCodeSize1 += jit->lastCodeSize;
+                    totalCodeSize2 += jit2->lastCodeSize;
+
+                    if (jit->lastCodeSize != jit2->lastCodeSize)
+                    {
+                        codeSizeDiffCount++;
+                        LogVerbose("Method %d code size %u -> %u", reader->GetMethodContextIndex(),
+                                   jit->lastCodeSize, jit2->lastCodeSize);
+                    }
+                }
+
                 if (o.nameOfJit2 != nullptr && res2 == JitInstance::RESULT_SUCCESS)
                 {
                     // TODO-Bug?: bug in getting the lowest cycle time??
@@ -582,6 +638,12 @@ int __cdecl main(int argc, char* argv[])
         LogInfo(g_SummaryFormatString, loadedCount, jittedCount, failToReplayCount, excludedCount);
     }
 
+    if (collectThroughput)
+    {
+        LogInfo(g_ThroughputSummaryFormatString, totalCycles1, totalCodeSize1, totalCycles2, totalCodeSize2,
+                codeSizeDiffCount);
+    }
+
     st2.Stop();
     LogVerbose("Total time: %fms", st2.GetMilliseconds());
 
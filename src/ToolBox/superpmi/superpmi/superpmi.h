@@ -24,6 +24,8 @@ extern const char* const g_SuperPMIUsageFirstLine;
 extern const char* const g_AllFormatStringFixedPrefix;
 extern const char* const g_SummaryFormatString;
 extern const char* const g_AsmDiffsSummaryFormatString;
+extern const char* const g_ThroughputFormatStringFixedPrefix;
+extern const char* const g_ThroughputSummaryFormatString;
 
 enum class SpmiResult
 {
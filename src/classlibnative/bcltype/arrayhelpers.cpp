@@ -19,6 +19,11 @@
 #include "arrayhelpers.h"
 #include <memory.h>
 
+#if defined(_AMD64_) || defined(_X86_)
+#include "emmintrin.h"
+#define USE_INTEL_INTRINSICS_FOR_INDEXOF
+#endif
+
 INT32 ArrayHelper::IndexOfUINT8( UINT8* array, UINT32 index, UINT32 count, UINT8 value) {
     LIMITED_METHOD_CONTRACT;
     UINT8 * pvalue = (UINT8 *)memchr(array + index, value, count);
@@ -31,6 +36,60 @@ INT32 ArrayHelper::IndexOfUINT8( UINT8* array, UINT32 index, UINT32 count, UINT8
 }
 
 
+// Compare 16 bytes at a time with SSE2 and fall back to the scalar loop for the tail.
+// Element-wise equality is bitwise here, just like the scalar ArrayHelpers::IndexOf.
+INT32 ArrayHelper::IndexOfUINT16( UINT16* array, UINT32 index, UINT32 count, UINT16 value) {
+    LIMITED_METHOD_CONTRACT;
+
+    UINT32 i = index;
+    UINT32 end = index + count;
+
+#if defined(USE_INTEL_INTRINSICS_FOR_INDEXOF)
+    __m128i valueSIMD = _mm_set1_epi16(value);
+    for (; end - i >= 8; i += 8) {
+        __m128i data = _mm_loadu_si128((__m128i*)(array + i));
+        int mask = _mm_movemask_epi8(_mm_cmpeq_epi16(data, valueSIMD));
+        if (mask != 0) {
+            DWORD bit;
+            BitScanForward(&bit, mask);
+            return static_cast<INT32>(i + bit / sizeof(UINT16));
+        }
+    }
+#endif
+
+    for (; i < end; i++) {
+        if (array[i] == value)
+            return static_cast<INT32>(i);
+    }
+    return -1;
+}
+
+INT32 ArrayHelper::IndexOfUINT32( UINT32* array, UINT32 index, UINT32 count, UINT32 value) {
+    LIMITED_METHOD_CONTRACT;
+
+    UINT32 i = index;
+    UINT32 end = index + count;
+
+#if defined(USE_INTEL_INTRINSICS_FOR_INDEXOF)
+    __m128i valueSIMD = _mm_set1_epi32(value);
+    for (; end - i >= 4; i += 4) {
+        __m128i data = _mm_loadu_si128((__m128i*)(array + i));
+        int mask = _mm_movemask_epi8(_mm_cmpeq_epi32(data, valueSIMD));
+        if (mask != 0) {
+            DWORD bit;
+            BitScanForward(&bit, mask);
+            return static_cast<INT32>(i + bit / sizeof(UINT32));
+        }
+    }
+#endif
+
+    for (; i < end; i++) {
+        if (array[i] == value)
+            return static_cast<INT32>(i);
+    }
+    return -1;
+}
+
 // A fast IndexOf method for arrays of primitive types.  Returns TRUE or FALSE
 // if it succeeds, and stores result in retVal.
 FCIMPL5(FC_BOOL_RET, ArrayHelper::TrySZIndexOf, ArrayBase * array, UINT32 index, UINT32 count, Object * value, INT32 * retVal)
@@ -75,7 +134,7 @@ FCIMPL5(FC_BOOL_RET, ArrayHelper::TrySZIndexOf, ArrayBase * array, UINT32 index,
     case ELEMENT_TYPE_I2:
     case ELEMENT_TYPE_U2:
     case ELEMENT_TYPE_CHAR:
-        *retVal = ArrayHelpers<U2>::IndexOf((U2*) array->GetDataPtr(), index, count, *(U2*)value->UnBox());		
+        *retVal = IndexOfUINT16((U2*) array->GetDataPtr(), index, count, *(U2*)value->UnBox());
         break;
 
     case ELEMENT_TYPE_I4:
@@ -83,7 +142,7 @@ FCIMPL5(FC_BOOL_RET, ArrayHelper::TrySZIndexOf, ArrayBase * array, UINT32 index,
     case ELEMENT_TYPE_R4:
     IN_TARGET_32BIT(case ELEMENT_TYPE_I:)
     IN_TARGET_32BIT(case ELEMENT_TYPE_U:)
-        *retVal = ArrayHelpers<U4>::IndexOf((U4*) array->GetDataPtr(), index, count, *(U4*)value->UnBox());
+        *retVal = IndexOfUINT32((U4*) array->GetDataPtr(), index, count, *(U4*)value->UnBox());
         break;
 
     case ELEMENT_TYPE_I8:
@@ -337,6 +337,8 @@ public:
 
     // Helper methods	
     static INT32 IndexOfUINT8( UINT8* array, UINT32 index, UINT32 count, UINT8 value);
+    static INT32 IndexOfUINT16( UINT16* array, UINT32 index, UINT32 count, UINT16 value);
+    static INT32 IndexOfUINT32( UINT32* array, UINT32 index, UINT32 count, UINT32 value);
 };
 
 #if defined(COMARRAYHELPERS_TURNED_FPO_ON)
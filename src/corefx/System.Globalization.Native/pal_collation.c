@@ -442,6 +442,15 @@ int32_t GlobalizationNative_CompareString(
     SortHandle* pSortHandle, const UChar* lpStr1, int32_t cwStr1Length, const UChar* lpStr2, int32_t cwStr2Length, int32_t options)
 {
     UCollationResult result = UCOL_EQUAL;
+
+    // Identical strings compare equal under any collation, so skip ICU for them. This is the
+    // common case for culture-aware dictionary lookups.
+    if (cwStr1Length == cwStr2Length &&
+        (lpStr1 == lpStr2 || memcmp(lpStr1, lpStr2, cwStr1Length * sizeof(UChar)) == 0))
+    {
+        return result;
+    }
+
     UErrorCode err = U_ZERO_ERROR;
     const UCollator* pColl = GetCollatorFromSortHandle(pSortHandle, options, &err);
 
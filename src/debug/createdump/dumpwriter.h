@@ -36,7 +36,7 @@ private:
     LONG m_ref;                         // reference count
     int m_fd;
     CrashInfo& m_crashInfo;
-    BYTE m_tempBuffer[0x4000];
+    BYTE m_tempBuffer[0x100000];
 
 public:
     DumpWriter(CrashInfo& crashInfo);
@@ -214,6 +214,11 @@ uint64_t RawGetHighPrecisionTimeStamp()
     return (uint64_t)GCToOSInterface::QueryPerformanceCounter();
 }
 
+uint32_t raw_ts_to_us (uint64_t raw_ts)
+{
+    return (uint32_t)(raw_ts * 1000000 / (uint64_t)qpf);
+}
+
 #endif
 
 #ifdef GC_STATS
@@ -926,6 +931,8 @@ public:
 
             fire_event (gch->heap_number, time_start, type_join, join_id);
 
+            uint64_t wait_start_ts = RawGetHighPrecisionTimeStamp();
+
             //busy wait around the color
             if (color == join_struct.lock_color.LoadWithoutBarrier())
             {
@@ -970,6 +977,11 @@ respin:
 
             fire_event (gch->heap_number, time_end, type_join, join_id);
 
+            if (flavor == join_flavor_server_gc)
+            {
+                gch->get_gc_data_per_heap()->join_wait_time += RawGetHighPrecisionTimeStamp() - wait_start_ts;
+            }
+
 #ifdef JOIN_STATS
             // parallel execution starts here
             start[gch->heap_number] = get_ts();
@@ -2263,7 +2275,7 @@ size_t align_on_segment_hard_limit (size_t add)
 #endif //SERVER_GC
 
 //amount in bytes of the etw allocation tick
-const size_t etw_allocation_tick = 100*1024;
+size_t etw_allocation_tick = 100*1024;
 
 const size_t low_latency_alloc = 256*1024;
 
@@ -2282,6 +2294,11 @@ const int max_snoop_level = 128;
 
 #define GC_EPHEMERAL_DECOMMIT_TIMEOUT 5000
 
+#ifdef MULTIPLE_HEAPS
+#define DECOMMIT_TIME_STEP_MILLISECONDS (100)
+#define DECOMMIT_SIZE_PER_STEP (2*1024*1024)
+#endif //MULTIPLE_HEAPS
+
 inline
 size_t align_on_page (size_t add)
 {
@@ -2371,17 +2388,18 @@ void stomp_write_barrier_resize(bool is_runtime_suspended, bool requires_upper_b
     GCToEEInterface::StompWriteBarrier(&args);
 }
 
-void stomp_write_barrier_ephemeral(uint8_t* ephemeral_low, uint8_t* ephemeral_high)
+void stomp_write_barrier_ephemeral(uint8_t* ephemeral_low, uint8_t* ephemeral_high, uint8_t* gen0_low)
 {
     WriteBarrierParameters args = {};
     args.operation = WriteBarrierOp::StompEphemeral;
     args.is_runtime_suspended = true;
     args.ephemeral_low = ephemeral_low;
     args.ephemeral_high = ephemeral_high;
+    args.gen0_low = gen0_low;
     GCToEEInterface::StompWriteBarrier(&args);
 }
 
-void stomp_write_barrier_initialize(uint8_t* ephemeral_low, uint8_t* ephemeral_high)
+void stomp_write_barrier_initialize(uint8_t* ephemeral_low, uint8_t* ephemeral_high, uint8_t* gen0_low)
 {
     WriteBarrierParameters args = {};
     args.operation = WriteBarrierOp::Initialize;
@@ -2397,6 +2415,7 @@ void stomp_write_barrier_initialize(uint8_t* ephemeral_low, uint8_t* ephemeral_h
     args.highest_address = g_gc_highest_address;
     args.ephemeral_low = ephemeral_low;
     args.ephemeral_high = ephemeral_high;
+    args.gen0_low = gen0_low;
     GCToEEInterface::StompWriteBarrier(&args);
 }
 
@@ -2514,6 +2533,16 @@ uintptr_t   process_mask = 0;
 
 int         gc_heap::n_heaps;
 
+int         gc_heap::n_alloc_heaps;
+
+bool        gc_heap::dynamic_alloc_heaps_p = false;
+
+size_t      gc_heap::alloc_heaps_last_gc_end_time = 0;
+
+size_t      gc_heap::alloc_heaps_gc_percent = 0;
+
+bool        gc_heap::reserve_alloc_quantum_p = false;
+
 gc_heap**   gc_heap::g_heaps;
 
 size_t*     gc_heap::g_promoted;
@@ -2596,6 +2625,16 @@ uint64_t    gc_heap::entry_available_physical_mem = 0;
 
 size_t      gc_heap::heap_hard_limit = 0;
 
+size_t      gc_heap::decommit_target = 0;
+
+bool        gc_heap::mark_queue_prefetch_p = false;
+
+size_t      gc_heap::pause_target_ms = 0;
+
+size_t      gc_heap::pause_target_budget_percent = 100;
+
+size_t      gc_heap::pause_target_miss_count = 0;
+
 bool        affinity_config_specified_p = false;
 #ifdef BACKGROUND_GC
 GCEvent     gc_heap::bgc_start_event;
@@ -3182,6 +3221,79 @@ void gc_heap::fire_per_heap_hist_event (gc_history_per_heap* current_gc_data_per
     current_gc_data_per_heap->gen_to_condemn_reasons.print (heap_num);
 }
 
+void gc_heap::fire_per_heap_phase_times_event (gc_history_per_heap* current_gc_data_per_heap, int heap_num)
+{
+    if (!EVENT_ENABLED(GCPerHeapPhaseTimes))
+        return;
+
+    uint64_t* phase_time = current_gc_data_per_heap->phase_time;
+    FIRE_EVENT(GCPerHeapPhaseTimes,
+               (uint32_t)settings.gc_index,
+               (uint32_t)heap_num,
+               raw_ts_to_us (phase_time[gc_phase_mark]),
+               raw_ts_to_us (phase_time[gc_phase_plan]),
+               raw_ts_to_us (phase_time[gc_phase_relocate]),
+               raw_ts_to_us (phase_time[gc_phase_compact]),
+               raw_ts_to_us (phase_time[gc_phase_sweep]),
+               raw_ts_to_us (current_gc_data_per_heap->join_wait_time),
+               current_gc_data_per_heap->mark_overflow_count);
+}
+
+// Called at the end of each GC when GCPauseTarget is set. The work an ephemeral
+// GC does mostly follows how much survives from its budget, so when one takes
+// longer than the target we halve the gen0 and gen1 budgets and when GCs are
+// comfortably under we let them grow back a step at a time.
+void gc_heap::adjust_pause_target_budget()
+{
+    const size_t min_budget_percent = 10;
+    const size_t budget_percent_step = 10;
+
+    if ((pause_target_ms == 0) || settings.concurrent ||
+        (settings.condemned_generation == max_generation))
+    {
+        return;
+    }
+
+#ifdef MULTIPLE_HEAPS
+    gc_heap* hp = g_heaps[0];
+#else
+    gc_heap* hp = pGenGCHeap;
+#endif //MULTIPLE_HEAPS
+
+    size_t elapsed_ms = dd_gc_elapsed_time (hp->dynamic_data_of (0));
+    size_t old_budget_percent = pause_target_budget_percent;
+
+    if (elapsed_ms > pause_target_ms)
+    {
+        pause_target_miss_count++;
+        pause_target_budget_percent = max ((pause_target_budget_percent / 2), min_budget_percent);
+
+        FIRE_EVENT(GCPauseTargetMissed,
+                   (uint32_t)settings.gc_index,
+                   (uint32_t)settings.condemned_generation,
+                   (uint32_t)elapsed_ms,
+                   (uint32_t)pause_target_ms,
+                   (uint32_t)pause_target_budget_percent,
+                   (uint32_t)pause_target_miss_count);
+    }
+    else if (elapsed_ms < (pause_target_ms / 2))
+    {
+        pause_target_budget_percent = min ((pause_target_budget_percent + budget_percent_step), (size_t)100);
+    }
+
+    if (pause_target_budget_percent != old_budget_percent)
+    {
+        dprintf (GTC_LOG, ("GC#%Id(gen%d) took %Idms (target %Idms), budget %Id%%->%Id%%",
+            (size_t)settings.gc_index, settings.condemned_generation, elapsed_ms,
+            pause_target_ms, old_budget_percent, pause_target_budget_percent));
+    }
+}
+
+void gc_heap::record_phase_time (gc_timed_phase phase, uint64_t start_ts)
+{
+    get_gc_data_per_heap()->phase_time[phase] += RawGetHighPrecisionTimeStamp() - start_ts;
+}
+
 void gc_heap::fire_pevents()
 {
     settings.record (&gc_data_global);
@@ -3203,10 +3315,12 @@ void gc_heap::fire_pevents()
         gc_heap* hp = gc_heap::g_heaps[i];
         gc_history_per_heap* current_gc_data_per_heap = hp->get_gc_data_per_heap();
         fire_per_heap_hist_event (current_gc_data_per_heap, hp->heap_number);
+        fire_per_heap_phase_times_event (current_gc_data_per_heap, hp->heap_number);
     }
 #else
     gc_history_per_heap* current_gc_data_per_heap = get_gc_data_per_heap();
     fire_per_heap_hist_event (current_gc_data_per_heap, heap_number);
+    fire_per_heap_phase_times_event (current_gc_data_per_heap, heap_number);
 #endif    
 }
 
@@ -5848,7 +5962,12 @@ void gc_heap::gc_thread_function ()
 
         if (heap_number == 0)
         {
-            gc_heap::ee_suspend_event.Wait(INFINITE, FALSE);
+            uint32_t wait_timeout = (decommit_target ? DECOMMIT_TIME_STEP_MILLISECONDS : INFINITE);
+            if (gc_heap::ee_suspend_event.Wait(wait_timeout, FALSE) == WAIT_TIMEOUT)
+            {
+                decommit_step();
+                continue;
+            }
 
             BEGIN_TIMING(suspend_ee_during_log);
             GCToEEInterface::SuspendEE(SUSPEND_FOR_GC);
@@ -6543,6 +6662,14 @@ void gc_heap::fix_allocation_contexts (BOOL for_gc_p)
     args.heap = __this;
 
     GCToEEInterface::GcEnumAllocContexts(fix_alloc_context, &args);
+#ifdef MULTIPLE_HEAPS
+    // The reserved quantum is already a valid free object so heap walks can
+    // step over it, we only need to give it back when we are about to GC.
+    if (for_gc_p)
+    {
+        fix_reserved_alloc_quantum();
+    }
+#endif //MULTIPLE_HEAPS
     fix_youngest_allocation_area(for_gc_p);
     fix_large_allocation_area(for_gc_p);
 }
@@ -8723,6 +8850,86 @@ private:
 
 #ifdef MULTIPLE_HEAPS
 #ifdef PARALLEL_MARK_LIST_SORT
+const int mark_list_radix_bits = 11;
+const size_t mark_list_radix_sort_threshold = 4096;
+
+// Sorts [begin, end) with an LSD radix sort on the offsets of the entries from
+// the lowest one, using tmp as scratch space for (end - begin) entries. Mark
+// lists only contain object addresses from the ephemeral range so the offsets
+// normally need 2 or 3 passes, which is a lot cheaper than the compare and
+// branch heavy introsort for long lists. Returns false without sorting if the
+// addresses span too wide a range for that.
+static bool radix_sort_mark_list (uint8_t** begin, uint8_t** end, uint8_t** tmp)
+{
+    const int max_passes = 4;
+    const size_t num_digits = (size_t)1 << mark_list_radix_bits;
+    const size_t digit_mask = num_digits - 1;
+    // Objects are always at least pointer aligned.
+    const int align_shift = (sizeof (uint8_t*) == 8) ? 3 : 2;
+
+    size_t count = end - begin;
+    uint8_t* low = *begin;
+    uint8_t* high = *begin;
+
+    for (uint8_t** p = begin + 1; p < end; p++)
+    {
+        low = min (low, *p);
+        high = max (high, *p);
+    }
+
+    size_t range = (size_t)(high - low) >> align_shift;
+    int passes = 0;
+    while ((passes < (max_passes + 1)) && ((range >> (passes * mark_list_radix_bits)) != 0))
+    {
+        passes++;
+    }
+
+    if (passes > max_passes)
+    {
+        return false;
+    }
+
+    uint32_t digit_counts[num_digits];
+    uint8_t** src = begin;
+    uint8_t** dst = tmp;
+
+    for (int pass = 0; pass < passes; pass++)
+    {
+        int digit_shift = align_shift + pass * mark_list_radix_bits;
+
+        memset (digit_counts, 0, sizeof (digit_counts));
+        for (size_t i = 0; i < count; i++)
+        {
+            digit_counts[((size_t)(src[i] - low) >> digit_shift) & digit_mask]++;
+        }
+
+        uint32_t total = 0;
+        for (size_t d = 0; d < num_digits; d++)
+        {
+            uint32_t digit_count = digit_counts[d];
+            digit_counts[d] = total;
+            total += digit_count;
+        }
+
+        for (size_t i = 0; i < count; i++)
+        {
+            uint8_t* o = src[i];
+            dst[digit_counts[((size_t)(o - low) >> digit_shift) & digit_mask]++] = o;
+        }
+
+        uint8_t** t = src;
+        src = dst;
+        dst = t;
+    }
+
+    if (src != begin)
+    {
+        memcpy (begin, src, count * sizeof (uint8_t*));
+    }
+
+    return true;
+}
+
 void gc_heap::sort_mark_list()
 {
     // if this heap had a mark list overflow, we don't do anything
@@ -8748,7 +8955,17 @@ void gc_heap::sort_mark_list()
 
     dprintf (3, ("Sorting mark lists"));
     if (mark_list_index > mark_list)
-        _sort (mark_list, mark_list_index - 1, 0);
+    {
+        // This heap's part of g_mark_list_copy is only used by merge_mark_lists
+        // after all heaps have sorted so we can use it as scratch space here.
+        uint8_t** scratch = &g_mark_list_copy [heap_number*mark_list_size];
+
+        if (((size_t)(mark_list_index - mark_list) < mark_list_radix_sort_threshold) ||
+            !radix_sort_mark_list (mark_list, mark_list_index, scratch))
+        {
+            _sort (mark_list, mark_list_index - 1, 0);
+        }
+    }
 
 //    printf("first phase of sort_mark_list for heap %d took %u cycles to sort %u entries\n", this->heap_number, GetCycleCount32() - start, mark_list_index - mark_list);
 //    start = GetCycleCount32();
@@ -9913,8 +10130,10 @@ void gc_heap::rearrange_small_heap_segments()
     while (seg)
     {
         heap_segment* next_seg = heap_segment_next (seg);
-        // TODO: we need to consider hoarding here.
-        delete_heap_segment (seg, FALSE);
+        // These segments were already decommitted when the background sweep
+        // found them empty so with GCRetainVM we only keep the reservation
+        // around on the standby list, same as we do for empty LOH segments.
+        delete_heap_segment (seg, GCConfig::GetRetainVM());
         seg = next_seg;
     }
     freeable_small_heap_segment = 0;
@@ -10372,7 +10591,8 @@ void gc_heap::adjust_ephemeral_limits ()
 
 #ifndef MULTIPLE_HEAPS
     // This updates the write barrier helpers with the new info.
-    stomp_write_barrier_ephemeral(ephemeral_low, ephemeral_high);
+    stomp_write_barrier_ephemeral(ephemeral_low, ephemeral_high,
+                                  generation_allocation_start (generation_of (0)));
 #endif // MULTIPLE_HEAPS
 }
 
@@ -10744,6 +10964,8 @@ gc_heap::init_semi_shared()
     loh_size_threshold = (size_t)GCConfig::GetLOHThreshold();
     assert (loh_size_threshold >= LARGE_OBJECT_SIZE);
 
+    etw_allocation_tick = (size_t)GCConfig::GetAllocationTickInterval();
+
 #ifdef BGC_SERVO_TUNING
     memset (bgc_tuning::gen_calc, 0, sizeof (bgc_tuning::gen_calc));
     memset (bgc_tuning::gen_stats, 0, sizeof (bgc_tuning::gen_stats));
@@ -10887,6 +11109,8 @@ gc_heap* gc_heap::make_gc_heap (
 
     res->vm_heap = vm_hp;
     res->alloc_context_count = 0;
+    res->reserved_alloc_quantum = 0;
+    res->reserved_alloc_quantum_size = 0;
 
 #ifdef MARK_LIST
 #ifdef PARALLEL_MARK_LIST_SORT
@@ -11338,9 +11562,9 @@ gc_heap::init_gc_heap (int  h_number)
     {
         stomp_write_barrier_initialize(
 #ifdef MULTIPLE_HEAPS
-            reinterpret_cast<uint8_t*>(1), reinterpret_cast<uint8_t*>(~0)
+            reinterpret_cast<uint8_t*>(1), reinterpret_cast<uint8_t*>(~0), nullptr
 #else
-            ephemeral_low, ephemeral_high
+            ephemeral_low, ephemeral_high, generation_allocation_start (generation_of (0))
 #endif //!MULTIPLE_HEAPS
         );
     }
@@ -12255,24 +12479,7 @@ void gc_heap::adjust_limit_clr (uint8_t* start, size_t limit_size, size_t size,
     if (seg == ephemeral_heap_segment ||
        ((seg == nullptr) && (gen_number == 0) && (limit_size >= CLR_SIZE / 2)))
     {
-        if (gen0_must_clear_bricks > 0)
-        {
-            //set the brick table to speed up find_object
-            size_t b = brick_of (acontext->alloc_ptr);
-            set_brick (b, acontext->alloc_ptr - brick_address (b));
-            b++;
-            dprintf (3, ("Allocation Clearing bricks [%Ix, %Ix[",
-                         b, brick_of (align_on_brick (start + limit_size))));
-            volatile short* x = &brick_table [b];
-            short* end_x = &brick_table [brick_of (align_on_brick (start + limit_size))];
-
-            for (;x < end_x;x++)
-                *x = -1;
-        }
-        else
-        {
-            gen0_bricks_cleared = FALSE;
-        }
+        set_gen0_alloc_bricks (acontext->alloc_ptr, start + limit_size);
     }
 
     // verifying the memory is completely cleared.
@@ -12282,6 +12489,28 @@ void gc_heap::adjust_limit_clr (uint8_t* start, size_t limit_size, size_t size,
     //}
 }
 
+void gc_heap::set_gen0_alloc_bricks (uint8_t* alloc_ptr, uint8_t* alloc_end)
+{
+    if (gen0_must_clear_bricks > 0)
+    {
+        //set the brick table to speed up find_object
+        size_t b = brick_of (alloc_ptr);
+        set_brick (b, alloc_ptr - brick_address (b));
+        b++;
+        dprintf (3, ("Allocation Clearing bricks [%Ix, %Ix[",
+                     b, brick_of (align_on_brick (alloc_end))));
+        volatile short* x = &brick_table [b];
+        short* end_x = &brick_table [brick_of (align_on_brick (alloc_end))];
+
+        for (;x < end_x;x++)
+            *x = -1;
+    }
+    else
+    {
+        gen0_bricks_cleared = FALSE;
+    }
+}
+
 size_t gc_heap::new_allocation_limit (size_t size, size_t physical_limit, int gen_number)
 {
     dynamic_data* dd = dynamic_data_of (gen_number);
@@ -12800,6 +13029,10 @@ void gc_heap::bgc_loh_alloc_clr (uint8_t* alloc_start,
 }
 #endif //BACKGROUND_GC
 
+// How many fitting LOH free list items we look at before settling on the
+// smallest of them.
+const int loh_best_fit_candidates = 8;
+
 BOOL gc_heap::a_fit_free_list_large_p (size_t size, 
                                        alloc_context* acontext,
                                        uint32_t flags, 
@@ -12824,6 +13057,16 @@ BOOL gc_heap::a_fit_free_list_large_p (size_t size,
         {
             uint8_t* free_list = loh_allocator->alloc_list_head_of (a_l_idx);
             uint8_t* prev_free_item = 0;
+
+            // Buckets span a factor of 2 in size (the last one is unbounded) so the first
+            // item that fits can be much larger than what we need. Instead of taking it
+            // we look at a few more items and take the smallest one that fits, which
+            // leaves larger free items intact for the large requests that need them.
+            uint8_t* best_free_item = 0;
+            uint8_t* best_prev_free_item = 0;
+            size_t best_free_item_size = 0;
+            int candidates_left = loh_best_fit_candidates;
+
             while (free_list != 0)
             {
                 dprintf (3, ("considering free list %Ix", (size_t)free_list));
@@ -12837,61 +13080,90 @@ BOOL gc_heap::a_fit_free_list_large_p (size_t size,
                     (size == free_list_size))
 #endif //FEATURE_LOH_COMPACTION
                 {
+                    if ((best_free_item == 0) || (free_list_size < best_free_item_size))
+                    {
+                        best_free_item = free_list;
+                        best_prev_free_item = prev_free_item;
+                        best_free_item_size = free_list_size;
+                    }
+
+                    if ((free_list_size == size) || (--candidates_left == 0))
+                    {
+                        break;
+                    }
+                }
+                prev_free_item = free_list;
+                free_list = free_list_slot (free_list); 
+            }
+
+            if (best_free_item != 0)
+            {
+                free_list = best_free_item;
+                prev_free_item = best_prev_free_item;
+                size_t free_list_size = best_free_item_size;
+
 #ifdef BACKGROUND_GC
-                    cookie = bgc_alloc_lock->loh_alloc_set (free_list);
-                    bgc_track_loh_alloc();
+                cookie = bgc_alloc_lock->loh_alloc_set (free_list);
+                bgc_track_loh_alloc();
 #endif //BACKGROUND_GC
 
-                    //unlink the free_item
-                    loh_allocator->unlink_item (a_l_idx, free_list, prev_free_item, FALSE);
+                //unlink the free_item
+                loh_allocator->unlink_item (a_l_idx, free_list, prev_free_item, FALSE);
 
-                    // Substract min obj size because limit_from_size adds it. Not needed for LOH
-                    size_t limit = limit_from_size (size - Align(min_obj_size, align_const), flags, free_list_size, 
-                                                    gen_number, align_const);
+                // Substract min obj size because limit_from_size adds it. Not needed for LOH
+                size_t limit = limit_from_size (size - Align(min_obj_size, align_const), flags, free_list_size, 
+                                                gen_number, align_const);
 
 #ifdef FEATURE_LOH_COMPACTION
-                    make_unused_array (free_list, loh_pad);
-                    limit -= loh_pad;
-                    free_list += loh_pad;
-                    free_list_size -= loh_pad;
+                make_unused_array (free_list, loh_pad);
+                limit -= loh_pad;
+                free_list += loh_pad;
+                free_list_size -= loh_pad;
 #endif //FEATURE_LOH_COMPACTION
 
-                    uint8_t*  remain = (free_list + limit);
-                    size_t remain_size = (free_list_size - limit);
-                    if (remain_size != 0)
-                    {
-                        assert (remain_size >= Align (min_obj_size, align_const));
-                        make_unused_array (remain, remain_size);
-                    }
-                    if (remain_size >= Align(min_free_list, align_const))
-                    {
-                        loh_thread_gap_front (remain, remain_size, gen);
-                        assert (remain_size >= Align (min_obj_size, align_const));
-                    }
-                    else
-                    {
-                        generation_free_obj_space (gen) += remain_size;
-                    }
-                    generation_free_list_space (gen) -= free_list_size;
-                    dprintf (3, ("found fit on loh at %Ix", free_list));
+                uint8_t*  remain = (free_list + limit);
+                size_t remain_size = (free_list_size - limit);
+                if (remain_size != 0)
+                {
+                    assert (remain_size >= Align (min_obj_size, align_const));
+                    make_unused_array (remain, remain_size);
+                }
+                if (remain_size >= Align(min_free_list, align_const))
+                {
+                    loh_thread_gap_front (remain, remain_size, gen);
+                    assert (remain_size >= Align (min_obj_size, align_const));
+                }
+                else
+                {
+                    generation_free_obj_space (gen) += remain_size;
+                }
+                generation_free_list_space (gen) -= free_list_size;
+                dprintf (3, ("found fit on loh at %Ix", free_list));
+#ifdef FEATURE_LOH_COMPACTION
+                if (flags & GC_ALLOC_PINNED_OBJECT_HEAP)
+                {
+                    // Set while we hold the LOH more space lock, which the BGC sweep holds
+                    // while it updates LOH segment flags.
+                    heap_segment* seg = seg_mapping_table_segment_of (free_list);
+                    assert (seg && heap_segment_loh_p (seg));
+                    seg->flags |= heap_segment_flags_loh_pinned;
+                }
+#endif //FEATURE_LOH_COMPACTION
 #ifdef BACKGROUND_GC
-                    if (cookie != -1)
-                    {
-                        bgc_loh_alloc_clr (free_list, limit, acontext, flags, align_const, cookie, FALSE, 0);
-                    }
-                    else
+                if (cookie != -1)
+                {
+                    bgc_loh_alloc_clr (free_list, limit, acontext, flags, align_const, cookie, FALSE, 0);
+                }
+                else
 #endif //BACKGROUND_GC
-                    {
-                        adjust_limit_clr (free_list, limit, size, acontext, flags, 0, align_const, gen_number);
-                    }
-
-                    //fix the limit to compensate for adjust_limit_clr making it too short 
-                    acontext->alloc_limit += Align (min_obj_size, align_const);
-                    can_fit = TRUE;
-                    goto exit;
+                {
+                    adjust_limit_clr (free_list, limit, size, acontext, flags, 0, align_const, gen_number);
                 }
-                prev_free_item = free_list;
-                free_list = free_list_slot (free_list); 
+
+                //fix the limit to compensate for adjust_limit_clr making it too short 
+                acontext->alloc_limit += Align (min_obj_size, align_const);
+                can_fit = TRUE;
+                goto exit;
             }
         }
         sz_list = sz_list * 2;
@@ -13007,6 +13279,16 @@ found_fit:
     old_alloc = allocated;
     dprintf (3, ("found fit at end of seg: %Ix", old_alloc));
 
+#ifdef FEATURE_LOH_COMPACTION
+    if (flags & GC_ALLOC_PINNED_OBJECT_HEAP)
+    {
+        // Set while we hold the LOH more space lock, which the BGC sweep holds while it
+        // updates LOH segment flags.
+        assert (gen_number == (max_generation + 1));
+        seg->flags |= heap_segment_flags_loh_pinned;
+    }
+#endif //FEATURE_LOH_COMPACTION
+
 #ifdef BACKGROUND_GC
     if (cookie != -1)
     {
@@ -13029,6 +13311,12 @@ found_fit:
         }
 
         allocated += limit;
+#ifdef MULTIPLE_HEAPS
+        if ((gen_number == 0) && reserve_alloc_quantum_p && (reserved_alloc_quantum == 0))
+        {
+            reserve_alloc_quantum (seg, align_const);
+        }
+#endif //MULTIPLE_HEAPS
         adjust_limit_clr (old_alloc, limit, size, acontext, flags, seg, align_const, gen_number);
     }
 
@@ -14194,8 +14482,11 @@ void gc_heap::balance_heaps (alloc_context* acontext)
         {
             int home_hp_num = heap_select::select_heap (acontext);
             acontext->set_home_heap (GCHeap::GetHeap (home_hp_num));
-            gc_heap* hp = acontext->get_home_heap ()->pGenGCHeap;
-            acontext->set_alloc_heap (acontext->get_home_heap ());
+            // The home heap may not be one we currently allocate on, in which
+            // case we start on an active heap and let balancing sort it out.
+            int alloc_hp_num = home_hp_num % n_alloc_heaps;
+            gc_heap* hp = GCHeap::GetHeap (alloc_hp_num)->pGenGCHeap;
+            acontext->set_alloc_heap (GCHeap::GetHeap (alloc_hp_num));
             hp->alloc_context_count++;
 
 #ifdef HEAP_BALANCE_INSTRUMENTATION
@@ -14289,8 +14580,11 @@ void gc_heap::balance_heaps (alloc_context* acontext)
                 ptrdiff_t max_size;
                 size_t local_delta = max (((size_t)org_size >> 6), min_gen0_balance_delta);
                 size_t delta = local_delta;
+                // If we stopped allocating on this heap we have to move away from it
+                // no matter how much budget it has left.
+                bool org_hp_active_p = (org_hp_num < n_alloc_heaps);
 
-                if (((size_t)org_size + 2 * delta) >= (size_t)total_size)
+                if (org_hp_active_p && (((size_t)org_size + 2 * delta) >= (size_t)total_size))
                 {
                     acontext->alloc_count++;
                     return;
@@ -14337,6 +14631,11 @@ try_again:
                     for (int i = start; i < end; i++)
                     {
                         gc_heap* hp = GCHeap::GetHeap (i % n_heaps)->pGenGCHeap;
+                        if (hp->heap_number >= n_alloc_heaps)
+                        {
+                            continue;
+                        }
+
                         dd = hp->dynamic_data_of (0);
                         ptrdiff_t size = dd_new_allocation (dd);
 
@@ -14350,7 +14649,7 @@ try_again:
                         {
                             size /= (hp_alloc_context_count + 1);
                         }
-                        if (size > max_size)
+                        if ((size > max_size) || (max_hp_num >= n_alloc_heaps))
                         {
 #ifdef HEAP_BALANCE_INSTRUMENTATION
                             dprintf (HEAP_BALANCE_TEMP_LOG, ("TEMPorg h%d(%dmb), m h%d(%dmb)",
@@ -14429,6 +14728,169 @@ try_again:
     acontext->alloc_count++;
 }
 
+// Called at the end of each GC by heap 0's thread when GCDynamicAllocHeaps is
+// enabled. Ephemeral GCs are triggered by heaps exhausting their gen0 budget so
+// allocating on fewer heaps makes them more frequent. When we spend too much of
+// the time in these GCs we give allocations more heaps, when we hardly do any GC
+// work we take heaps away so their gen0 budgets don't have to be committed.
+void gc_heap::adjust_alloc_heaps (size_t gc_elapsed_time, size_t end_gc_time)
+{
+    const size_t high_gc_percent = 10;
+    const size_t low_gc_percent = 2;
+
+    if (!dynamic_alloc_heaps_p)
+        return;
+
+    size_t last_gc_end_time = alloc_heaps_last_gc_end_time;
+    alloc_heaps_last_gc_end_time = end_gc_time;
+
+    if ((last_gc_end_time == 0) || (end_gc_time <= last_gc_end_time))
+        return;
+
+    // Full GC cost is driven by the size of gen2, not by how many heaps we 
+    // allocate on, so only ephemeral GCs feed the controller.
+    if (settings.condemned_generation == max_generation)
+        return;
+
+    size_t gc_percent = min ((gc_elapsed_time * 100 / (end_gc_time - last_gc_end_time)), (size_t)100);
+    alloc_heaps_gc_percent = (alloc_heaps_gc_percent * 3 + gc_percent) / 4;
+
+    int new_n_alloc_heaps = n_alloc_heaps;
+
+    if (alloc_heaps_gc_percent > high_gc_percent)
+    {
+        new_n_alloc_heaps = min ((n_alloc_heaps * 2), n_heaps);
+    }
+    else if (alloc_heaps_gc_percent < low_gc_percent)
+    {
+        new_n_alloc_heaps = max ((n_alloc_heaps - 1), 1);
+    }
+
+    if (new_n_alloc_heaps != n_alloc_heaps)
+    {
+        dprintf (HEAP_BALANCE_LOG, ("[GC#%Id] %Id%% in GC, alloc heaps %d->%d",
+            settings.gc_index, alloc_heaps_gc_percent, n_alloc_heaps, new_n_alloc_heaps));
+        n_alloc_heaps = new_n_alloc_heaps;
+    }
+}
+
+// Called with more_space_lock_soh held after a_fit_segment_end_p handed out a
+// quantum at the end of the ephemeral segment. We carve the next quantum off
+// as well so a thread that balance_heaps moves to this heap can start
+// allocating without having to take our lock. Only already committed space
+// the gen0 budget allows for is reserved and, since the quantum belongs to this
+// heap, allocations keep their NUMA locality.
+void gc_heap::reserve_alloc_quantum (heap_segment* seg, int align_const)
+{
+    assert (seg == ephemeral_heap_segment);
+    assert (reserved_alloc_quantum == 0);
+
+    size_t pad = Align (min_obj_size, align_const);
+    uint8_t* end = heap_segment_committed (seg) - pad;
+
+    if (!a_size_fit_p (allocation_quantum, alloc_allocated, end, align_const) ||
+        (dd_new_allocation (dynamic_data_of (0)) < (ptrdiff_t)(allocation_quantum + pad)))
+    {
+        return;
+    }
+
+    uint8_t* start = alloc_allocated;
+    // Like for the quantum a_fit_segment_end_p just handed out, limit_from_size
+    // charges this one to the gen0 budget. We hold the lock here, the taker
+    // doesn't, so it must not touch dd_new_allocation again.
+    size_t limit = limit_from_size (allocation_quantum, 0, (end - start), 0, align_const);
+
+    // Keep the heap walkable until somebody takes the quantum.
+    make_unused_array (start, limit);
+    set_gen0_alloc_bricks (start, start + limit);
+    alloc_allocated += limit;
+    total_alloc_bytes_soh += limit - pad;
+
+    dprintf (3, ("h%d reserved alloc quantum [%Ix, %Ix[", heap_number, (size_t)start, (size_t)(start + limit)));
+
+    // Takers only ever clear the slot so publishing it under the lock is safe.
+    reserved_alloc_quantum_size = limit;
+    reserved_alloc_quantum = start;
+}
+
+// Lock free counterpart of try_allocate_more_space for gen0, the quantum was
+// already counted against the budget when we reserved it.
+BOOL gc_heap::take_reserved_alloc_quantum (alloc_context* acontext, size_t size)
+{
+    uint8_t* start = reserved_alloc_quantum;
+    if ((start == 0) || gc_heap::gc_started)
+    {
+        return FALSE;
+    }
+
+    // Once the locked path has used up the rest of the budget it's time for a
+    // GC, leave it to try_allocate_more_space to trigger it rather than keep
+    // handing out memory. The read is racy but only decides which path we take.
+    if (dd_new_allocation (dynamic_data_of (0)) < 0)
+    {
+        return FALSE;
+    }
+
+    size_t aligned_min_obj_size = Align (min_obj_size);
+    size_t limit_size = reserved_alloc_quantum_size;
+
+    // If the slot changed under us the size may be the one of a newer quantum
+    // but then the exchange fails. A quantum is never published twice without
+    // a GC in between and GCs can't happen here.
+    if ((limit_size < (size + aligned_min_obj_size)) ||
+        (Interlocked::CompareExchangePointer (&reserved_alloc_quantum, (uint8_t*)0, start) != start))
+    {
+        return FALSE;
+    }
+
+    uint8_t* hole = acontext->alloc_ptr;
+    if (hole != 0)
+    {
+        // We don't own the heap lock so unlike adjust_limit_clr we leave the
+        // heap's free object space and allocated bytes alone, plan recomputes
+        // the former for gen0 anyway.
+        size_t ac_size = (acontext->alloc_limit - hole);
+        acontext->alloc_bytes -= ac_size;
+        make_unused_array (hole, ac_size + aligned_min_obj_size);
+    }
+
+    dprintf (3, ("h%d took reserved alloc quantum [%Ix, %Ix[", heap_number, (size_t)start, (size_t)(start + limit_size)));
+
+    memclr (start - plug_skew, limit_size);
+    acontext->alloc_ptr = start;
+    acontext->alloc_limit = start + limit_size - aligned_min_obj_size;
+    acontext->alloc_bytes += limit_size - aligned_min_obj_size;
+
+    return TRUE;
+}
+
+// Gives an untaken reserved quantum back before a GC, the same way
+// fix_allocation_context does for an allocation context.
+void gc_heap::fix_reserved_alloc_quantum()
+{
+    uint8_t* start = reserved_alloc_quantum;
+    if (start == 0)
+    {
+        return;
+    }
+
+    size_t limit_size = reserved_alloc_quantum_size;
+    reserved_alloc_quantum = 0;
+
+    // Nobody allocated from it so give back what reserve_alloc_quantum charged.
+    total_alloc_bytes_soh -= limit_size - Align (min_obj_size);
+    dd_new_allocation (dynamic_data_of (0)) += limit_size;
+
+    if ((start + limit_size) == alloc_allocated)
+    {
+        alloc_allocated = start;
+    }
+    else
+    {
+        generation_free_obj_space (generation_of (0)) += limit_size;
+    }
+}
+
 ptrdiff_t gc_heap::get_balance_heaps_loh_effective_budget ()
 {
     if (heap_hard_limit)
@@ -14552,7 +15014,12 @@ BOOL gc_heap::allocate_more_space(alloc_context* acontext, size_t size,
         if (alloc_generation_number == 0)
         {
             balance_heaps (acontext);
-            status = acontext->get_alloc_heap()->pGenGCHeap->try_allocate_more_space (acontext, size, flags, alloc_generation_number);
+            gc_heap* alloc_heap = acontext->get_alloc_heap()->pGenGCHeap;
+            if (alloc_heap->take_reserved_alloc_quantum (acontext, size))
+            {
+                return TRUE;
+            }
+            status = alloc_heap->try_allocate_more_space (acontext, size, flags, alloc_generation_number);
         }
         else
         {
@@ -16358,7 +16825,12 @@ int gc_heap::generation_to_condemn (int n_initial,
                 dprintf (GTC_LOG, ("h%d: f full", heap_number));
 
 #ifdef BACKGROUND_GC
-                if (high_memory_load || v_high_memory_load)
+                // In sustained low latency mode we keep gen2 background and only block once the
+                // memory load is very high - background GCs don't compact so this will leave the
+                // fragmentation in place but it avoids the full compacting pause.
+                BOOL block_on_high_frag_p = (local_settings->pause_mode == pause_sustained_low_latency) ?
+                                            v_high_memory_load : (high_memory_load || v_high_memory_load);
+                if (block_on_high_frag_p)
                 {
                     // For background GC we want to do blocking collections more eagerly because we don't
                     // want to get into the situation where the memory load becomes high while we are in
@@ -16832,6 +17304,10 @@ void gc_heap::gc1()
                 dd_collection_count (dynamic_data_of (0)), 
                 settings.condemned_generation,
                 gc_elapsed_time));
+
+#ifdef MULTIPLE_HEAPS
+            adjust_alloc_heaps (gc_elapsed_time, end_gc_time);
+#endif //MULTIPLE_HEAPS
         }
 
         for (int gen_number = 0; gen_number <= (max_generation + 1); gen_number++)
@@ -19068,6 +19544,65 @@ inline void Prefetch (void* addr)
     UNREFERENCED_PARAMETER(addr);
 }
 #endif //PREFETCH
+
+inline void prefetch_for_mark (void* addr)
+{
+#if defined(_MSC_VER) && (defined(_M_AMD64) || defined(_M_IX86))
+    _mm_prefetch ((const char*)addr, _MM_HINT_T0);
+#elif defined(__GNUC__)
+    __builtin_prefetch (addr);
+#else
+    UNREFERENCED_PARAMETER(addr);
+#endif
+}
+
+// A small FIFO that sits between reading a reference out of an object and marking
+// what it points to. Each reference we park gets its first cache line (which holds
+// the method table pointer and the mark bit) prefetched, and we hand back the one
+// that has been waiting the longest, so by the time we mark it and read its size
+// and GC desc the line is hopefully already in the cache.
+class mark_queue
+{
+    static const size_t slot_count = 16;
+    uint8_t* slots[slot_count];
+    size_t head;
+    size_t count;
+
+public:
+    mark_queue() : head (0), count (0)
+    {
+    }
+
+    // Parks o and returns the oldest parked object once the queue is full, 0 otherwise.
+    inline uint8_t* enqueue (uint8_t* o)
+    {
+        prefetch_for_mark (o);
+        if (count < slot_count)
+        {
+            slots[(head + count) % slot_count] = o;
+            count++;
+            return 0;
+        }
+
+        uint8_t* oldest = slots[head];
+        slots[head] = o;
+        head = (head + 1) % slot_count;
+        return oldest;
+    }
+
+    // Returns the oldest parked object, or 0 if the queue is empty.
+    inline uint8_t* dequeue()
+    {
+        if (count == 0)
+            return 0;
+
+        uint8_t* oldest = slots[head];
+        head = (head + 1) % slot_count;
+        count--;
+        return oldest;
+    }
+};
+
 #ifdef MH_SC_MARK
 inline
 VOLATILE(uint8_t*)& gc_heap::ref_mark_stack (gc_heap* hp, int index)
@@ -19129,6 +19664,9 @@ void gc_heap::mark_object_simple1 (uint8_t* oo, uint8_t* start THREAD_NUMBER_DCL
     // update mark list.
     BOOL  full_p = (settings.condemned_generation == max_generation);
 
+    mark_queue queue;
+    bool use_queue_p = mark_queue_prefetch_p;
+
     assert ((start >= oo) && (start < oo+size(oo)));
 
 #ifndef MH_SC_MARK
@@ -19171,6 +19709,10 @@ void gc_heap::mark_object_simple1 (uint8_t* oo, uint8_t* start THREAD_NUMBER_DCL
                                           {
                                               uint8_t* o = *ppslot;
                                               Prefetch(o);
+                                              if (use_queue_p && (o >= gc_low) && (o < gc_high))
+                                              {
+                                                  o = queue.enqueue (o);
+                                              }
                                               if (gc_mark (o, gc_low, gc_high))
                                               {
                                                   if (full_p)
@@ -19335,6 +19877,34 @@ more_to_do:
 #endif //SORT_MARK_STACK
         }
     next_level:
+        if (mark_stack_empty_p())
+        {
+            // Before we stop, mark whatever is still parked in the prefetch queue
+            // until one of them gives us more work.
+            uint8_t* o;
+            while ((o = queue.dequeue()) != 0)
+            {
+                if (gc_mark (o, gc_low, gc_high))
+                {
+                    if (full_p)
+                    {
+                        m_boundary_fullgc (o);
+                    }
+                    else
+                    {
+                        m_boundary (o);
+                    }
+                    size_t obj_size = size (o);
+                    promoted_bytes (thread) += obj_size;
+                    if (contain_pointers_or_collectible (o))
+                    {
+                        *(mark_stack_tos++) = o;
+                        break;
+                    }
+                }
+            }
+        }
+
         if (!(mark_stack_empty_p()))
         {
             oo = *(--mark_stack_tos);
@@ -20671,6 +21241,7 @@ recheck:
          ! (min_overflow_address == MAX_PTR)))
     {
         overflow_p = TRUE;
+        get_gc_data_per_heap()->mark_overflow_count++;
         // Try to grow the array.
         size_t new_size =
             max (MARK_STACK_INITIAL_LENGTH, 2*mark_stack_array_length);
@@ -20971,6 +21542,7 @@ void gc_heap::mark_phase (int condemned_gen_number, BOOL mark_only_p)
     unsigned finish;
     start = GetCycleCount32();
 #endif //TIME_GC
+    uint64_t phase_start_ts = RawGetHighPrecisionTimeStamp();
 
     int gen_to_init = condemned_gen_number;
     if (condemned_gen_number == max_generation)
@@ -21045,7 +21617,17 @@ void gc_heap::mark_phase (int condemned_gen_number, BOOL mark_only_p)
 #ifdef MULTIPLE_HEAPS
 
 #ifdef MH_SC_MARK
-        if (full_p)
+        // Mode 1 only pays for the snooping on full GCs of big heaps where a single
+        // long object graph is most likely to leave the other GC threads idle.
+        // Mode 2 also steals during ephemeral GCs which helps when the young gens
+        // are large, at the cost of some idle spinning when they are not.
+        int64_t mark_steal_mode = GCConfig::GetMarkStealMode();
+
+        if (mark_steal_mode >= 2)
+        {
+            do_mark_steal_p = TRUE;
+        }
+        else if ((mark_steal_mode == 1) && full_p)
         {
             size_t total_heap_size = get_total_heap_size();
 
@@ -21486,6 +22068,8 @@ void gc_heap::mark_phase (int condemned_gen_number, BOOL mark_only_p)
 
     promoted_bytes (heap_number) -= promoted_bytes_live;
 
+    record_phase_time (gc_phase_mark, phase_start_ts);
+
 #ifdef TIME_GC
         finish = GetCycleCount32();
         mark_time = finish - start;
@@ -22502,6 +23086,15 @@ BOOL gc_heap::plan_loh()
             size_t size = AlignQword (size (o));
             dprintf (1235, ("%Ix(%Id) M", o, size));
 
+#ifdef FEATURE_LOH_COMPACTION
+            // Everything on a segment that got GC_ALLOC_PINNED_OBJECT_HEAP allocations stays
+            // put. The pinned bit is cleared again in compact_loh.
+            if (seg->flags & heap_segment_flags_loh_pinned)
+            {
+                set_pinned (o);
+            }
+#endif //FEATURE_LOH_COMPACTION
+
             if (pinned (o))
             {
                 // We don't clear the pinned bit yet so we can check in 
@@ -22953,6 +23546,7 @@ void gc_heap::plan_phase (int condemned_gen_number)
     unsigned finish;
     start = GetCycleCount32();
 #endif //TIME_GC
+    uint64_t phase_start_ts = RawGetHighPrecisionTimeStamp();
 
     dprintf (2,("---- Plan Phase ---- Condemned generation %d, promotion: %d",
                 condemned_gen_number, settings.promotion ? 1 : 0));
@@ -23907,6 +24501,8 @@ void gc_heap::plan_phase (int condemned_gen_number)
     dprintf (2,("Fragmentation: %Id", fragmentation));
     dprintf (2,("---- End of Plan phase ----"));
 
+    record_phase_time (gc_phase_plan, phase_start_ts);
+
 #ifdef TIME_GC
     finish = GetCycleCount32();
     plan_time = finish - start;
@@ -24625,6 +25221,7 @@ void gc_heap::make_free_lists (int condemned_gen_number)
     unsigned finish;
     start = GetCycleCount32();
 #endif //TIME_GC
+    uint64_t phase_start_ts = RawGetHighPrecisionTimeStamp();
 
     //Promotion has to happen in sweep case.
     assert (settings.promotion);
@@ -24741,6 +25338,8 @@ void gc_heap::make_free_lists (int condemned_gen_number)
         alloc_allocated = start2 + Align (size (start2));
     }
 
+    record_phase_time (gc_phase_sweep, phase_start_ts);
+
 #ifdef TIME_GC
     finish = GetCycleCount32();
     sweep_time = finish - start;
@@ -25905,6 +26504,7 @@ void gc_heap::relocate_phase (int condemned_gen_number,
         unsigned finish;
         start = GetCycleCount32();
 #endif //TIME_GC
+    uint64_t phase_start_ts = RawGetHighPrecisionTimeStamp();
 
 //  %type%  category = quote (relocate);
     dprintf (2,("---- Relocate phase -----"));
@@ -26059,6 +26659,8 @@ void gc_heap::relocate_phase (int condemned_gen_number,
 
 #endif //MULTIPLE_HEAPS
 
+    record_phase_time (gc_phase_relocate, phase_start_ts);
+
 #ifdef TIME_GC
         finish = GetCycleCount32();
         reloc_time = finish - start;
@@ -26425,6 +27027,7 @@ void gc_heap::compact_phase (int condemned_gen_number,
         unsigned finish;
         start = GetCycleCount32();
 #endif //TIME_GC
+    uint64_t phase_start_ts = RawGetHighPrecisionTimeStamp();
     generation*   condemned_gen = generation_of (condemned_gen_number);
     uint8_t*  start_address = first_condemned_address;
     size_t   current_brick = brick_of (start_address);
@@ -26543,6 +27146,8 @@ void gc_heap::compact_phase (int condemned_gen_number,
 
     recover_saved_pinned_info();
 
+    record_phase_time (gc_phase_compact, phase_start_ts);
+
 #ifdef TIME_GC
     finish = GetCycleCount32();
     compact_time = finish - start;
@@ -29842,8 +30447,43 @@ void gc_heap::copy_cards (size_t dst_card,
     unsigned int srctmp = card_table[srcwrd];
     unsigned int dsttmp = card_table[dstwrd];
 
+    // Whole words may only be copied when the words read ahead from the source have not
+    // been overwritten yet, which holds unless the destination overlaps the source from above.
+    BOOL wordcopyp = (dst_card <= src_card) || ((dst_card - src_card) > ((end_card - dst_card) + card_word_width));
+
     for (size_t card = dst_card; card < end_card; card++)
     {
+        // When a whole destination card word lies within the range, build it from the
+        // source words with shifts instead of copying it one bit at a time.
+        if (wordcopyp && (dstbit == 0) && ((end_card - card) > card_word_width))
+        {
+            uint32_t srcbits = (srcbit == 0) ? srctmp :
+                ((srctmp >> srcbit) | (card_table[srcwrd + 1] << (card_word_width - srcbit)));
+
+            if (nextp)
+            {
+                // Each destination card also picks up the source card that follows it.
+                uint32_t nextbit = srcbit + 1;
+                uint32_t srcnextbits = (nextbit == card_word_width) ? card_table[srcwrd + 1] :
+                    ((srctmp >> nextbit) | (card_table[srcwrd + 1] << (card_word_width - nextbit)));
+                srcbits |= srcnextbits;
+            }
+
+            card_table[dstwrd] = srcbits;
+
+#ifdef FEATURE_MANUALLY_MANAGED_CARD_BUNDLES
+            if (srcbits != 0)
+            {
+                card_bundle_set(cardw_card_bundle(dstwrd));
+            }
+#endif
+
+            srctmp = card_table[++srcwrd];
+            dsttmp = card_table[++dstwrd];
+            card += card_word_width - 1;
+            continue;
+        }
+
         if (srctmp & (1 << srcbit))
             dsttmp |= 1 << dstbit;
         else
@@ -32593,6 +33233,15 @@ size_t gc_heap::desired_new_allocation (dynamic_data* dd,
             f = surv_to_growth (cst, limit, max_limit);
             new_allocation = (size_t) min (max ((f * (survivors)), min_gc_size), max_size);
 
+            // Scale the budget computed from this GC's survival only. The previous
+            // desired allocation linear_allocation_model blends in was already
+            // scaled, scaling after the blend would compound the percent from GC
+            // to GC.
+            if (pause_target_budget_percent < 100)
+            {
+                new_allocation = max ((new_allocation / 100 * pause_target_budget_percent), min_gc_size);
+            }
+
             new_allocation = linear_allocation_model (allocation_fraction, new_allocation, 
                                                       dd_desired_allocation (dd), dd_collection_count (dd));
 
@@ -33029,6 +33678,69 @@ void gc_heap::decommit_ephemeral_segment_pages()
     current_gc_data_per_heap->extra_gen0_committed = heap_segment_committed (ephemeral_heap_segment) - heap_segment_allocated (ephemeral_heap_segment);
 }
 
+#ifdef MULTIPLE_HEAPS
+// Called by heap 0's GC thread every DECOMMIT_TIME_STEP_MILLISECONDS while no GC
+// is requested when GCHeapHardLimitDecommitPercent is set. decommit_ephemeral_segment_pages
+// deliberately leaves a lot of slack committed at GC time. When we are above
+// decommit_target we give back the part the remaining gen0 budget won't need,
+// a bounded amount per heap and step, so the committed size trends down between
+// GCs instead of only changing in big jumps when we GC.
+void gc_heap::decommit_step()
+{
+    if (use_large_pages_p)
+        return;
+
+#ifdef BACKGROUND_GC
+    if (recursive_gc_sync::background_running_p())
+        return;
+#endif //BACKGROUND_GC
+
+    size_t committed = current_total_committed;
+    if (committed <= decommit_target)
+        return;
+
+    size_t excess = committed - decommit_target;
+
+    for (int i = 0; (i < n_heaps) && (excess > 0); i++)
+    {
+        gc_heap* hp = g_heaps[i];
+
+        // Allocators only look at the ephemeral segment's committed end while holding
+        // the msl. If it's busy this heap is allocating and will be looked at next step.
+        if (gc_started || !try_enter_spin_lock (&hp->more_space_lock_soh))
+            continue;
+
+        heap_segment* seg = hp->ephemeral_heap_segment;
+        ptrdiff_t budget_left = max (dd_new_allocation (hp->dynamic_data_of (0)), (ptrdiff_t)0);
+        uint8_t* keep_end = align_on_page (hp->alloc_allocated + budget_left);
+        uint8_t* committed_end = heap_segment_committed (seg);
+
+        if (keep_end < committed_end)
+        {
+            size_t size = align_lower_page (min ((size_t)(committed_end - keep_end), 
+                                                 min (excess, (size_t)DECOMMIT_SIZE_PER_STEP)));
+            if (size > 0)
+            {
+                uint8_t* page_start = committed_end - size;
+                dprintf (3, ("h%d decommit step [%Ix, %Ix[", i, (size_t)page_start, (size_t)committed_end));
+
+                if (hp->virtual_decommit (page_start, size, i))
+                {
+                    heap_segment_committed (seg) = page_start;
+                    if (heap_segment_used (seg) > heap_segment_committed (seg))
+                    {
+                        heap_segment_used (seg) = heap_segment_committed (seg);
+                    }
+                    excess -= min (excess, size);
+                }
+            }
+        }
+
+        leave_spin_lock (&hp->more_space_lock_soh);
+    }
+}
+#endif //MULTIPLE_HEAPS
+
 //This is meant to be called by decide_on_compacting.
 
 size_t gc_heap::generation_fragmentation (generation* gen,
@@ -33558,11 +34270,21 @@ CObjectHeader* gc_heap::allocate_large_object (size_t jsize, uint32_t flags, int
     size_t pad = 0;
 #endif //FEATURE_LOH_COMPACTION
 
+    // GC_ALLOC_PINNED_OBJECT_HEAP requests can be smaller than the LOH threshold but the LOH
+    // code, the background GC marking of objects allocated during a BGC in particular, assumes
+    // every object on it is large. So allocate a large block and make the rest of it a free
+    // object.
+    size_t pinned_fill = 0;
+    if ((flags & GC_ALLOC_PINNED_OBJECT_HEAP) && (size < loh_size_threshold))
+    {
+        pinned_fill = max (AlignQword (loh_size_threshold - size), Align (min_obj_size, align_const));
+    }
+
     assert (size >= Align (min_obj_size, align_const));
 #ifdef _MSC_VER
 #pragma inline_depth(0)
 #endif //_MSC_VER
-    if (! allocate_more_space (&acontext, (size + pad), flags, max_generation+1))
+    if (! allocate_more_space (&acontext, (size + pinned_fill + pad), flags, max_generation+1))
     {
         return 0;
     }
@@ -33590,8 +34312,8 @@ CObjectHeader* gc_heap::allocate_large_object (size_t jsize, uint32_t flags, int
 
     uint8_t*  result = acontext.alloc_ptr;
 
-    assert ((size_t)(acontext.alloc_limit - acontext.alloc_ptr) == size);
-    alloc_bytes += size;
+    assert ((size_t)(acontext.alloc_limit - acontext.alloc_ptr) == (size + pinned_fill));
+    alloc_bytes += size + pinned_fill;
 
     CObjectHeader* obj = (CObjectHeader*)result;
 
@@ -33607,7 +34329,7 @@ CObjectHeader* gc_heap::allocate_large_object (size_t jsize, uint32_t flags, int
         }
 #ifdef BACKGROUND_GC
         //the object has to cover one full mark uint32_t
-        assert (size > mark_word_size);
+        assert ((size + pinned_fill) > mark_word_size);
         if (current_c_gc_state != c_gc_state_free)
         {
             dprintf (3, ("Concurrent allocation of a large object %Ix",
@@ -33628,6 +34350,11 @@ CObjectHeader* gc_heap::allocate_large_object (size_t jsize, uint32_t flags, int
     assert (obj != 0);
     assert ((size_t)obj == Align ((size_t)obj, align_const));
 
+    if (pinned_fill != 0)
+    {
+        make_unused_array (result + size, pinned_fill);
+    }
+
     return obj;
 }
 
@@ -36518,6 +37245,9 @@ HRESULT GCHeap::Initialize()
     bool is_restricted; 
     gc_heap::total_physical_mem = GCToOSInterface::GetPhysicalMemoryLimit (&is_restricted);
 
+    gc_heap::mark_queue_prefetch_p = GCConfig::GetMarkQueuePrefetch();
+    gc_heap::pause_target_ms = (size_t)GCConfig::GetGCPauseTarget();
+
 #ifdef BIT64
     gc_heap::heap_hard_limit = (size_t)GCConfig::GetGCHeapHardLimit();
 
@@ -36543,6 +37273,15 @@ HRESULT GCHeap::Initialize()
         }
     }
 
+    if (gc_heap::heap_hard_limit)
+    {
+        uint32_t decommit_percent = (uint32_t)GCConfig::GetGCHeapHardLimitDecommitPercent();
+        if ((decommit_percent > 0) && (decommit_percent < 100))
+        {
+            gc_heap::decommit_target = (size_t)((uint64_t)gc_heap::heap_hard_limit * (uint64_t)decommit_percent / (uint64_t)100);
+        }
+    }
+
     //printf ("heap_hard_limit is %Id, total physical mem: %Id, %s restricted\n", 
     //    gc_heap::heap_hard_limit, gc_heap::total_physical_mem, (is_restricted ? "is" : "is not"));
 #endif //BIT64
@@ -36645,6 +37384,9 @@ HRESULT GCHeap::Initialize()
 
 #ifdef MULTIPLE_HEAPS
     gc_heap::n_heaps = nhp;
+    gc_heap::n_alloc_heaps = nhp;
+    gc_heap::dynamic_alloc_heaps_p = GCConfig::GetDynamicAllocHeaps();
+    gc_heap::reserve_alloc_quantum_p = GCConfig::GetReserveAllocQuantum();
     hr = gc_heap::initialize_gc (seg_size, large_seg_size /*LHEAP_ALLOC*/, nhp);
 #else
     hr = gc_heap::initialize_gc (seg_size, large_seg_size /*LHEAP_ALLOC*/);
@@ -37584,7 +38326,9 @@ GCHeap::Alloc(gc_alloc_context* context, size_t size, uint32_t flags REQD_ALIGN_
 #endif //_PREFAST_
 #endif //MULTIPLE_HEAPS
 
-    if (size < loh_size_threshold)
+    // The LOH is only compacted on request and LOH compaction leaves segments with
+    // pinned allocations in place, so this is where objects that must never move go.
+    if ((size < loh_size_threshold) && !(flags & GC_ALLOC_PINNED_OBJECT_HEAP))
     {
 
 #ifdef TRACE_GC
@@ -38318,6 +39062,8 @@ void gc_heap::do_post_gc()
         current_memory_load));
 #endif //SIMPLE_DPRINTF
 
+    adjust_pause_target_budget();
+
     if (settings.exit_memory_load != 0)
         last_gc_memory_load = settings.exit_memory_load;
     else if (settings.entry_memory_load != 0)
@@ -38770,13 +39516,17 @@ int GCHeap::GetHomeHeapNumber ()
 {
 #ifdef MULTIPLE_HEAPS
     gc_alloc_context* ctx = GCToEEInterface::GetAllocContext();
-    if (!ctx)
+    GCHeap *hp = (ctx ? static_cast<alloc_context*>(ctx)->get_home_heap() : 0);
+    if (hp)
     {
-        return 0;
+        return hp->pGenGCHeap->heap_number;
     }
 
-    GCHeap *hp = static_cast<alloc_context*>(ctx)->get_home_heap();
-    return (hp ? hp->pGenGCHeap->heap_number : 0);
+    // Threads that haven't allocated yet (or aren't managed threads) have no home
+    // heap. Rather than piling all the handles they create into heap 0's handle
+    // table, where they'd all contend on the same handle cache, use the heap of
+    // the processor we are running on.
+    return (heap_select::can_find_heap_fast() ? heap_select::select_heap (0) : 0);
 #else
     return 0;
 #endif //MULTIPLE_HEAPS
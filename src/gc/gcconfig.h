@@ -86,14 +86,27 @@ public:
     BOOL_CONFIG(GCNumaAware,   "GCNumaAware", true, "Enables numa allocations in the GC")        \
     BOOL_CONFIG(GCCpuGroup,    "GCCpuGroup", false, "Enables CPU groups in the GC")              \
     BOOL_CONFIG(GCLargePages,  "GCLargePages", false, "Enables using Large Pages in the GC")     \
+    BOOL_CONFIG(DynamicAllocHeaps, "GCDynamicAllocHeaps", false,                                 \
+        "When set, server GC adapts the number of heaps used for allocations to the time spent " \
+        "in ephemeral GCs")                                                                      \
+    BOOL_CONFIG(ReserveAllocQuantum, "GCReserveAllocQuantum", false,                             \
+        "When set, server GC heaps keep an extra allocation quantum that threads moving to the " \
+        "heap can take without acquiring the heap's allocation lock")                            \
+    BOOL_CONFIG(MarkQueuePrefetch, "GCMarkQueuePrefetch", false,                                 \
+        "When set, blocking GCs prefetch objects through a small queue before marking them")    \
     INT_CONFIG(HeapVerifyLevel, "HeapVerify", HEAPVERIFY_NONE,                                   \
         "When set verifies the integrity of the managed heap on entry and exit of each GC")      \
     INT_CONFIG(LOHCompactionMode, "GCLOHCompact", 0, "Specifies the LOH compaction mode")        \
     INT_CONFIG(LOHThreshold, "GCLOHThreshold", LARGE_OBJECT_SIZE,                                \
         "Specifies the size that will make objects go on LOH")                                   \
+    INT_CONFIG(AllocationTickInterval, "GCAllocationTickInterval", 100*1024,                     \
+        "Specifies how many bytes are allocated between AllocationTick events")                  \
     INT_CONFIG(BGCSpinCount,  "BGCSpinCount", 140, "Specifies the bgc spin count")               \
     INT_CONFIG(BGCSpin,       "BGCSpin",      2,   "Specifies the bgc spin time")                \
     INT_CONFIG(HeapCount,     "GCHeapCount",  0,   "Specifies the number of server GC heaps")    \
+    INT_CONFIG(MarkStealMode, "GCMarkSteal",  1,                                                 \
+        "Specifies when server GC threads steal marking work from other heaps - 0 never, 1 full "\
+        "GCs on heaps larger than 100mb, 2 every GC")                                            \
     INT_CONFIG(Gen0Size,      "GCgen0size",   0, "Specifies the smallest gen0 size")             \
     INT_CONFIG(SegmentSize,   "GCSegmentSize", 0, "Specifies the managed heap segment size")     \
     INT_CONFIG(LatencyMode,   "GCLatencyMode", -1,                                               \
@@ -121,6 +134,12 @@ public:
         "Specifies a hard limit for the GC heap")                                                \
     INT_CONFIG(GCHeapHardLimitPercent, "GCHeapHardLimitPercent", 0,                              \
         "Specifies the GC heap usage as a percentage of the total memory")                       \
+    INT_CONFIG(GCPauseTarget, "GCPauseTarget", 0,                                                \
+        "Specifies the pause time in ms ephemeral GCs try to stay under by shrinking gen0 and "   \
+        "gen1 budgets, 0 means no target")                                                        \
+    INT_CONFIG(GCHeapHardLimitDecommitPercent, "GCHeapHardLimitDecommitPercent", 0,              \
+        "Specifies, as a percentage of the hard limit, the committed size server GC gradually "  \
+        "decommits down to between GCs")                                                         \
     STRING_CONFIG(LogFile,    "GCLogFile",    "Specifies the name of the GC log file")           \
     STRING_CONFIG(ConfigLogFile, "GCConfigLogFile",                                              \
         "Specifies the name of the GC config log file")                                          \
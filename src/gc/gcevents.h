@@ -47,5 +47,15 @@ KNOWN_EVENT(PrvSetGCHandle, GCEventProvider_Private, GCEventLevel_Information, G
 KNOWN_EVENT(PrvDestroyGCHandle, GCEventProvider_Private, GCEventLevel_Information, GCEventKeyword_GCHandlePrivate)
 KNOWN_EVENT(PinPlugAtGCTime, GCEventProvider_Private, GCEventLevel_Verbose, GCEventKeyword_GCPrivate)
 
+// Per heap breakdown of a GC - GC index, heap number, microseconds spent in mark, plan, relocate,
+// compact and sweep and waiting in joins, and the number of mark stack overflows.
+DYNAMIC_EVENT(GCPerHeapPhaseTimes, GCEventLevel_Information, GCEventKeyword_GC,
+    uint32_t, uint32_t, uint32_t, uint32_t, uint32_t, uint32_t, uint32_t, uint32_t, uint32_t)
+
+// An ephemeral GC took longer than GCPauseTarget - GC index, condemned generation, elapsed ms,
+// target ms, the gen0/gen1 budget percent used from now on and the total number of misses.
+DYNAMIC_EVENT(GCPauseTargetMissed, GCEventLevel_Information, GCEventKeyword_GC,
+    uint32_t, uint32_t, uint32_t, uint32_t, uint32_t, uint32_t)
+
 #undef KNOWN_EVENT
 #undef DYNAMIC_EVENT
@@ -12,7 +12,7 @@
 // The minor version of the GC/EE interface. Non-breaking changes are required
 // to bump the minor version number. GCs and EEs with minor version number
 // mismatches can still interopate correctly, with some care.
-#define GC_INTERFACE_MINOR_VERSION 1
+#define GC_INTERFACE_MINOR_VERSION 3
 
 struct ScanContext;
 struct gc_alloc_context;
@@ -109,6 +109,12 @@ struct WriteBarrierParameters
     // The new write watch table, if we are using our own write watch
     // implementation. Used for WriteBarrierOp::SwitchToWriteWatch only.
     uint8_t* write_watch_table;
+
+    // The new start of generation 0, which extends up to ephemeral_high.
+    // Only provided when there is a single generation 0 (workstation GC),
+    // null otherwise. Used for WriteBarrierOp::Initialize and
+    // WriteBarrierOp::StompEphemeral.
+    uint8_t* gen0_low;
 };
 
 // Opaque type for tracking object pointers
@@ -765,6 +771,8 @@ public:
     // owned by the thread that is calling this function. If using per-thread alloc contexts,
     // no lock is needed; callers not using per-thread alloc contexts will need to acquire
     // a lock to ensure that the calling thread has unique ownership over this alloc context;
+    // Objects allocated with GC_ALLOC_PINNED_OBJECT_HEAP never move, so they can be handed
+    // to native code without being pinned.
     virtual Object* Alloc(gc_alloc_context* acontext, size_t size, uint32_t flags) = 0;
 
     // Allocates an object on the large object heap with the given size and flags.
@@ -907,6 +915,8 @@ enum GC_ALLOC_FLAGS
     GC_ALLOC_ALIGN8_BIAS        = 4,
     GC_ALLOC_ALIGN8             = 8,
     GC_ALLOC_ZEROING_OPTIONAL   = 16,
+    // The object will never be moved by the GC, regardless of its size.
+    GC_ALLOC_PINNED_OBJECT_HEAP = 32,
 };
 
 inline GC_ALLOC_FLAGS operator|(GC_ALLOC_FLAGS a, GC_ALLOC_FLAGS b)
@@ -1210,9 +1210,18 @@ public:
     PER_HEAP_ISOLATED
     void fire_per_heap_hist_event (gc_history_per_heap* current_gc_data_per_heap, int heap_num);
 
+    PER_HEAP_ISOLATED
+    void fire_per_heap_phase_times_event (gc_history_per_heap* current_gc_data_per_heap, int heap_num);
+
+    PER_HEAP
+    void record_phase_time (gc_timed_phase phase, uint64_t start_ts);
+
     PER_HEAP_ISOLATED
     void fire_pevents();
 
+    PER_HEAP_ISOLATED
+    void adjust_pause_target_budget();
+
 #ifdef FEATURE_BASICFREEZE
     static void walk_read_only_segment(heap_segment *seg, void *pvContext, object_callback_func pfnMethodTable, object_callback_func pfnObjRef);
 #endif
@@ -1275,6 +1284,14 @@ public:
     // Unlike balance_heaps_loh, this may return nullptr if we failed to change heaps.
     static
     gc_heap* balance_heaps_loh_hard_limit_retry (alloc_context* acontext, size_t size);
+    PER_HEAP_ISOLATED
+    void adjust_alloc_heaps (size_t gc_elapsed_time, size_t end_gc_time);
+    PER_HEAP
+    void reserve_alloc_quantum (heap_segment* seg, int align_const);
+    PER_HEAP
+    BOOL take_reserved_alloc_quantum (alloc_context* acontext, size_t size);
+    PER_HEAP
+    void fix_reserved_alloc_quantum();
     static
     void gc_thread_stub (void* arg);
 #endif //MULTIPLE_HEAPS
@@ -1917,6 +1934,8 @@ protected:
                            alloc_context* acontext, uint32_t flags, heap_segment* seg,
                            int align_const, int gen_number);
     PER_HEAP
+    void set_gen0_alloc_bricks (uint8_t* alloc_ptr, uint8_t* alloc_end);
+    PER_HEAP
     void  leave_allocation_segment (generation* gen);
 
     PER_HEAP
@@ -2852,6 +2871,11 @@ protected:
     PER_HEAP
     void decommit_ephemeral_segment_pages();
 
+#ifdef MULTIPLE_HEAPS
+    PER_HEAP_ISOLATED
+    void decommit_step();
+#endif //MULTIPLE_HEAPS
+
 #ifdef BIT64
     PER_HEAP_ISOLATED
     size_t trim_youngest_desired (uint32_t memory_load,
@@ -3487,6 +3511,24 @@ public:
     PER_HEAP_ISOLATED
     size_t heap_hard_limit;
 
+    // If set, marking parks references in a small queue and prefetches them
+    // before they are marked and scanned.
+    PER_HEAP_ISOLATED
+    bool mark_queue_prefetch_p;
+
+    // If non zero (GCPauseTarget), the pause time in ms ephemeral GCs try to stay
+    // under. adjust_pause_target_budget scales gen0 and gen1 budgets down by
+    // pause_target_budget_percent when a GC takes longer than that and lets them
+    // grow back when GCs are well under the target.
+    PER_HEAP_ISOLATED
+    size_t pause_target_ms;
+
+    PER_HEAP_ISOLATED
+    size_t pause_target_budget_percent;
+
+    PER_HEAP_ISOLATED
+    size_t pause_target_miss_count;
+
     PER_HEAP_ISOLATED
     CLRCriticalSection check_commit_cs;
 
@@ -3497,6 +3539,10 @@ public:
     PER_HEAP_ISOLATED
     size_t current_total_committed_bookkeeping;
 
+    // When non zero, the committed size decommit_step works towards.
+    PER_HEAP_ISOLATED
+    size_t decommit_target;
+
     // This is what GC's own book keeping consumes.
     PER_HEAP_ISOLATED
     size_t current_total_committed_gc_own;
@@ -3553,6 +3599,13 @@ protected:
     int heap_number;
     PER_HEAP
     VOLATILE(int) alloc_context_count;
+    // An allocation quantum carved off the end of the ephemeral segment while
+    // we held more_space_lock_soh. It's formatted as a free object and can be
+    // picked up by the next thread allocating on this heap without the lock.
+    PER_HEAP
+    VOLATILE(uint8_t*) reserved_alloc_quantum;
+    PER_HEAP
+    VOLATILE(size_t) reserved_alloc_quantum_size;
 #else //MULTIPLE_HEAPS
 #define vm_heap ((GCHeap*) g_theGCHeap)
 #define heap_number (0)
@@ -3986,7 +4039,7 @@ protected:
 
 #endif //SYNCHRONIZATION_STATS
 
-#define NUM_LOH_ALIST (7)
+#define NUM_LOH_ALIST (9)
 #define BASE_LOH_ALIST (64*1024)
     PER_HEAP 
     alloc_list loh_alloc_list[NUM_LOH_ALIST-1];
@@ -4250,6 +4303,26 @@ public:
     static
     int n_heaps;
 
+    // The number of heaps balance_heaps hands out to allocation contexts for
+    // gen0 allocations. This is n_heaps unless GCDynamicAllocHeaps is enabled,
+    // in which case adjust_alloc_heaps changes it based on the time spent in
+    // ephemeral GCs.
+    static
+    int n_alloc_heaps;
+
+    PER_HEAP_ISOLATED
+    bool dynamic_alloc_heaps_p;
+
+    PER_HEAP_ISOLATED
+    size_t alloc_heaps_last_gc_end_time;
+
+    // Smoothed percentage of time spent in ephemeral GCs.
+    PER_HEAP_ISOLATED
+    size_t alloc_heaps_gc_percent;
+
+    PER_HEAP_ISOLATED
+    bool reserve_alloc_quantum_p;
+
     static
     gc_heap** g_heaps;
 
@@ -4790,6 +4863,8 @@ struct loh_padding_obj
 #define heap_segment_flags_ma_pcommitted 128
 #define heap_segment_flags_loh_delete   256
 #endif //BACKGROUND_GC
+// LOH segment with GC_ALLOC_PINNED_OBJECT_HEAP allocations, not compacted.
+#define heap_segment_flags_loh_pinned   512
 
 //need to be careful to keep enough pad items to fit a relocation node
 //padded to QuadWord before the plug_skew
@@ -317,6 +317,17 @@ int index_of_highest_set_bit (size_t value);
 
 #define mechanism_mask (1 << (sizeof (uint32_t) * 8 - 1))
 // interesting per heap data we want to record for each GC.
+// The phases of a blocking GC we keep time for in gc_history_per_heap.
+enum gc_timed_phase
+{
+    gc_phase_mark = 0,
+    gc_phase_plan = 1,
+    gc_phase_relocate = 2,
+    gc_phase_compact = 3,
+    gc_phase_sweep = 4,
+    max_gc_timed_phase = 5
+};
+
 class gc_history_per_heap
 {
 public:
@@ -324,6 +335,14 @@ public:
     maxgen_size_increase maxgen_size_info;
     gen_to_condemn_tuning gen_to_condemn_reasons;
 
+    // Time this heap spent in each phase and waiting for the other heaps in
+    // joins, in raw timestamp units.
+    uint64_t phase_time[max_gc_timed_phase];
+    uint64_t join_wait_time;
+
+    // How many times this heap's mark stack overflowed.
+    uint32_t mark_overflow_count;
+
     // The mechanisms data is compacted in the following way:
     // most significant bit indicates if we did the operation.
     // the rest of the bits indicate the reason/mechanism
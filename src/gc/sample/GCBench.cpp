@@ -0,0 +1,497 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+// See the LICENSE file in the project root for more information.
+
+//
+// GCBench.cpp
+//
+
+//
+//  A small benchmark that drives the standalone GC through synthetic allocation patterns, using the
+//  same GC environment as GCSample. It is meant to give a quick signal on GC changes without the rest
+//  of the runtime:
+//
+//  * graph    - replaces linked lists hanging off a fixed set of strong handles (object graph churn)
+//  * loh      - replaces byte arrays above the LOH threshold (LOH churn)
+//  * pin      - keeps a rotating set of small objects pinned while allocating around them
+//  * crossgen - stores freshly allocated objects into objects that have been promoted to gen2
+//
+//  Usage: gcbench [all|graph|loh|pin|crossgen] [iterations]
+//
+//  The sample environment is single threaded and GCs happen on the allocating thread, so the time
+//  spent in an allocation that triggered a GC is reported as that GC's pause. For each scenario it
+//  prints the number of GCs per generation, pause percentiles, allocation throughput and the peak
+//  and final heap size.
+//
+//  All live objects are reachable only through handles since the sample has no stack roots. GCs move
+//  objects, so object pointers are never kept across an allocation; they are fetched from the
+//  handles again instead.
+//
+
+#include "common.h"
+
+#include "gcenv.h"
+
+#include "gc.h"
+#include "objecthandle.h"
+
+#include "gcdesc.h"
+
+#if defined(BIT64)
+#define card_byte_shift     11
+#else
+#define card_byte_shift     10
+#endif
+
+#define card_byte(addr) (((size_t)(addr)) >> card_byte_shift)
+
+class Node : Object {
+public:
+    Object * m_pNext;
+    Object * m_pOther;
+    size_t m_payload[2];
+};
+
+static struct Node_MethodTable
+{
+    // GCDesc
+    CGCDescSeries m_series[1];
+    size_t m_numSeries;
+
+    // The actual methodtable
+    MethodTable m_MT;
+}
+Node_MethodTable;
+
+static MethodTable ByteArray_MethodTable;
+
+static const int max_pauses = 1 << 16;
+
+static struct bench_stats
+{
+    uint64_t pauses[max_pauses];
+    int num_pauses;
+    uint64_t total_pause;
+    uint64_t allocated_bytes;
+    size_t peak_heap_size;
+} stats;
+
+static int64_t qpf;
+
+static uint32_t rand_state = 0x2545F491;
+
+static uint32_t NextRandom()
+{
+    rand_state ^= rand_state << 13;
+    rand_state ^= rand_state >> 17;
+    rand_state ^= rand_state << 5;
+    return rand_state;
+}
+
+static void RecordPause(int64_t start_ts)
+{
+    uint64_t pause = (uint64_t)(GCToOSInterface::QueryPerformanceCounter() - start_ts);
+
+    if (stats.num_pauses < max_pauses)
+        stats.pauses[stats.num_pauses++] = pause;
+
+    stats.total_pause += pause;
+
+    size_t heap_size = g_theGCHeap->GetTotalBytesInUse();
+    if (heap_size > stats.peak_heap_size)
+        stats.peak_heap_size = heap_size;
+}
+
+static Object * Allocate(MethodTable * pMT, size_t size)
+{
+    alloc_context * acontext = GetThread()->GetAllocContext();
+    Object * pObject;
+
+    stats.allocated_bytes += size;
+
+    uint8_t* result = acontext->alloc_ptr;
+    uint8_t* advance = result + size;
+    if (advance <= acontext->alloc_limit)
+    {
+        acontext->alloc_ptr = advance;
+        pObject = (Object *)result;
+    }
+    else
+    {
+        int gc_count = g_theGCHeap->CollectionCount(0);
+        int64_t start_ts = GCToOSInterface::QueryPerformanceCounter();
+
+        uint32_t flags = pMT->ContainsPointers() ? GC_ALLOC_CONTAINS_REF : GC_ALLOC_NO_FLAGS;
+        pObject = g_theGCHeap->Alloc(acontext, size, flags);
+
+        if (g_theGCHeap->CollectionCount(0) != gc_count)
+            RecordPause(start_ts);
+
+        if (pObject == NULL)
+            return NULL;
+    }
+
+    pObject->RawSetMethodTable(pMT);
+
+    return pObject;
+}
+
+static Object * AllocateNode()
+{
+    return Allocate(&Node_MethodTable.m_MT, Node_MethodTable.m_MT.GetBaseSize());
+}
+
+static Object * AllocateByteArray(uint32_t length)
+{
+    size_t size = ByteArray_MethodTable.GetBaseSize() + length;
+    size = (size + sizeof(void*) - 1) & ~(sizeof(void*) - 1);
+
+    ArrayBase * pArray = (ArrayBase *)Allocate(&ByteArray_MethodTable, size);
+    if (pArray == NULL)
+        return NULL;
+
+    *(uint32_t *)((uint8_t *)pArray + ArrayBase::GetOffsetOfNumComponents()) = length;
+    return pArray;
+}
+
+static void WriteBarrier(Object ** dst, Object * ref)
+{
+    *dst = ref;
+
+    if (((uint8_t*)dst < g_gc_lowest_address) || ((uint8_t*)dst >= g_gc_highest_address))
+        return;
+
+    uint8_t* pCardByte = (uint8_t *)*(volatile uint8_t **)(&g_gc_card_table) + card_byte((uint8_t *)dst);
+    if (*pCardByte != 0xFF)
+        *pCardByte = 0xFF;
+}
+
+static OBJECTHANDLE CreateHandle(uint32_t type, Object * pObj)
+{
+    return HndCreateHandle(g_HandleTableMap.pBuckets[0]->pTable[GetCurrentThreadHomeHeapNumber()], type, ObjectToOBJECTREF(pObj));
+}
+
+static Node * FetchNode(OBJECTHANDLE oh)
+{
+    return (Node *)OBJECTREFToObject(HndFetchHandle(oh));
+}
+
+static void InitMethodTables()
+{
+    uint32_t baseSize = sizeof(Node) + sizeof(ObjHeader);
+    Node_MethodTable.m_MT.m_baseSize = max(baseSize, MIN_OBJECT_SIZE);
+    Node_MethodTable.m_MT.m_componentSize = 0;
+    Node_MethodTable.m_MT.m_flags = MTFlag_ContainsPointers;
+
+    // Both reference fields are adjacent so a single series covers them.
+    Node_MethodTable.m_numSeries = 1;
+    Node_MethodTable.m_series[0].SetSeriesOffset(offsetof(Node, m_pNext));
+    Node_MethodTable.m_series[0].SetSeriesCount(2);
+    Node_MethodTable.m_series[0].seriessize -= Node_MethodTable.m_MT.m_baseSize;
+
+    ByteArray_MethodTable.InitializeFreeObject();
+}
+
+// Builds a singly linked list of the given length and returns it in the scratch handle.
+static bool BuildList(OBJECTHANDLE ohScratch, int length)
+{
+    HndAssignHandle(ohScratch, NULL);
+
+    for (int i = 0; i < length; i++)
+    {
+        Object * p = AllocateNode();
+        if (p == NULL)
+            return false;
+
+        WriteBarrier(&((Node *)p)->m_pNext, OBJECTREFToObject(HndFetchHandle(ohScratch)));
+        HndAssignHandle(ohScratch, ObjectToOBJECTREF(p));
+    }
+
+    return true;
+}
+
+static bool RunGraphChurn(int iterations)
+{
+    const int num_roots = 1024;
+    const int list_length = 64;
+
+    static OBJECTHANDLE roots[num_roots];
+    OBJECTHANDLE ohScratch = CreateHandle(HNDTYPE_DEFAULT, NULL);
+    if (ohScratch == NULL)
+        return false;
+
+    for (int i = 0; i < num_roots; i++)
+    {
+        if (!BuildList(ohScratch, list_length))
+            return false;
+        roots[i] = CreateHandle(HNDTYPE_DEFAULT, OBJECTREFToObject(HndFetchHandle(ohScratch)));
+        if (roots[i] == NULL)
+            return false;
+    }
+
+    for (int i = 0; i < iterations; i++)
+    {
+        if (!BuildList(ohScratch, list_length))
+            return false;
+        HndAssignHandle(roots[NextRandom() % num_roots], HndFetchHandle(ohScratch));
+    }
+
+    for (int i = 0; i < num_roots; i++)
+        HndDestroyHandle(HndGetHandleTable(roots[i]), HNDTYPE_DEFAULT, roots[i]);
+    HndDestroyHandle(HndGetHandleTable(ohScratch), HNDTYPE_DEFAULT, ohScratch);
+
+    return true;
+}
+
+static bool RunLOHChurn(int iterations)
+{
+    const int num_roots = 64;
+    const uint32_t min_length = 100 * 1024;
+    const uint32_t max_length = 1024 * 1024;
+
+    static OBJECTHANDLE roots[num_roots];
+
+    for (int i = 0; i < num_roots; i++)
+    {
+        roots[i] = CreateHandle(HNDTYPE_DEFAULT, NULL);
+        if (roots[i] == NULL)
+            return false;
+    }
+
+    for (int i = 0; i < iterations; i++)
+    {
+        // Keep gen0 busy in between so LOH and ephemeral GCs interleave.
+        for (int j = 0; j < 64; j++)
+        {
+            if (AllocateNode() == NULL)
+                return false;
+        }
+
+        if ((i % 16) == 0)
+        {
+            uint32_t length = min_length + NextRandom() % (max_length - min_length);
+            Object * pArray = AllocateByteArray(length);
+            if (pArray == NULL)
+                return false;
+            HndAssignHandle(roots[NextRandom() % num_roots], ObjectToOBJECTREF(pArray));
+        }
+    }
+
+    for (int i = 0; i < num_roots; i++)
+        HndDestroyHandle(HndGetHandleTable(roots[i]), HNDTYPE_DEFAULT, roots[i]);
+
+    return true;
+}
+
+static bool RunPinning(int iterations)
+{
+    const int num_pins = 256;
+    const int num_survivors = 4096;
+
+    static OBJECTHANDLE pins[num_pins];
+    static OBJECTHANDLE survivors[num_survivors];
+
+    for (int i = 0; i < num_pins; i++)
+    {
+        pins[i] = CreateHandle(HNDTYPE_PINNED, NULL);
+        if (pins[i] == NULL)
+            return false;
+    }
+
+    for (int i = 0; i < num_survivors; i++)
+    {
+        survivors[i] = CreateHandle(HNDTYPE_DEFAULT, NULL);
+        if (survivors[i] == NULL)
+            return false;
+    }
+
+    for (int i = 0; i < iterations; i++)
+    {
+        Object * p = AllocateNode();
+        if (p == NULL)
+            return false;
+
+        // Pin every 64th object and keep a fraction of the rest alive so plugs form
+        // around the pinned ones.
+        if ((i % 64) == 0)
+            HndAssignHandle(pins[NextRandom() % num_pins], ObjectToOBJECTREF(p));
+        else if ((i % 8) == 0)
+            HndAssignHandle(survivors[NextRandom() % num_survivors], ObjectToOBJECTREF(p));
+    }
+
+    for (int i = 0; i < num_pins; i++)
+        HndDestroyHandle(HndGetHandleTable(pins[i]), HNDTYPE_PINNED, pins[i]);
+    for (int i = 0; i < num_survivors; i++)
+        HndDestroyHandle(HndGetHandleTable(survivors[i]), HNDTYPE_DEFAULT, survivors[i]);
+
+    return true;
+}
+
+static bool RunCrossGenWrites(int iterations)
+{
+    const int num_old = 16384;
+
+    static OBJECTHANDLE old_nodes[num_old];
+
+    for (int i = 0; i < num_old; i++)
+    {
+        Object * p = AllocateNode();
+        if (p == NULL)
+            return false;
+        old_nodes[i] = CreateHandle(HNDTYPE_DEFAULT, p);
+        if (old_nodes[i] == NULL)
+            return false;
+    }
+
+    // Promote the old objects all the way to gen2.
+    g_theGCHeap->GarbageCollect();
+    g_theGCHeap->GarbageCollect();
+
+    for (int i = 0; i < iterations; i++)
+    {
+        Object * p = AllocateNode();
+        if (p == NULL)
+            return false;
+
+        Node * pOld = FetchNode(old_nodes[NextRandom() % num_old]);
+        WriteBarrier(&pOld->m_pOther, p);
+    }
+
+    for (int i = 0; i < num_old; i++)
+        HndDestroyHandle(HndGetHandleTable(old_nodes[i]), HNDTYPE_DEFAULT, old_nodes[i]);
+
+    return true;
+}
+
+static int ComparePauses(const void* a, const void* b)
+{
+    uint64_t pa = *(const uint64_t*)a;
+    uint64_t pb = *(const uint64_t*)b;
+    return (pa < pb) ? -1 : ((pa > pb) ? 1 : 0);
+}
+
+static double ToMs(uint64_t ticks)
+{
+    return (double)ticks * 1000.0 / (double)qpf;
+}
+
+static double Percentile(int percent)
+{
+    if (stats.num_pauses == 0)
+        return 0.0;
+
+    int index = (int)(((int64_t)stats.num_pauses * percent + 99) / 100) - 1;
+    index = max(0, min(index, stats.num_pauses - 1));
+    return ToMs(stats.pauses[index]);
+}
+
+typedef bool (*scenario_func)(int iterations);
+
+static bool RunScenario(const char* name, scenario_func fn, int iterations)
+{
+    int gc_counts[3];
+    for (int gen = 0; gen <= 2; gen++)
+        gc_counts[gen] = g_theGCHeap->CollectionCount(gen);
+
+    memset(&stats, 0, sizeof(stats));
+
+    int64_t start_ts = GCToOSInterface::QueryPerformanceCounter();
+    if (!fn(iterations))
+    {
+        printf("%s: allocation failed\n", name);
+        return false;
+    }
+    uint64_t elapsed = (uint64_t)(GCToOSInterface::QueryPerformanceCounter() - start_ts);
+
+    qsort(stats.pauses, stats.num_pauses, sizeof(stats.pauses[0]), ComparePauses);
+
+    double elapsed_ms = ToMs(elapsed);
+    printf("%s: %d iterations in %.1fms\n", name, iterations, elapsed_ms);
+    printf("  GCs: gen0 %d, gen1 %d, gen2 %d\n",
+        g_theGCHeap->CollectionCount(0) - gc_counts[0],
+        g_theGCHeap->CollectionCount(1) - gc_counts[1],
+        g_theGCHeap->CollectionCount(2) - gc_counts[2]);
+    printf("  pause ms: p50 %.3f, p90 %.3f, p99 %.3f, max %.3f, total %.1f (%.1f%% of elapsed)\n",
+        Percentile(50), Percentile(90), Percentile(99), Percentile(100),
+        ToMs(stats.total_pause), (elapsed_ms > 0) ? (ToMs(stats.total_pause) * 100.0 / elapsed_ms) : 0.0);
+    printf("  allocated %.1fMB, %.1fMB/s\n",
+        (double)stats.allocated_bytes / (1024 * 1024),
+        (elapsed_ms > 0) ? ((double)stats.allocated_bytes / (1024 * 1024) * 1000.0 / elapsed_ms) : 0.0);
+    printf("  heap size: peak %.1fMB, final %.1fMB\n",
+        (double)stats.peak_heap_size / (1024 * 1024),
+        (double)g_theGCHeap->GetTotalBytesInUse() / (1024 * 1024));
+
+    return true;
+}
+
+extern "C" HRESULT GC_Initialize(IGCToCLR* clrToGC, IGCHeap** gcHeap, IGCHandleManager** gcHandleManager, GcDacVars* gcDacVars);
+
+int __cdecl main(int argc, char* argv[])
+{
+    const char* scenario = (argc > 1) ? argv[1] : "all";
+    int iterations = (argc > 2) ? atoi(argv[2]) : 1000000;
+    if (iterations <= 0)
+    {
+        printf("Usage: gcbench [all|graph|loh|pin|crossgen] [iterations]\n");
+        return -1;
+    }
+
+    if (!GCToOSInterface::Initialize())
+        return -1;
+
+    GcDacVars dacVars;
+    IGCHeap *pGCHeap;
+    IGCHandleManager *pGCHandleManager;
+    if (GC_Initialize(nullptr, &pGCHeap, &pGCHandleManager, &dacVars) != S_OK)
+        return -1;
+
+    if (FAILED(pGCHeap->Initialize()))
+        return -1;
+
+    if (!pGCHandleManager->Initialize())
+        return -1;
+
+    ThreadStore::AttachCurrentThread();
+
+    qpf = GCToOSInterface::QueryPerformanceFrequency();
+
+    InitMethodTables();
+
+    static const struct
+    {
+        const char* name;
+        scenario_func fn;
+        int iterations_divisor;
+    }
+    scenarios[] =
+    {
+        { "graph",    RunGraphChurn,     64 },
+        { "loh",      RunLOHChurn,       64 },
+        { "pin",      RunPinning,        1 },
+        { "crossgen", RunCrossGenWrites, 1 },
+    };
+
+    bool found = false;
+    for (size_t i = 0; i < sizeof(scenarios) / sizeof(scenarios[0]); i++)
+    {
+        if ((strcmp(scenario, "all") == 0) || (strcmp(scenario, scenarios[i].name) == 0))
+        {
+            found = true;
+            // Scenarios that allocate many objects per iteration run fewer of them.
+            int n = max(1, iterations / scenarios[i].iterations_divisor);
+            if (!RunScenario(scenarios[i].name, scenarios[i].fn, n))
+                return -1;
+
+            // Start each scenario from a clean heap.
+            pGCHeap->GarbageCollect();
+        }
+    }
+
+    if (!found)
+    {
+        printf("Unknown scenario '%s'\n", scenario);
+        return -1;
+    }
+
+    return 0;
+}
@@ -23,6 +23,9 @@ Abstract:
 #include <stdio.h>
 #include <string.h>
 #include <sys/resource.h>
+#if defined(__linux__)
+#include <sys/vfs.h>
+#endif
 #include <errno.h>
 #include <limits>
 
@@ -39,16 +42,29 @@ Abstract:
 #define MEM_USAGE_FILENAME "/memory.usage_in_bytes"
 #define CFS_QUOTA_FILENAME "/cpu.cfs_quota_us"
 #define CFS_PERIOD_FILENAME "/cpu.cfs_period_us"
+#define CGROUP2_MEMORY_LIMIT_FILENAME "/memory.max"
+#define CGROUP2_MEMORY_USAGE_FILENAME "/memory.current"
+#define CGROUP2_CPU_MAX_FILENAME "/cpu.max"
+#define CGROUP2_SUPER_MAGIC 0x63677270
+#define TMPFS_MAGIC 0x01021994
 
 class CGroup
 {
+    // 0 if cgroups are not found or unsupported, otherwise the cgroup version (1 or 2)
+    static int s_cgroup_version;
+
     static char* s_memory_cgroup_path;
     static char* s_cpu_cgroup_path;
 public:
     static void Initialize()
     {
-        s_memory_cgroup_path = FindCgroupPath(&IsMemorySubsystem);
-        s_cpu_cgroup_path = FindCgroupPath(&IsCpuSubsystem);
+        s_cgroup_version = FindCGroupVersion();
+        if (s_cgroup_version == 0)
+            return;
+
+        // cgroup v2 has a single unified hierarchy, so there are no per-controller mounts to look for
+        s_memory_cgroup_path = FindCgroupPath(s_cgroup_version == 1 ? &IsMemorySubsystem : nullptr);
+        s_cpu_cgroup_path = FindCgroupPath(s_cgroup_version == 1 ? &IsCpuSubsystem : nullptr);
     }
 
     static void Cleanup()
@@ -65,15 +81,20 @@ public:
         if (s_memory_cgroup_path == nullptr)
             return result;
 
+        const char *limit_filename = (s_cgroup_version == 1) ? MEM_LIMIT_FILENAME : CGROUP2_MEMORY_LIMIT_FILENAME;
         size_t len = strlen(s_memory_cgroup_path);
-        len += strlen(MEM_LIMIT_FILENAME);
+        len += strlen(limit_filename);
         mem_limit_filename = (char*)malloc(len+1);
         if (mem_limit_filename == nullptr)
             return result;
 
         strcpy(mem_limit_filename, s_memory_cgroup_path);
-        strcat(mem_limit_filename, MEM_LIMIT_FILENAME);
+        strcat(mem_limit_filename, limit_filename);
         result = ReadMemoryValueFromFile(mem_limit_filename, val);
+
+        // cgroup v2 reports "max" when there is no limit, which doesn't parse as a number
+        if (result && s_cgroup_version == 2 && *val == 0)
+            result = false;
         free(mem_limit_filename);
         return result;
     }
@@ -87,14 +108,15 @@ public:
         if (s_memory_cgroup_path == nullptr)
             return result;
 
+        const char *usage_filename = (s_cgroup_version == 1) ? MEM_USAGE_FILENAME : CGROUP2_MEMORY_USAGE_FILENAME;
         size_t len = strlen(s_memory_cgroup_path);
-        len += strlen(MEM_USAGE_FILENAME);
+        len += strlen(usage_filename);
         mem_usage_filename = (char*)malloc(len+1);
         if (mem_usage_filename == nullptr)
             return result;
 
         strcpy(mem_usage_filename, s_memory_cgroup_path);
-        strcat(mem_usage_filename, MEM_USAGE_FILENAME);
+        strcat(mem_usage_filename, usage_filename);
         result = ReadMemoryValueFromFile(mem_usage_filename, &temp);
         if (result)
         {
@@ -115,7 +137,9 @@ public:
     {
         long long quota;
         long long period;
-        double cpu_count;
+
+        if (s_cgroup_version == 2)
+            return GetCGroup2CpuLimit(val);
 
         quota = ReadCpuCGroupValue(CFS_QUOTA_FILENAME);
         if (quota <= 0)
@@ -125,21 +149,104 @@ public:
         if (period <= 0)
             return false;
 
+        ComputeCpuLimit(quota, period, val);
+        return true;
+    }
+    
+private:
+    static int FindCGroupVersion()
+    {
+        // It is possible to have both cgroup v1 and v2 enabled on a system. We look at the
+        // file system type of /sys/fs/cgroup to determine which one is the default; in the
+        // "hybrid" setup cgroup v1 controllers still manage the resources we care about.
+#if defined(__linux__)
+        struct statfs stats;
+        if (statfs("/sys/fs/cgroup", &stats) != 0)
+            return 0;
+
+        switch (stats.f_type)
+        {
+            case TMPFS_MAGIC: return 1;
+            case CGROUP2_SUPER_MAGIC: return 2;
+            default: return 0;
+        }
+#else
+        return 0;
+#endif
+    }
+
+    static void ComputeCpuLimit(long long quota, long long period, uint32_t *val)
+    {
+        double cpu_count;
+
         // Cannot have less than 1 CPU
         if (quota <= period)
         {
             *val = 1;
-            return true;
+            return;
         }
 
         // Calculate cpu count based on quota and round it up
         cpu_count = (double) quota / period  + 0.999999999;
         *val = (cpu_count < UINT32_MAX) ? (uint32_t)cpu_count : UINT32_MAX;
+    }
 
-        return true;
+    static bool GetCGroup2CpuLimit(uint32_t *val)
+    {
+        char *filename = nullptr;
+        FILE *file = nullptr;
+        char *line = nullptr;
+        size_t lineLen = 0;
+        char *context = nullptr;
+        char *max_quota_string;
+        char *period_string;
+        long long quota;
+        long long period;
+        bool result = false;
+
+        if (s_cpu_cgroup_path == nullptr)
+            return false;
+
+        filename = (char*)malloc(strlen(s_cpu_cgroup_path) + strlen(CGROUP2_CPU_MAX_FILENAME) + 1);
+        if (filename == nullptr)
+            return false;
+
+        strcpy(filename, s_cpu_cgroup_path);
+        strcat(filename, CGROUP2_CPU_MAX_FILENAME);
+
+        file = fopen(filename, "r");
+        if (file == nullptr)
+            goto done;
+
+        if (getline(&line, &lineLen, file) == -1)
+            goto done;
+
+        // The expected format is "$MAX $PERIOD", where $MAX is "max" if there is no limit
+        max_quota_string = strtok_r(line, " ", &context);
+        period_string = strtok_r(nullptr, " ", &context);
+        if (max_quota_string == nullptr || period_string == nullptr)
+            goto done;
+
+        if (strcmp(max_quota_string, "max") == 0)
+            goto done;
+
+        errno = 0;
+        quota = atoll(max_quota_string);
+        period = atoll(period_string);
+        if (errno != 0 || quota <= 0 || period <= 0)
+            goto done;
+
+        ComputeCpuLimit(quota, period, val);
+        result = true;
+
+    done:
+        if (file)
+            fclose(file);
+        free(line);
+        free(filename);
+        return result;
     }
-    
-private:
+
     static bool IsMemorySubsystem(const char *strTok){
         return strcmp("memory", strTok) == 0;
     }
@@ -220,37 +327,49 @@ private:
                 goto done;
             }
     
-            if (strncmp(filesystemType, "cgroup", 6) == 0)
+            bool isSubsystemMatch;
+            if (is_subsystem == nullptr)
             {
-                char* context = nullptr;
-                char* strTok = strtok_r(options, ",", &context); 
-                while (strTok != nullptr)
+                // cgroup v2 mounts the whole unified hierarchy once
+                isSubsystemMatch = strcmp(filesystemType, "cgroup2") == 0;
+            }
+            else
+            {
+                isSubsystemMatch = false;
+                if (strncmp(filesystemType, "cgroup", 6) == 0)
                 {
-                    if (is_subsystem(strTok))
+                    char* context = nullptr;
+                    char* strTok = strtok_r(options, ",", &context);
+                    while (!isSubsystemMatch && strTok != nullptr)
                     {
-                        mountpath = (char*)malloc(lineLen+1);
-                        if (mountpath == nullptr)
-                            goto done;
-                        mountroot = (char*)malloc(lineLen+1);
-                        if (mountroot == nullptr)
-                            goto done;
-    
-                        sscanfRet = sscanf(line,
-                                           "%*s %*s %*s %s %s ",
-                                           mountroot,
-                                           mountpath);
-                        if (sscanfRet != 2)
-                            assert(!"Failed to parse mount info file contents with sscanf.");
-
-                        // assign the output arguments and clear the locals so we don't free them.
-                        *pmountpath = mountpath;
-                        *pmountroot = mountroot;
-                        mountpath = mountroot = nullptr;
-                        goto done;
+                        isSubsystemMatch = is_subsystem(strTok);
+                        strTok = strtok_r(nullptr, ",", &context);
                     }
-                    strTok = strtok_r(nullptr, ",", &context);
                 }
             }
+
+            if (isSubsystemMatch)
+            {
+                mountpath = (char*)malloc(lineLen+1);
+                if (mountpath == nullptr)
+                    goto done;
+                mountroot = (char*)malloc(lineLen+1);
+                if (mountroot == nullptr)
+                    goto done;
+
+                sscanfRet = sscanf(line,
+                                   "%*s %*s %*s %s %s ",
+                                   mountroot,
+                                   mountpath);
+                if (sscanfRet != 2)
+                    assert(!"Failed to parse mount info file contents with sscanf.");
+
+                // assign the output arguments and clear the locals so we don't free them.
+                *pmountpath = mountpath;
+                *pmountroot = mountroot;
+                mountpath = mountroot = nullptr;
+                goto done;
+            }
         }
     done:
         free(mountpath);
@@ -290,27 +409,39 @@ private:
                 maxLineLen = lineLen;
             }
                    
-            // See man page of proc to get format for /proc/self/cgroup file
-            int sscanfRet = sscanf(line, 
-                                   "%*[^:]:%[^:]:%s",
-                                   subsystem_list,
-                                   cgroup_path);
-            if (sscanfRet != 2)
+            if (is_subsystem == nullptr)
             {
-                assert(!"Failed to parse cgroup info file contents with sscanf.");
-                goto done;
+                // cgroup v2 has a single entry of the form "0::<path>"
+                if (strncmp(line, "0::", 3) == 0)
+                {
+                    int sscanfRet = sscanf(line, "0::%s", cgroup_path);
+                    result = (sscanfRet == 1);
+                }
             }
-    
-            char* context = nullptr;
-            char* strTok = strtok_r(subsystem_list, ",", &context); 
-            while (strTok != nullptr)
+            else
             {
-                if (is_subsystem(strTok))
+                // See man page of proc to get format for /proc/self/cgroup file
+                int sscanfRet = sscanf(line, 
+                                       "%*[^:]:%[^:]:%s",
+                                       subsystem_list,
+                                       cgroup_path);
+                if (sscanfRet != 2)
                 {
-                    result = true;
-                    break;  
+                    assert(!"Failed to parse cgroup info file contents with sscanf.");
+                    goto done;
+                }
+    
+                char* context = nullptr;
+                char* strTok = strtok_r(subsystem_list, ",", &context); 
+                while (strTok != nullptr)
+                {
+                    if (is_subsystem(strTok))
+                    {
+                        result = true;
+                        break;  
+                    }
+                    strTok = strtok_r(nullptr, ",", &context);
                 }
-                strTok = strtok_r(nullptr, ",", &context);
             }
         }
     done:
@@ -426,6 +557,7 @@ private:
     }
 };
    
+int CGroup::s_cgroup_version = 0;
 char *CGroup::s_memory_cgroup_path = nullptr;
 char *CGroup::s_cpu_cgroup_path = nullptr;
 
@@ -217,11 +217,11 @@ TODO: Talk about initializing strutures before use
 #endif
 #endif
 
-SELECTANY const GUID JITEEVersionIdentifier = { /* aec2498a-ca70-408e-903e-1e6d84e90bd2 */
-    0xaec2498a,
-    0xca70,
-    0x408e,
-    {0x90, 0x3e, 0x1e, 0x6d, 0x84, 0xe9, 0x0b, 0xd2}
+SELECTANY const GUID JITEEVersionIdentifier = { /* b744e51c-80d5-4195-b5fe-3db4c999bbda */
+    0xb744e51c,
+    0x80d5,
+    0x4195,
+    {0xb5, 0xfe, 0x3d, 0xb4, 0xc9, 0x99, 0xbb, 0xda}
 };
 
 //////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -572,6 +572,8 @@ enum CorInfoHelpFunc
     /* Miscellaneous */
 
     CORINFO_HELP_BBT_FCN_ENTER,         // record the entry to a method for collecting Tuning data
+    CORINFO_HELP_CLASSPROFILE,          // record the class of the 'this' object at a virtual call site
+    CORINFO_HELP_PATCHPOINT,            // a loop in tier0 code ran long enough that the method should be promoted
 
     CORINFO_HELP_PINVOKE_CALLI,         // Indirect pinvoke call
     CORINFO_HELP_TAILCALL,              // Perform a tail call
@@ -395,6 +395,26 @@ public:
         UINT32 ExecutionCount;
     };
 
+    // Data collected by a class probe at a virtual or interface call site.
+    //
+    // Class profiles share the buffer handed out by allocMethodBlockCounts and
+    // follow all of the block counts. ILOffset is the offset of the call with
+    // CLASS_FLAG set, so the record can't be mistaken for a block count. Count
+    // is the number of calls made at the site and ClassTable holds a reservoir
+    // sample of the receiver classes seen there.
+    struct ClassProfile
+    {
+        enum
+        {
+            SIZE       = 8,
+            CLASS_FLAG = 0x80000000
+        };
+
+        UINT32               ILOffset;
+        UINT32               Count;
+        CORINFO_CLASS_HANDLE ClassTable[SIZE];
+    };
+
     // allocate a basic block profile buffer where execution counts will be stored
     // for jitted basic blocks.
     virtual HRESULT allocMethodBlockCounts (
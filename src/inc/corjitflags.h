@@ -52,7 +52,7 @@ public:
 
     #endif // !defined(_TARGET_X86_)
 
-        CORJIT_FLAG_UNUSED6                 = 13,
+        CORJIT_FLAG_NO_CONCURRENT_GC        = 13, // The GC never runs a background GC, so it doesn't use the write watch
 
     #if defined(_TARGET_X86_) || defined(_TARGET_AMD64_)
 
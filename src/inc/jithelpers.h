@@ -238,6 +238,8 @@
 
     // Miscellaneous
     JITHELPER(CORINFO_HELP_BBT_FCN_ENTER,       JIT_LogMethodEnter,CORINFO_HELP_SIG_REG_ONLY)
+    JITHELPER(CORINFO_HELP_CLASSPROFILE,        JIT_ClassProfile,  CORINFO_HELP_SIG_REG_ONLY)
+    JITHELPER(CORINFO_HELP_PATCHPOINT,          JIT_Patchpoint,    CORINFO_HELP_SIG_REG_ONLY)
 
     JITHELPER(CORINFO_HELP_PINVOKE_CALLI,       GenericPInvokeCalliHelper, CORINFO_HELP_SIG_NO_ALIGN_STUB)
 
@@ -87,6 +87,14 @@ void* ArenaAllocator::allocateNewPage(size_t size)
     {
         // Round to the nearest multiple of default page size
         pageSize = roundUp(pageSize, DEFAULT_PAGE_SIZE);
+
+        // Each page is at least twice as large as the previous one, up to MAX_GROWN_PAGE_SIZE.
+        // Small methods still only use a single default sized page.
+        if (m_lastPage != nullptr)
+        {
+            size_t grownPageSize = min(m_lastPage->m_pageBytes * 2, (size_t)MAX_GROWN_PAGE_SIZE);
+            pageSize             = max(pageSize, grownPageSize);
+        }
     }
 
     if (newPage == nullptr)
@@ -41,6 +41,10 @@ private:
     enum
     {
         DEFAULT_PAGE_SIZE = 0x10000,
+
+        // Pages grow geometrically up to this size so that large methods don't need as many round
+        // trips to the host. The host caches freed slabs below 1MB for reuse by later compilations.
+        MAX_GROWN_PAGE_SIZE = 0x80000,
     };
 
     PageDescriptor* m_firstPage;
@@ -1092,9 +1092,15 @@ protected:
     void genCodeForReturnTrap(GenTreeOp* tree);
     void genCodeForJcc(GenTreeCC* tree);
     void genCodeForSetcc(GenTreeCC* setcc);
+#if defined(_TARGET_XARCH_) || defined(_TARGET_ARM64_)
+    void genCodeForSelectcc(GenTreeOpCC* select);
+#endif
     void genCodeForStoreInd(GenTreeStoreInd* tree);
     void genCodeForSwap(GenTreeOp* tree);
     void genCodeForCpObj(GenTreeObj* cpObjNode);
+#ifdef _TARGET_XARCH_
+    void genCodeForCpObjNonGCRegionUnroll(GenTreeObj* cpObjNode, unsigned size);
+#endif
     void genCodeForCpBlkRepMovs(GenTreeBlk* cpBlkNode);
     void genCodeForCpBlkUnroll(GenTreeBlk* cpBlkNode);
 #ifndef _TARGET_X86_
@@ -1196,6 +1202,9 @@ protected:
     // Deals with codegen for muti-register struct returns.
     bool isStructReturn(GenTree* treeNode);
     void genStructReturn(GenTree* treeNode);
+#if FEATURE_MULTIREG_RET && (defined(UNIX_AMD64_ABI) || defined(_TARGET_ARM64_))
+    void genStructReturnFieldList(GenTreeFieldList* fieldList);
+#endif
 
 #if defined(_TARGET_X86_) || defined(_TARGET_ARM_)
     void genLongReturn(GenTree* treeNode);
@@ -1285,6 +1294,8 @@ public:
 
     void inst_SET(emitJumpKind condition, regNumber reg);
 
+    void inst_SEL(emitJumpKind condition, emitAttr size, regNumber dstReg, regNumber trueReg, regNumber falseReg);
+
     void inst_RV(instruction ins, regNumber reg, var_types type, emitAttr size = EA_UNKNOWN);
 
     void inst_RV_RV(instruction ins,
@@ -391,6 +391,12 @@ void CodeGen::genCodeForTreeNode(GenTree* treeNode)
             genCodeForSetcc(treeNode->AsCC());
             break;
 
+#ifdef _TARGET_ARM64_
+        case GT_SELECTCC:
+            genCodeForSelectcc(treeNode->AsOpCC());
+            break;
+#endif // _TARGET_ARM64_
+
         case GT_RETURNTRAP:
             genCodeForReturnTrap(treeNode->AsOp());
             break;
@@ -3663,21 +3669,29 @@ bool CodeGen::isStructReturn(GenTree* treeNode)
 //    None
 //
 // Assumption:
-//    op1 of GT_RETURN node is either GT_LCL_VAR or multi-reg GT_CALL
+//    op1 of GT_RETURN node is either GT_LCL_VAR, the GT_FIELD_LIST of a promoted GT_LCL_VAR (arm64)
+//    or multi-reg GT_CALL
 void CodeGen::genStructReturn(GenTree* treeNode)
 {
     assert(treeNode->OperGet() == GT_RETURN);
     assert(isStructReturn(treeNode));
     GenTree* op1 = treeNode->gtGetOp1();
 
-    if (op1->OperGet() == GT_LCL_VAR)
+#ifdef _TARGET_ARM64_
+    if (op1->OperIs(GT_FIELD_LIST))
+    {
+        genStructReturnFieldList(op1->AsFieldList());
+    }
+    else
+#endif // _TARGET_ARM64_
+        if (op1->OperGet() == GT_LCL_VAR)
     {
         GenTreeLclVarCommon* lclVar  = op1->AsLclVarCommon();
         LclVarDsc*           varDsc  = &(compiler->lvaTable[lclVar->GetLclNum()]);
         var_types            lclType = genActualType(varDsc->TypeGet());
 
         assert(varTypeIsStruct(lclType));
-        assert(varDsc->lvIsMultiRegRet);
+        assert(varDsc->lvIsMultiRegRet || varDsc->lvIsMultiRegRetVal);
 
         ReturnTypeDesc retTypeDesc;
         unsigned       regCount;
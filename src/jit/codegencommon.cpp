@@ -4625,10 +4625,12 @@ void CodeGen::genCheckUseBlockInit()
             /* With compInitMem, all untracked vars will have to be init'ed */
             /* VSW 102460 - Do not force initialization of compiler generated temps,
                 unless they are untracked GC type or structs that contain GC pointers */
+            /* Nor of locals that are always fully defined before they are used,
+                see fgMarkDefinitelyAssignedLocals */
             CLANG_FORMAT_COMMENT_ANCHOR;
 
             if ((!varDsc->lvTracked || (varDsc->lvType == TYP_STRUCT)) && varDsc->lvOnFrame &&
-                (!varDsc->lvIsTemp || varDsc->HasGCPtr()))
+                (!varDsc->lvIsTemp || varDsc->HasGCPtr()) && !varDsc->lvDefinitelyAssigned)
             {
 
                 varDsc->lvMustInit = true;
@@ -11216,6 +11218,42 @@ void CodeGen::genReturn(GenTree* treeNode)
 #endif // defined(DEBUG) && defined(_TARGET_XARCH_)
 }
 
+#if FEATURE_MULTIREG_RET && (defined(UNIX_AMD64_ABI) || defined(_TARGET_ARM64_))
+//------------------------------------------------------------------------
+// genStructReturnFieldList: Generates code for returning a promoted struct
+//    field by field.
+//
+// Arguments:
+//    fieldList - The GT_FIELD_LIST operand of the GT_RETURN node, with one
+//                field per return register.
+//
+// Notes:
+//    LSRA constrains each field to its return register, so normally there
+//    is nothing to move.
+//
+void CodeGen::genStructReturnFieldList(GenTreeFieldList* fieldList)
+{
+    ReturnTypeDesc retTypeDesc;
+    retTypeDesc.InitializeStructReturnType(compiler, compiler->info.compMethodInfo->args.retTypeClass);
+
+    unsigned regIndex = 0;
+    for (GenTreeFieldList::Use& use : fieldList->Uses())
+    {
+        GenTree*  fieldNode = use.GetNode();
+        var_types regType   = retTypeDesc.GetReturnRegType(regIndex);
+        regNumber retReg    = retTypeDesc.GetABIReturnReg(regIndex);
+        regNumber fieldReg  = genConsumeReg(fieldNode);
+
+        if (fieldReg != retReg)
+        {
+            inst_RV_RV(ins_Copy(regType), retReg, fieldReg, regType);
+        }
+        regIndex++;
+    }
+    assert(regIndex == retTypeDesc.GetReturnRegCount());
+}
+#endif // FEATURE_MULTIREG_RET && (UNIX_AMD64_ABI || _TARGET_ARM64_)
+
 #if defined(DEBUG) && defined(_TARGET_XARCH_)
 
 //------------------------------------------------------------------------
@@ -85,6 +85,20 @@ public:
         m_genAlignLoops = value;
     }
 
+    //-------------------------------------------------------------------------
+    //  The boundary that the heads of hot loops are aligned to, or 0 if they
+    //  aren't (see JitAlignHotLoops). Unlike ShouldAlignLoops this only pads
+    //  loops that are small enough to benefit.
+
+    unsigned GetAlignHotLoopBoundary()
+    {
+        return m_genAlignHotLoopBoundary;
+    }
+    void SetAlignHotLoopBoundary(unsigned value)
+    {
+        m_genAlignHotLoopBoundary = value;
+    }
+
     // TODO-Cleanup: Abstract out the part of this that finds the addressing mode, and
     // move it to Lower
     virtual bool genCreateAddrMode(GenTree*  addr,
@@ -106,6 +120,7 @@ public:
 protected:
     Compiler* compiler;
     bool      m_genAlignLoops;
+    unsigned  m_genAlignHotLoopBoundary;
 
 private:
 #if defined(_TARGET_XARCH_)
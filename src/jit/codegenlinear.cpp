@@ -314,6 +314,13 @@ void CodeGen::genCodeForBBlist()
         {
             GetEmitter()->emitLoopAlign();
         }
+        else if ((GetAlignHotLoopBoundary() != 0) && ((block->bbFlags & (BBF_LOOP_HEAD | BBF_COLD)) == BBF_LOOP_HEAD) &&
+                 (block->getBBWeight(compiler) >=
+                  (BasicBlock::weight_t)JitConfig.JitAlignLoopMinBlockWeight() * BB_UNITY_WEIGHT))
+        {
+            // The emitter decides whether padding is worthwhile once it knows the loop's size.
+            GetEmitter()->emitLoopAlign(GetAlignHotLoopBoundary(), JitConfig.JitAlignLoopMaxCodeSize());
+        }
 #endif
 
         genLogLabel(block);
@@ -2384,3 +2391,28 @@ void CodeGen::genCodeForSetcc(GenTreeCC* setcc)
     inst_SETCC(setcc->gtCondition, setcc->TypeGet(), setcc->GetRegNum());
     genProduceReg(setcc);
 }
+
+#if defined(_TARGET_XARCH_) || defined(_TARGET_ARM64_)
+//------------------------------------------------------------------------
+// genCodeForSelectcc: Generate code for a GT_SELECTCC node.
+//
+// Arguments:
+//    select - The node
+//
+void CodeGen::genCodeForSelectcc(GenTreeOpCC* select)
+{
+    assert(select->OperIs(GT_SELECTCC));
+
+    GenTree* trueVal  = select->gtGetOp1();
+    GenTree* falseVal = select->gtGetOp2();
+
+    // Lowering only produces these for integral conditions, which need a single check.
+    const GenConditionDesc& desc = GenConditionDesc::Get(select->gtCondition);
+    assert(desc.oper == GT_NONE);
+
+    genConsumeOperands(select);
+    inst_SEL(desc.jumpKind1, emitActualTypeSize(select->TypeGet()), select->GetRegNum(), trueVal->GetRegNum(),
+             falseVal->GetRegNum());
+    genProduceReg(select);
+}
+#endif // defined(_TARGET_XARCH_) || defined(_TARGET_ARM64_)
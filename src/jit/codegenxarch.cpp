@@ -1170,18 +1170,23 @@ bool CodeGen::isStructReturn(GenTree* treeNode)
 //    None
 //
 // Assumption:
-//    op1 of GT_RETURN node is either GT_LCL_VAR or multi-reg GT_CALL
+//    op1 of GT_RETURN node is either GT_LCL_VAR, the GT_FIELD_LIST of a promoted GT_LCL_VAR
+//    or multi-reg GT_CALL
 void CodeGen::genStructReturn(GenTree* treeNode)
 {
     assert(treeNode->OperGet() == GT_RETURN);
     GenTree* op1 = treeNode->gtGetOp1();
 
 #ifdef UNIX_AMD64_ABI
-    if (op1->OperGet() == GT_LCL_VAR)
+    if (op1->OperIs(GT_FIELD_LIST))
+    {
+        genStructReturnFieldList(op1->AsFieldList());
+    }
+    else if (op1->OperGet() == GT_LCL_VAR)
     {
         GenTreeLclVarCommon* lclVar = op1->AsLclVarCommon();
         LclVarDsc*           varDsc = &(compiler->lvaTable[lclVar->GetLclNum()]);
-        assert(varDsc->lvIsMultiRegRet);
+        assert(varDsc->lvIsMultiRegRet || varDsc->lvIsMultiRegRetVal);
 
         ReturnTypeDesc retTypeDesc;
         retTypeDesc.InitializeStructReturnType(compiler, varDsc->lvVerTypeInfo.GetClassHandle());
@@ -1847,6 +1852,10 @@ void CodeGen::genCodeForTreeNode(GenTree* treeNode)
             genCodeForSetcc(treeNode->AsCC());
             break;
 
+        case GT_SELECTCC:
+            genCodeForSelectcc(treeNode->AsOpCC());
+            break;
+
         case GT_BT:
             genCodeForBT(treeNode->AsOp());
             break;
@@ -2954,15 +2963,17 @@ void CodeGen::genCodeForInitBlkUnroll(GenTreeBlk* node)
     emitter* emit = GetEmitter();
     unsigned size = node->GetLayout()->GetSize();
 
-    // Fill as much as possible using SSE2 stores.
+    // Fill as much as possible using SSE2 stores, or AVX stores if the block is large enough.
     if (size >= XMM_REGSIZE_BYTES)
     {
         regNumber srcXmmReg = node->GetSingleTempReg(RBM_ALLFLOAT);
+        bool      useYmm    = (size >= YMM_REGSIZE_BYTES) && compiler->compSupports(InstructionSet_AVX);
 
         if (src->gtSkipReloadOrCopy()->IsIntegralConst(0))
         {
             // If the source is constant 0 then always use xorps, it's faster
-            // than copying the constant from a GPR to a XMM register.
+            // than copying the constant from a GPR to a XMM register. The VEX
+            // encoded form also clears the upper half of the YMM register.
             emit->emitIns_R_R(INS_xorps, EA_16BYTE, srcXmmReg, srcXmmReg);
         }
         else
@@ -2973,19 +2984,35 @@ void CodeGen::genCodeForInitBlkUnroll(GenTreeBlk* node)
             // For x86, we need one more to convert it from 8 bytes to 16 bytes.
             emit->emitIns_R_R(INS_punpckldq, EA_16BYTE, srcXmmReg, srcXmmReg);
 #endif
+            if (useYmm)
+            {
+                emit->emitIns_R_R_R_I(INS_vinsertf128, EA_32BYTE, srcXmmReg, srcXmmReg, srcXmmReg, 0x01);
+            }
         }
 
-        for (unsigned regSize = XMM_REGSIZE_BYTES; size >= regSize; size -= regSize, dstOffset += regSize)
+        unsigned regSize = useYmm ? YMM_REGSIZE_BYTES : XMM_REGSIZE_BYTES;
+
+        for (; size >= XMM_REGSIZE_BYTES; size -= regSize, dstOffset += regSize)
         {
+            if (size < regSize)
+            {
+                regSize = XMM_REGSIZE_BYTES;
+            }
+
             emit->emitIns_AR_R(INS_movdqu, EA_ATTR(regSize), srcXmmReg, dstAddrBaseReg, dstOffset);
         }
 
-        // TODO-CQ-XArch: On x86 we could initialize 8 byte at once by using MOVQ instead of two 4 byte MOV stores.
-        // On x64 it may also be worth zero initializing a 4/8 byte remainder using MOVD/MOVQ, that avoids the need
-        // to allocate a GPR just for the remainder.
+        // Fill the remainder by storing the last XMM_REGSIZE_BYTES of the block again,
+        // overlapping the previous store. That avoids a sequence of narrower stores.
+        if (size > 0)
+        {
+            dstOffset -= (XMM_REGSIZE_BYTES - size);
+            emit->emitIns_AR_R(INS_movdqu, EA_16BYTE, srcXmmReg, dstAddrBaseReg, dstOffset);
+            size = 0;
+        }
     }
 
-    // Fill the remainder using normal stores.
+    // Fill small blocks using normal stores.
     for (unsigned regSize = REGSIZE_BYTES; size > 0; size -= regSize, dstOffset += regSize)
     {
         while (regSize > size)
@@ -3102,10 +3129,25 @@ void CodeGen::genCodeForCpBlkUnroll(GenTreeBlk* node)
     if (size >= XMM_REGSIZE_BYTES)
     {
         regNumber tempReg = node->GetSingleTempReg(RBM_ALLFLOAT);
+        bool      useYmm  = (size >= YMM_REGSIZE_BYTES) && compiler->compSupports(InstructionSet_AVX);
+        unsigned  regSize = useYmm ? YMM_REGSIZE_BYTES : XMM_REGSIZE_BYTES;
 
-        for (unsigned regSize = XMM_REGSIZE_BYTES; size >= regSize;
-             size -= regSize, srcOffset += regSize, dstOffset += regSize)
+        while (size > 0)
         {
+            if (size < regSize)
+            {
+                regSize = XMM_REGSIZE_BYTES;
+            }
+
+            if (size < regSize)
+            {
+                // Copy the remainder by moving the last XMM_REGSIZE_BYTES of the block again,
+                // overlapping the previous move. That avoids a sequence of narrower moves.
+                srcOffset -= (regSize - size);
+                dstOffset -= (regSize - size);
+                size = regSize;
+            }
+
             if (srcLclNum != BAD_VAR_NUM)
             {
                 emit->emitIns_R_S(INS_movdqu, EA_ATTR(regSize), tempReg, srcLclNum, srcOffset);
@@ -3123,11 +3165,11 @@ void CodeGen::genCodeForCpBlkUnroll(GenTreeBlk* node)
             {
                 emit->emitIns_AR_R(INS_movdqu, EA_ATTR(regSize), tempReg, dstAddrBaseReg, dstOffset);
             }
-        }
 
-        // TODO-CQ-XArch: On x86 we could copy 8 byte at once by using MOVQ instead of four 4 byte MOV stores.
-        // On x64 it may also be worth copying a 4/8 byte remainder using MOVD/MOVQ, that avoids the need to
-        // allocate a GPR just for the remainder.
+            size -= regSize;
+            srcOffset += regSize;
+            dstOffset += regSize;
+        }
     }
 
     if (size > 0)
@@ -3615,6 +3657,8 @@ void CodeGen::genCodeForCpObj(GenTreeObj* cpObjNode)
                     i++;
                 } while ((i < slots) && !layout->IsGCPtr(i));
 
+                unsigned nonGcSize = nonGcSlotCount * TARGET_POINTER_SIZE;
+
                 // If we have a very small contiguous non-gc region, it's better just to
                 // emit a sequence of movsp instructions
                 if (nonGcSlotCount < CPOBJ_NONGC_SLOTS_LIMIT)
@@ -3625,6 +3669,16 @@ void CodeGen::genCodeForCpObj(GenTreeObj* cpObjNode)
                         nonGcSlotCount--;
                     }
                 }
+                else if (nonGcSize <= compiler->getCpBlkUnrollLimit())
+                {
+                    // Medium sized regions are copied with SIMD moves, that avoids the
+                    // startup cost of rep movsp. RSI and RDI are advanced past the region
+                    // afterwards, as movsp would have done.
+                    genCodeForCpObjNonGCRegionUnroll(cpObjNode, nonGcSize);
+
+                    GetEmitter()->emitIns_R_I(INS_add, emitActualTypeSize(srcAddrType), REG_RSI, nonGcSize);
+                    GetEmitter()->emitIns_R_I(INS_add, emitActualTypeSize(dstAddr->TypeGet()), REG_RDI, nonGcSize);
+                }
                 else
                 {
                     // Otherwise, we can save code-size and improve CQ by emitting
@@ -3653,6 +3707,47 @@ void CodeGen::genCodeForCpObj(GenTreeObj* cpObjNode)
     gcInfo.gcMarkRegSetNpt(RBM_RDI);
 }
 
+//----------------------------------------------------------------------------------
+// genCodeForCpObjNonGCRegionUnroll - Copy a region of a CpObj that contains no GC pointers
+//    using SIMD moves, from the address in RSI to the address in RDI.
+//
+// Arguments:
+//    cpObjNode - the GT_STORE_OBJ node being generated
+//    size      - the size of the region, at least XMM_REGSIZE_BYTES
+//
+// Notes:
+//    The region's tail is copied by moving its last XMM_REGSIZE_BYTES again, so no move
+//    touches memory outside the region. RSI and RDI are not updated.
+//
+void CodeGen::genCodeForCpObjNonGCRegionUnroll(GenTreeObj* cpObjNode, unsigned size)
+{
+    assert(size >= XMM_REGSIZE_BYTES);
+
+    emitter*  emit    = GetEmitter();
+    regNumber tempReg = cpObjNode->GetSingleTempReg(RBM_ALLFLOAT);
+    bool      useYmm  = (size >= YMM_REGSIZE_BYTES) && compiler->compSupports(InstructionSet_AVX);
+    unsigned  regSize = useYmm ? YMM_REGSIZE_BYTES : XMM_REGSIZE_BYTES;
+    unsigned  offset  = 0;
+
+    while (offset < size)
+    {
+        if ((size - offset) < regSize)
+        {
+            regSize = XMM_REGSIZE_BYTES;
+        }
+
+        if ((size - offset) < regSize)
+        {
+            offset = size - regSize;
+        }
+
+        emit->emitIns_R_AR(INS_movdqu, EA_ATTR(regSize), tempReg, REG_RSI, offset);
+        emit->emitIns_AR_R(INS_movdqu, EA_ATTR(regSize), tempReg, REG_RDI, offset);
+
+        offset += regSize;
+    }
+}
+
 #ifdef _TARGET_AMD64_
 //----------------------------------------------------------------------------------
 // genCodeForCpBlkHelper - Generate code for a CpBlk node by the means of the VM memcpy helper call
@@ -6178,7 +6273,8 @@ void CodeGen::genCompareInt(GenTree* treeNode)
     assert(!varTypeIsFloating(op2Type));
 
     instruction ins;
-    var_types   type = TYP_UNKNOWN;
+    var_types   type        = TYP_UNKNOWN;
+    bool        compareZero = false;
 
     if (tree->OperIs(GT_TEST_EQ, GT_TEST_NE))
     {
@@ -6204,8 +6300,9 @@ void CodeGen::genCompareInt(GenTree* treeNode)
     {
         // We're comparing a register to 0 so we can generate "test reg1, reg1"
         // instead of the longer "cmp reg1, 0"
-        ins = INS_test;
-        op2 = op1;
+        ins         = INS_test;
+        op2         = op1;
+        compareZero = true;
     }
     else
     {
@@ -6252,7 +6349,14 @@ void CodeGen::genCompareInt(GenTree* treeNode)
     // TYP_UINT and TYP_ULONG should not appear here, only small types can be unsigned
     assert(!varTypeIsUnsigned(type) || varTypeIsSmall(type));
 
-    GetEmitter()->emitInsBinary(ins, emitTypeSize(type), op1, op2);
+    // If the instruction that produced op1 already set the flags according to its result
+    // then the "test reg1, reg1" is redundant. GT_CMP doesn't tell us which flags its
+    // user needs so only equality relops may rely on ZF alone.
+    if (!compareZero || !compiler->opts.OptimizationEnabled() ||
+        !GetEmitter()->AreFlagsSetToZeroCmp(op1->GetRegNum(), emitTypeSize(type), tree->OperIs(GT_EQ, GT_NE)))
+    {
+        GetEmitter()->emitInsBinary(ins, emitTypeSize(type), op1, op2);
+    }
 
     // Are we evaluating this into a register?
     if (targetReg != REG_NA)
@@ -3513,6 +3513,9 @@ void Compiler::compInitOptions(JitFlags* jitFlags)
     fgBlockCounts                = nullptr;
     fgProfileData_ILSizeMismatch = false;
     fgNumProfileRuns             = 0;
+    fgClassProfiles              = nullptr;
+    fgClassProfilesCount         = 0;
+    fgClassProbeCount            = 0;
     if (jitFlags->IsSet(JitFlags::JIT_FLAG_BBOPT))
     {
         assert(!compIsForInlining());
@@ -3547,6 +3550,25 @@ void Compiler::compInitOptions(JitFlags* jitFlags)
             assert(fgBlockCounts == nullptr);
         }
 #endif
+
+        // Class profiles collected by tier0 class probes follow the block
+        // counts, split them off so they aren't mistaken for block counts.
+        if (fgBlockCounts != nullptr)
+        {
+            const UINT32 classProfileRecords =
+                sizeof(ICorJitInfo::ClassProfile) / sizeof(ICorJitInfo::BlockCounts);
+
+            for (UINT32 i = 0; i < fgBlockCountsCount; i++)
+            {
+                if ((fgBlockCounts[i].ILOffset & ICorJitInfo::ClassProfile::CLASS_FLAG) != 0)
+                {
+                    fgClassProfiles      = (ICorJitInfo::ClassProfile*)&fgBlockCounts[i];
+                    fgClassProfilesCount = (fgBlockCountsCount - i) / classProfileRecords;
+                    fgBlockCountsCount   = i;
+                    break;
+                }
+            }
+        }
     }
 
 #ifdef DEBUG
@@ -4147,6 +4169,8 @@ _SetMinOpts:
             codeGen->setFrameRequired(true);
 #endif
 
+        codeGen->SetAlignHotLoopBoundary(0);
+
         if (opts.jitFlags->IsSet(JitFlags::JIT_FLAG_RELOC))
         {
             codeGen->SetAlignLoops(false); // loop alignment not supported for prejitted code
@@ -4160,6 +4184,15 @@ _SetMinOpts:
         else
         {
             codeGen->SetAlignLoops(opts.jitFlags->IsSet(JitFlags::JIT_FLAG_ALIGN_LOOPS));
+
+#ifdef _TARGET_XARCH_
+            // Block weights are only meaningful when optimizing, and padding works
+            // against optimizing for size.
+            if ((JitConfig.JitAlignHotLoops() != 0) && opts.OptimizationEnabled() && (opts.compCodeOpt != SMALL_CODE))
+            {
+                codeGen->SetAlignHotLoopBoundary((JitConfig.JitAlignLoopBoundary() > 16) ? 32 : 16);
+            }
+#endif // _TARGET_XARCH_
         }
     }
 
@@ -4564,6 +4597,11 @@ void Compiler::compCompile(void** methodCodePtr, ULONG* methodCodeSize, JitFlags
         fgInstrumentMethod();
     }
 
+    if (compileFlags->IsSet(JitFlags::JIT_FLAG_TIER0))
+    {
+        fgAddPatchpoints();
+    }
+
     // We could allow ESP frames. Just need to reserve space for
     // pushing EBP if the method becomes an EBP-frame after an edit.
     // Note that requiring a EBP Frame disallows double alignment.  Thus if we change this
@@ -4679,8 +4717,13 @@ void Compiler::compCompile(void** methodCodePtr, ULONG* methodCodeSize, JitFlags
         optCloneLoops();
         EndPhase(PHASE_CLONE_LOOPS);
 
+        // Turn simple array fill and copy loops into block operations.
+        optReplaceLoopsWithBlockOps();
+        EndPhase(PHASE_LOOP_BLOCK_OPS);
+
         /* Unroll loops */
         optUnrollLoops();
+        optPartiallyUnrollLoops();
         EndPhase(PHASE_UNROLL_LOOPS);
     }
 
@@ -4746,6 +4789,7 @@ void Compiler::compCompile(void** methodCodePtr, ULONG* methodCodeSize, JitFlags
         bool doCopyProp      = true;
         bool doAssertionProp = true;
         bool doRangeAnalysis = true;
+        bool doBranchOpts    = true;
         int  iterations      = 1;
 
 #if defined(OPT_CONFIG)
@@ -4756,6 +4800,7 @@ void Compiler::compCompile(void** methodCodePtr, ULONG* methodCodeSize, JitFlags
         doCopyProp      = doValueNum && (JitConfig.JitDoCopyProp() != 0);
         doAssertionProp = doValueNum && (JitConfig.JitDoAssertionProp() != 0);
         doRangeAnalysis = doAssertionProp && (JitConfig.JitDoRangeAnalysis() != 0);
+        doBranchOpts    = doValueNum && (JitConfig.JitDoRedundantBranchOpts() != 0);
 
         if (opts.optRepeat)
         {
@@ -4820,6 +4865,13 @@ void Compiler::compCompile(void** methodCodePtr, ULONG* methodCodeSize, JitFlags
             }
 #endif // ASSERTION_PROP
 
+            if (doBranchOpts)
+            {
+                /* Fold branches that are implied by dominating compares */
+                optRedundantBranches();
+                EndPhase(PHASE_OPTIMIZE_BRANCHES);
+            }
+
             /* update the flowgraph if we modified it during the optimization phase*/
             if (fgModified)
             {
@@ -4868,6 +4920,10 @@ void Compiler::compCompile(void** methodCodePtr, ULONG* methodCodeSize, JitFlags
     }
 #endif
 
+    // Find the locals that compInitMem doesn't need to zero in the prolog
+    fgMarkDefinitelyAssignedLocals();
+    EndPhase(PHASE_MARK_DEFINITELY_ASSIGNED);
+
     // rationalize trees
     Rationalizer rat(this); // PHASE_RATIONALIZE
     rat.Run();
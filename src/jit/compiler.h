@@ -392,12 +392,16 @@ public:
     unsigned char lvPinned : 1; // is this a pinned variable?
 
     unsigned char lvMustInit : 1;    // must be initialized
+    unsigned char lvDefinitelyAssigned : 1; // every use is preceded by a full definition on all paths, so the
+                                            // prolog doesn't need to zero it for compInitMem
     unsigned char lvAddrExposed : 1; // The address of this variable is "exposed" -- passed as an argument, stored in a
                                      // global location, etc.
                                      // We cannot reason reliably about the value of the variable.
     unsigned char lvDoNotEnregister : 1; // Do not enregister this variable.
     unsigned char lvFieldAccessed : 1;   // The var is a struct local, and a field of the variable is accessed.  Affects
                                          // struct promotion.
+    unsigned char lvIsStackAllocatedObject : 1; // The var is the stack storage of an object allocated by ObjectAllocator.
+                                                // Only such locals of reference class types may be promoted.
 
     unsigned char lvInSsa : 1; // The variable is in SSA form (set by SsaBuilder)
 
@@ -465,6 +469,8 @@ public:
 
     unsigned char lvIsMultiRegArg : 1; // true if this is a multireg LclVar struct used in an argument context
     unsigned char lvIsMultiRegRet : 1; // true if this is a multireg LclVar struct assigned from a multireg call
+    unsigned char lvIsMultiRegRetVal : 1; // true if this is a LclVar struct returned in multiple registers; it
+                                          // is only promoted when its fields line up with the return registers
 
 #ifdef FEATURE_HFA
     HfaElemKind _lvHfaElemKind : 2; // What kind of an HFA this is (HFA_ELEM_NONE if it is not an HFA).
@@ -3345,6 +3351,9 @@ public:
     private:
         bool CanPromoteStructVar(unsigned lclNum);
         bool ShouldPromoteStructVar(unsigned lclNum);
+#if FEATURE_MULTIREG_RET && (defined(UNIX_AMD64_ABI) || defined(_TARGET_ARM64_))
+        bool FieldsMatchReturnRegs();
+#endif
         void PromoteStructVar(unsigned lclNum);
         void SortStructFields();
 
@@ -3497,7 +3506,13 @@ public:
                              CORINFO_CONTEXT_HANDLE* contextHandle,
                              CORINFO_CONTEXT_HANDLE* exactContextHandle,
                              bool                    isLateDevirtualization,
-                             bool                    isExplicitTailCall);
+                             bool                    isExplicitTailCall,
+                             IL_OFFSET               ilOffset);
+
+    bool impTryProfileGuidedDevirtualization(GenTreeCall*           call,
+                                             CORINFO_METHOD_HANDLE  baseMethod,
+                                             CORINFO_CONTEXT_HANDLE ownerType,
+                                             IL_OFFSET              ilOffset);
 
     //=========================================================================
     //                          PROTECTED
@@ -4478,6 +4493,8 @@ public:
 
     void fgInterBlockLocalVarLiveness();
 
+    void fgMarkDefinitelyAssignedLocals();
+
     // The presence of a partial definition presents some difficulties for SSA: this is both a use of some SSA name
     // of "x", and a def of a new SSA name for "x".  The tree only has one local variable for "x", so it has to choose
     // whether to treat that as the use or def.  It chooses the "use", and thus the old SSA name.  This map allows us
@@ -5185,9 +5202,12 @@ protected:
     void fgAdjustForAddressExposedOrWrittenThis();
 
     bool                      fgProfileData_ILSizeMismatch;
-    ICorJitInfo::BlockCounts* fgBlockCounts;
-    UINT32                    fgBlockCountsCount;
-    UINT32                    fgNumProfileRuns;
+    ICorJitInfo::BlockCounts*  fgBlockCounts;
+    UINT32                     fgBlockCountsCount;
+    UINT32                     fgNumProfileRuns;
+    ICorJitInfo::ClassProfile* fgClassProfiles;
+    UINT32                     fgClassProfilesCount;
+    unsigned                   fgClassProbeCount; // class probes fgInstrumentMethod will add
 
     unsigned fgStressBBProf()
     {
@@ -5209,6 +5229,9 @@ protected:
     bool fgHaveProfileData();
     bool fgGetProfileWeightForBasicBlock(IL_OFFSET offset, unsigned* weight);
     void fgInstrumentMethod();
+    void fgInstrumentClassProbes(ICorJitInfo::ClassProfile* classProfiles);
+    void fgAddPatchpoints();
+    CORINFO_CLASS_HANDLE fgGetLikelyClass(IL_OFFSET ilOffset, unsigned* pLikelihood);
 
 public:
     // fgIsUsingProfileWeights - returns true if we have real profile data for this method
@@ -5711,6 +5734,9 @@ private:
     // Add the side effects of "blk" (which is required to be within a loop) to all loops of which it is a part.
     void optComputeLoopSideEffectsOfBlock(BasicBlock* blk);
 
+    // Records the field or array element type written by a GcHeap store with address "addr" in loop "lnum".
+    bool optRecordLoopHeapStore(unsigned lnum, GenTree* addr, unsigned depth = 0);
+
     // Hoist the expression "expr" out of loop "lnum".
     void optPerformHoistExpr(GenTree* expr, unsigned lnum);
 
@@ -5743,6 +5769,11 @@ public:
 
     void optUnrollLoops(); // Unrolls loops (needs to have cost info)
 
+    void optPartiallyUnrollLoops();
+    void optReplaceLoopsWithBlockOps();
+    bool optIsBlockLoopElemAccess(
+        GenTree* tree, unsigned iterVar, GenTree* limit, GenTree** pAddr, unsigned* pArrLcl, ssize_t* pOffset);
+
 protected:
     // This enumeration describes what is killed by a call.
 
@@ -6273,6 +6304,13 @@ public:
     void optVnCopyProp();
     INDEBUG(void optDumpCopyPropStack(LclNumToGenTreePtrStack* curSsaName));
 
+    /**************************************************************************
+    *               Redundant branch optimization
+    *************************************************************************/
+    void optRedundantBranches();
+    bool optRedundantBranch(BasicBlock* const block);
+    bool optReachable(BasicBlock* const fromBlock, BasicBlock* const toBlock, BasicBlock* const excludedBlock);
+
     /**************************************************************************
     *               Early value propagation
     *************************************************************************/
@@ -6341,7 +6379,8 @@ public:
                                              CORINFO_METHOD_HANDLE methodHandle,
                                              CORINFO_CLASS_HANDLE  classHandle,
                                              unsigned              methodAttr,
-                                             unsigned              classAttr);
+                                             unsigned              classAttr,
+                                             bool                  isProfileGuess);
 
     unsigned optMethodFlags;
 
@@ -8191,6 +8230,20 @@ private:
 #endif
     }
 
+#ifdef _TARGET_XARCH_
+    // Upper bound of the size of a CpBlk that codegen unrolls, larger with AVX since it can move 32 bytes at once.
+    unsigned getCpBlkUnrollLimit() const
+    {
+        return compSupports(InstructionSet_AVX) ? CPBLK_AVX_UNROLL_LIMIT : CPBLK_UNROLL_LIMIT;
+    }
+
+    // Upper bound of the size of an InitBlk that codegen unrolls.
+    unsigned getInitBlkUnrollLimit() const
+    {
+        return compSupports(InstructionSet_AVX) ? INITBLK_AVX_UNROLL_LIMIT : INITBLK_UNROLL_LIMIT;
+    }
+#endif // _TARGET_XARCH_
+
     /*
     XXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXX
     XXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXX
@@ -952,6 +952,8 @@ void emitter::emitBegFN(bool hasFramePtr
 #ifdef _TARGET_XARCH_
     emitExitSeqBegLoc.Init();
     emitExitSeqSize = INT_MAX;
+
+    emitAlignPaddingLeft = 0;
 #endif // _TARGET_XARCH_
 
     emitPlaceholderList = emitPlaceholderLast = nullptr;
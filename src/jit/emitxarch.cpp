@@ -214,6 +214,86 @@ bool emitter::AreUpper32BitsZero(regNumber reg)
     return false;
 }
 
+//------------------------------------------------------------------------
+// AreFlagsSetToZeroCmp: check if the previously emitted instruction set the
+//     flags the same way a "test reg, reg" would.
+//
+// Arguments:
+//    reg          - register of interest
+//    opSize       - size of the comparison
+//    onlyZeroFlag - true if only ZF is consumed (an equality comparison)
+//
+// Return Value:
+//    true if the previous instruction wrote reg with a result of the same size
+//    and left the flags as a comparison of reg with 0 would.
+//    false if it did not, or if we can't safely determine.
+//
+// Notes:
+//    Currently only looks back one instruction.
+//
+//    and/or/xor clear OF and CF and set ZF/SF/PF from the result, exactly like test.
+//    Arithmetic instructions set ZF from the result but OF and CF differently, so
+//    they can only be used when the comparison only looks at ZF.
+
+bool emitter::AreFlagsSetToZeroCmp(regNumber reg, emitAttr opSize, bool onlyZeroFlag)
+{
+    // Don't look back across IG boundaries (possible control flow)
+    if (emitCurIGinsCnt == 0)
+    {
+        return false;
+    }
+
+    instrDesc* id  = emitLastIns;
+    insFormat  fmt = id->idInsFmt();
+
+    // Make sure reg is the destination of the instruction
+    switch (fmt)
+    {
+        case IF_RRW:
+        case IF_RWR_CNS:
+        case IF_RRW_CNS:
+        case IF_RWR_RRD:
+        case IF_RRW_RRD:
+        case IF_RWR_MRD:
+        case IF_RRW_MRD:
+        case IF_RWR_SRD:
+        case IF_RRW_SRD:
+        case IF_RWR_ARD:
+        case IF_RRW_ARD:
+            break;
+
+        default:
+            return false;
+    }
+
+    if ((id->idReg1() != reg) || (id->idOpSize() != EA_SIZE(opSize)))
+    {
+        return false;
+    }
+
+    switch (id->idIns())
+    {
+        case INS_and:
+        case INS_or:
+        case INS_xor:
+            return true;
+
+        case INS_add:
+        case INS_sub:
+        case INS_adc:
+        case INS_sbb:
+        case INS_neg:
+        case INS_inc:
+        case INS_inc_l:
+        case INS_dec:
+        case INS_dec_l:
+            return onlyZeroFlag;
+
+        default:
+            return false;
+    }
+}
+
 #ifdef FEATURE_HW_INTRINSICS
 //------------------------------------------------------------------------
 // IsDstSrcImmAvxInstruction: Checks if the instruction has a "reg, reg/mem, imm" or
@@ -2557,17 +2637,45 @@ emitter::instrDesc* emitter::emitNewInstrAmdCns(emitAttr size, ssize_t dsp, int
  *  The next instruction will be a loop head entry point
  *  So insert a dummy instruction here to ensure that
  *  the x86 I-cache alignment rule is followed.
+ *
+ *  alignmentBoundary - the power of 2 boundary to align the loop head to,
+ *                      16 or 32.
+ *  maxLoopSize       - if non-zero, only align the loop if its body is at
+ *                      most this many bytes and the alignment reduces the
+ *                      number of boundary sized chunks the body spans.
  */
 
-void emitter::emitLoopAlign()
+void emitter::emitLoopAlign(unsigned alignmentBoundary, unsigned maxLoopSize)
 {
+    assert((alignmentBoundary == 16) || (alignmentBoundary == 32));
+
+    const unsigned maxSmallCnsLoopSize = (unsigned)ID_MAX_SMALL_CNS >> 6;
+
+    if (maxLoopSize > maxSmallCnsLoopSize)
+    {
+        maxLoopSize = maxSmallCnsLoopSize;
+    }
+
     /* Insert a pseudo-instruction to ensure that we align
        the next instruction properly */
 
     instrDesc* id = emitNewInstrSmall(EA_1BYTE);
     id->idIns(INS_align);
+    id->idSmallCns((maxLoopSize << 6) | alignmentBoundary);
     id->idCodeSize(15); // We may need to skip up to 15 bytes of code
     emitCurIGsize += 15;
+
+    // The size of an instruction is limited to 15 bytes, so padding for a
+    // 32 byte boundary needs a second instruction to reserve the rest of
+    // the space. A zero boundary marks it as a continuation.
+    if (alignmentBoundary > 16)
+    {
+        id = emitNewInstrSmall(EA_1BYTE);
+        id->idIns(INS_align);
+        id->idSmallCns(0);
+        id->idCodeSize(15);
+        emitCurIGsize += 15;
+    }
 }
 
 /*****************************************************************************
@@ -12350,6 +12458,125 @@ BYTE* emitter::emitOutputLJ(BYTE* dst, instrDesc* i)
     return dst;
 }
 
+/*****************************************************************************
+ *
+ *  Output the padding for an INS_align pseudo-instruction, see emitLoopAlign.
+ */
+
+BYTE* emitter::emitOutputAlign(insGroup* ig, instrDesc* id, BYTE* dst)
+{
+    assert(id->idIns() == INS_align);
+
+    unsigned alignmentBoundary = id->idSmallCns() & 0x3F;
+    unsigned maxLoopSize       = id->idSmallCns() >> 6;
+
+    if (alignmentBoundary == 0)
+    {
+        // This continues the previous INS_align, output what didn't fit there.
+        unsigned padding = emitAlignPaddingLeft;
+        assert(padding <= id->idCodeSize());
+
+        emitAlignPaddingLeft = 0;
+        return emitOutputNOP(dst, padding);
+    }
+
+    unsigned padding = (unsigned)(-(ssize_t)(size_t)dst) & (alignmentBoundary - 1);
+
+    if ((padding != 0) && (maxLoopSize != 0) && !emitLoopAlignIsProfitable(ig, dst, alignmentBoundary, maxLoopSize))
+    {
+        padding = 0;
+    }
+
+    // emitLoopAlign reserved 15 bytes for each of the INS_align instructions, that
+    // is 30 bytes for a 32 byte boundary. Leave the loop unaligned if that's not enough.
+    if (padding > (alignmentBoundary - 1) / 15 * 15)
+    {
+        padding = 0;
+    }
+
+    unsigned thisPadding = min(padding, id->idCodeSize());
+
+    if (alignmentBoundary > 16)
+    {
+        emitAlignPaddingLeft = padding - thisPadding;
+    }
+
+    dst = emitOutputNOP(dst, thisPadding);
+    assert((alignmentBoundary != 16) || (maxLoopSize != 0) || (((size_t)dst & 0x0f) == 0));
+    return dst;
+}
+
+/*****************************************************************************
+ *
+ *  Return true if a loop head that follows the INS_align in 'ig' and would
+ *  start at 'dst' should be aligned: the loop has to be closed by a backward
+ *  jump, its code can't be larger than 'maxLoopSize' bytes and aligning it has
+ *  to reduce the number of 'alignmentBoundary' sized chunks it spans.
+ */
+
+bool emitter::emitLoopAlignIsProfitable(insGroup* ig, BYTE* dst, unsigned alignmentBoundary, unsigned maxLoopSize)
+{
+    // The loop head is the first group that isn't an extension of this one.
+    insGroup* loopHeadIG = ig->igNext;
+
+    while ((loopHeadIG != nullptr) && ((loopHeadIG->igFlags & IGF_EXTEND) != 0))
+    {
+        loopHeadIG = loopHeadIG->igNext;
+    }
+
+    if (loopHeadIG == nullptr)
+    {
+        return false;
+    }
+
+    // The end of the loop is the end of the last jump back to its head. The group
+    // offsets aren't final yet, but the estimates are good enough to size the loop.
+    UNATIVE_OFFSET loopEnd = 0;
+
+    for (instrDescJmp* jmp = emitJumpList; jmp != nullptr; jmp = jmp->idjNext)
+    {
+        if ((jmp->idInsFmt() != IF_LABEL) || !jmp->idIsBound() || (jmp->idAddr()->iiaIGlabel != loopHeadIG) ||
+            (jmp->idjIG->igNum < loopHeadIG->igNum))
+        {
+            continue;
+        }
+
+        UNATIVE_OFFSET jmpEnd = jmp->idjIG->igOffs + jmp->idjOffs + jmp->idCodeSize();
+
+        if (jmpEnd > loopEnd)
+        {
+            loopEnd = jmpEnd;
+        }
+    }
+
+    if (loopEnd <= loopHeadIG->igOffs)
+    {
+        JITDUMP("Not aligning IG%02u, no backward jump to it\n", loopHeadIG->igNum);
+        return false;
+    }
+
+    unsigned loopSize = loopEnd - loopHeadIG->igOffs;
+
+    if (loopSize > maxLoopSize)
+    {
+        JITDUMP("Not aligning IG%02u, the loop size %u is larger than %u\n", loopHeadIG->igNum, loopSize, maxLoopSize);
+        return false;
+    }
+
+    unsigned offset          = (unsigned)(size_t)dst & (alignmentBoundary - 1);
+    unsigned alignedChunks   = (loopSize + alignmentBoundary - 1) / alignmentBoundary;
+    unsigned unalignedChunks = (offset + loopSize + alignmentBoundary - 1) / alignmentBoundary;
+
+    if (unalignedChunks == alignedChunks)
+    {
+        JITDUMP("Not aligning IG%02u, the loop spans %u chunks of %u bytes either way\n", loopHeadIG->igNum,
+                alignedChunks, alignmentBoundary);
+        return false;
+    }
+
+    return true;
+}
+
 /*****************************************************************************
  *
  *  Append the machine code corresponding to the given instruction descriptor
@@ -12407,8 +12634,7 @@ size_t emitter::emitOutputInstr(insGroup* ig, instrDesc* id, BYTE** dp)
             if (ins == INS_align)
             {
                 sz  = SMALL_IDSC_SIZE;
-                dst = emitOutputNOP(dst, (-(int)(size_t)dst) & 0x0f);
-                assert(((size_t)dst & 0x0f) == 0);
+                dst = emitOutputAlign(ig, id, dst);
                 break;
             }
 
@@ -64,6 +64,13 @@ BYTE* emitOutputRRR(BYTE* dst, instrDesc* id);
 
 BYTE* emitOutputLJ(BYTE* dst, instrDesc* id);
 
+BYTE* emitOutputAlign(insGroup* ig, instrDesc* id, BYTE* dst);
+bool emitLoopAlignIsProfitable(insGroup* ig, BYTE* dst, unsigned alignmentBoundary, unsigned maxLoopSize);
+
+// Padding of the last INS_align that didn't fit in it, it is written by the
+// continuation INS_align that immediately follows.
+unsigned emitAlignPaddingLeft;
+
 unsigned emitOutputRexOrVexPrefixIfNeeded(instruction ins, BYTE* dst, code_t& code);
 unsigned emitGetRexPrefixSize(instruction ins);
 unsigned emitGetVexPrefixSize(instruction ins, emitAttr attr);
@@ -97,6 +104,8 @@ bool Is4ByteSSEInstruction(instruction ins);
 
 bool AreUpper32BitsZero(regNumber reg);
 
+bool AreFlagsSetToZeroCmp(regNumber reg, emitAttr opSize, bool onlyZeroFlag);
+
 bool hasRexPrefix(code_t code)
 {
 #ifdef _TARGET_AMD64_
@@ -286,7 +295,7 @@ inline emitAttr emitDecodeScale(unsigned ensz)
 /************************************************************************/
 
 public:
-void emitLoopAlign();
+void emitLoopAlign(unsigned alignmentBoundary = 16, unsigned maxLoopSize = 0);
 
 void emitIns(instruction ins);
 
@@ -264,16 +264,30 @@ void Compiler::fgInstrumentMethod()
         countOfBlocks++;
     }
 
-    // Allocate the profile buffer
+    // Allocate the profile buffer, the class profiles go after the block counts
+
+    const unsigned classProfileRecords =
+        fgClassProbeCount * (sizeof(ICorJitInfo::ClassProfile) / sizeof(ICorJitInfo::BlockCounts));
 
     ICorJitInfo::BlockCounts* profileBlockCountsStart;
 
-    HRESULT res = info.compCompHnd->allocMethodBlockCounts(countOfBlocks, &profileBlockCountsStart);
+    HRESULT res =
+        info.compCompHnd->allocMethodBlockCounts(countOfBlocks + classProfileRecords, &profileBlockCountsStart);
 
     Statement* stmt;
 
     if (!SUCCEEDED(res))
     {
+        // The class probe candidates still need to be cleaned up
+        fgInstrumentClassProbes(nullptr);
+
+        // At tier0 the runtime declines to allocate counts for methods it won't
+        // keep profile data for, just leave those uninstrumented
+        if (opts.jitFlags->IsSet(JitFlags::JIT_FLAG_TIER0))
+        {
+            return;
+        }
+
         // The E_NOTIMPL status is returned when we are profiling a generic method from a different assembly
         if (res == E_NOTIMPL)
         {
@@ -336,6 +350,15 @@ void Compiler::fgInstrumentMethod()
         // Check that we allocated and initialized the same number of BlockCounts tuples
         noway_assert(countOfBlocks == 0);
 
+        fgInstrumentClassProbes((ICorJitInfo::ClassProfile*)currentBlockCounts);
+
+        // The method entry callback is only needed for IBC profiling, the counts
+        // collected at tier0 are consumed in process when the method is rejitted
+        if (opts.jitFlags->IsSet(JitFlags::JIT_FLAG_TIER0))
+        {
+            return;
+        }
+
         // Add the method entry callback node
 
         GenTree* arg;
@@ -382,6 +405,298 @@ void Compiler::fgInstrumentMethod()
     fgInsertStmtAtEnd(fgFirstBB, stmt);
 }
 
+//------------------------------------------------------------------------
+// fgInstrumentClassProbes: add class probes to the virtual calls the
+//    importer marked as class profile candidates
+//
+// Arguments:
+//    classProfiles - where the probes record the classes they see, one
+//       ClassProfile per candidate, or nullptr if the method is not being
+//       instrumented after all
+//
+// Notes:
+//    'this' is evaluated into a temp, handed to the class profile helper and
+//    then passed on to the call. Candidates always have their stub address
+//    restored, it shares a union with the candidate info.
+//
+void Compiler::fgInstrumentClassProbes(ICorJitInfo::ClassProfile* classProfiles)
+{
+    if (fgClassProbeCount == 0)
+    {
+        return;
+    }
+
+    class ClassProbeVisitor final : public GenTreeVisitor<ClassProbeVisitor>
+    {
+    public:
+        enum
+        {
+            DoPreOrder = true
+        };
+
+        ClassProbeVisitor(Compiler* compiler, ICorJitInfo::ClassProfile* classProfiles)
+            : GenTreeVisitor<ClassProbeVisitor>(compiler), m_classProfiles(classProfiles), m_probeCount(0)
+        {
+        }
+
+        unsigned GetProbeCount() const
+        {
+            return m_probeCount;
+        }
+
+        Compiler::fgWalkResult PreOrderVisit(GenTree** use, GenTree* user)
+        {
+            GenTree* const node = *use;
+
+            if (!node->IsCall() || !node->AsCall()->IsClassProfileCandidate())
+            {
+                return Compiler::WALK_CONTINUE;
+            }
+
+            GenTreeCall* const               call          = node->AsCall();
+            ClassProfileCandidateInfo* const candidateInfo = call->gtClassProfileCandidateInfo;
+
+            call->gtCallMoreFlags &= ~GTF_CALL_M_CLASS_PROFILE;
+            call->gtStubCallStubAddr = candidateInfo->stubAddr;
+            m_probeCount++;
+
+            if (m_classProfiles == nullptr)
+            {
+                return Compiler::WALK_CONTINUE;
+            }
+
+            assert(candidateInfo->probeIndex < m_compiler->fgClassProbeCount);
+            ICorJitInfo::ClassProfile* const classProfile = &m_classProfiles[candidateInfo->probeIndex];
+            classProfile->ILOffset = candidateInfo->ilOffset | ICorJitInfo::ClassProfile::CLASS_FLAG;
+            assert(classProfile->Count == 0);
+
+            JITDUMP("Adding class probe %u for call [%06u] at IL offset 0x%X\n", candidateInfo->probeIndex,
+                    m_compiler->dspTreeID(call), candidateInfo->ilOffset);
+
+            // COMMA(tmp = this, COMMA(CLASSPROFILE(tmp, profile), tmp))
+            const unsigned tmpNum = m_compiler->lvaGrabTemp(true DEBUGARG("class probe 'this'"));
+            GenTree* const asgNode = m_compiler->gtNewTempAssign(tmpNum, call->gtCallThisArg->GetNode());
+            GenTree* const profileNode = m_compiler->gtNewIconHandleNode((size_t)classProfile, GTF_ICON_BBC_PTR);
+            GenTreeCall::Use* const args =
+                m_compiler->gtNewCallArgs(m_compiler->gtNewLclvNode(tmpNum, TYP_REF), profileNode);
+            GenTree* const helperNode = m_compiler->gtNewHelperCallNode(CORINFO_HELP_CLASSPROFILE, TYP_VOID, args);
+            GenTree* const helperComma =
+                m_compiler->gtNewOperNode(GT_COMMA, TYP_REF, helperNode, m_compiler->gtNewLclvNode(tmpNum, TYP_REF));
+            GenTree* const thisNode = m_compiler->gtNewOperNode(GT_COMMA, TYP_REF, asgNode, helperComma);
+
+            call->gtCallThisArg->SetNode(thisNode);
+            call->gtFlags |= thisNode->gtFlags & GTF_ALL_EFFECT;
+
+            return Compiler::WALK_CONTINUE;
+        }
+
+    private:
+        ICorJitInfo::ClassProfile* m_classProfiles;
+        unsigned                   m_probeCount;
+    };
+
+    // Mark every record as a class profile up front, a candidate that's gone
+    // missing since import then just leaves behind a record nobody looks up
+    if (classProfiles != nullptr)
+    {
+        for (unsigned i = 0; i < fgClassProbeCount; i++)
+        {
+            classProfiles[i].ILOffset = UINT32_MAX;
+        }
+    }
+
+    ClassProbeVisitor visitor(this, classProfiles);
+
+    for (BasicBlock* block = fgFirstBB; block != nullptr; block = block->bbNext)
+    {
+        for (Statement* stmt : block->Statements())
+        {
+            const unsigned probeCountBefore = visitor.GetProbeCount();
+            visitor.WalkTree(stmt->GetRootNodePointer(), nullptr);
+
+            if ((classProfiles != nullptr) && (visitor.GetProbeCount() != probeCountBefore))
+            {
+                gtUpdateStmtSideEffects(stmt);
+            }
+        }
+    }
+
+    JITDUMP("Found %u of %u class probe candidates\n", visitor.GetProbeCount(), fgClassProbeCount);
+}
+
+//------------------------------------------------------------------------
+// fgAddPatchpoints: add patchpoints to the loops of tier0 code
+//
+// Notes:
+//    A method only gets promoted to tier1 after it has been called often
+//    enough, so a method that is called a few times but spends a long time
+//    in a loop would stay at tier0. Each frame gets a counter that every
+//    lexically backward branch decrements. Once it runs out, the patchpoint
+//    helper asks the runtime to promote the method. The frame itself keeps
+//    running the tier0 code, the next call picks up the tier1 code.
+//
+void Compiler::fgAddPatchpoints()
+{
+    assert(opts.jitFlags->IsSet(JitFlags::JIT_FLAG_TIER0));
+    assert(!compIsForInlining());
+
+    if (!compHasBackwardJump || (JitConfig.JitPatchpoints() == 0))
+    {
+        return;
+    }
+
+    const int threshold       = max(JitConfig.JitPatchpointThreshold(), 1);
+    unsigned  counterLclNum   = BAD_VAR_NUM;
+    unsigned  patchpointCount = 0;
+
+    for (BasicBlock* block = fgFirstBB; block != nullptr; block = block->bbNext)
+    {
+        if (!(block->bbFlags & BBF_IMPORTED) || (block->bbFlags & BBF_INTERNAL) || block->hasHndIndex())
+        {
+            continue;
+        }
+
+        bool hasBackwardBranch = false;
+
+        switch (block->bbJumpKind)
+        {
+            case BBJ_COND:
+            case BBJ_ALWAYS:
+                hasBackwardBranch = (block->bbJumpDest->bbCodeOffs <= block->bbCodeOffs);
+                break;
+
+            case BBJ_SWITCH:
+                for (unsigned i = 0; i < block->bbJumpSwt->bbsCount; i++)
+                {
+                    if (block->bbJumpSwt->bbsDstTab[i]->bbCodeOffs <= block->bbCodeOffs)
+                    {
+                        hasBackwardBranch = true;
+                        break;
+                    }
+                }
+                break;
+
+            default:
+                break;
+        }
+
+        if (!hasBackwardBranch)
+        {
+            continue;
+        }
+
+        if (counterLclNum == BAD_VAR_NUM)
+        {
+            counterLclNum                  = lvaGrabTemp(false DEBUGARG("patchpoint counter"));
+            lvaTable[counterLclNum].lvType = TYP_INT;
+        }
+
+        JITDUMP("Adding patchpoint to " FMT_BB "\n", block->bbNum);
+
+        // counter = counter - 1
+        GenTree* decNode = gtNewOperNode(GT_SUB, TYP_INT, gtNewLclvNode(counterLclNum, TYP_INT), gtNewIconNode(1));
+        fgNewStmtNearEnd(block, gtNewTempAssign(counterLclNum, decNode));
+
+        // counter > 0 ? nop : PATCHPOINT(&counter, method)
+        GenTree*          counterAddr = gtNewOperNode(GT_ADDR, TYP_BYREF, gtNewLclvNode(counterLclNum, TYP_INT));
+        GenTreeCall::Use* args        = gtNewCallArgs(counterAddr, gtNewIconEmbMethHndNode(info.compMethodHnd));
+        GenTree*          call        = gtNewHelperCallNode(CORINFO_HELP_PATCHPOINT, TYP_VOID, args);
+        GenTree* relop = gtNewOperNode(GT_GT, TYP_INT, gtNewLclvNode(counterLclNum, TYP_INT), gtNewIconNode(0));
+        GenTree* colon = new (this, GT_COLON) GenTreeColon(TYP_VOID, gtNewNothingNode(), call);
+        fgNewStmtNearEnd(block, gtNewQmarkNode(TYP_VOID, relop, colon));
+
+        patchpointCount++;
+    }
+
+    if (patchpointCount == 0)
+    {
+        return;
+    }
+
+    // counter = threshold, on entry to each frame
+    fgEnsureFirstBBisScratch();
+    fgNewStmtAtEnd(fgFirstBB, gtNewTempAssign(counterLclNum, gtNewIconNode(threshold)));
+
+    JITDUMP("Added %u patchpoints, counter is V%02u\n", patchpointCount, counterLclNum);
+}
+
+//------------------------------------------------------------------------
+// fgGetLikelyClass: find the class most commonly seen by the class probe
+//    at a call site when this method ran at tier0
+//
+// Arguments:
+//    ilOffset - IL offset of the call
+//    pLikelihood - [OUT] percentage of the sampled receivers that were of
+//       the returned class
+//
+// Returns:
+//    The most common class, or NO_CLASS_HANDLE if there is no profile data
+//    for the call site.
+//
+CORINFO_CLASS_HANDLE Compiler::fgGetLikelyClass(IL_OFFSET ilOffset, unsigned* pLikelihood)
+{
+    *pLikelihood = 0;
+
+    if (!fgHaveProfileData() || (fgClassProfiles == nullptr) || (ilOffset == BAD_IL_OFFSET))
+    {
+        return NO_CLASS_HANDLE;
+    }
+
+    const UINT32 profileILOffset = ilOffset | ICorJitInfo::ClassProfile::CLASS_FLAG;
+
+    for (UINT32 i = 0; i < fgClassProfilesCount; i++)
+    {
+        ICorJitInfo::ClassProfile* const classProfile = &fgClassProfiles[i];
+
+        if (classProfile->ILOffset != profileILOffset)
+        {
+            continue;
+        }
+
+        const UINT32 sampleCount = min(classProfile->Count, (UINT32)ICorJitInfo::ClassProfile::SIZE);
+
+        if (sampleCount == 0)
+        {
+            return NO_CLASS_HANDLE;
+        }
+
+        // The table is tiny, just count the matches for each entry. Unknown
+        // entries (collectible classes) are never picked.
+        CORINFO_CLASS_HANDLE likelyClass = NO_CLASS_HANDLE;
+        UINT32               likelyCount = 0;
+
+        for (UINT32 j = 0; j < sampleCount; j++)
+        {
+            CORINFO_CLASS_HANDLE const candidate = classProfile->ClassTable[j];
+
+            if (candidate == NO_CLASS_HANDLE)
+            {
+                continue;
+            }
+
+            UINT32 candidateCount = 0;
+            for (UINT32 k = 0; k < sampleCount; k++)
+            {
+                if (classProfile->ClassTable[k] == candidate)
+                {
+                    candidateCount++;
+                }
+            }
+
+            if (candidateCount > likelyCount)
+            {
+                likelyClass = candidate;
+                likelyCount = candidateCount;
+            }
+        }
+
+        *pLikelihood = (likelyCount * 100) / sampleCount;
+        return likelyClass;
+    }
+
+    return NO_CLASS_HANDLE;
+}
+
 /*****************************************************************************
  *
  *  Create a basic block and append it to the current BB list.
@@ -15051,43 +15366,127 @@ bool Compiler::fgOptimizeBranch(BasicBlock* bJump)
 
 /*****************************************************************************
  *
- *  Function called to optimize switch statements
+ *  Function called to optimize switch statements: when profile data shows that
+ *  most of the executions of a switch go to a single case, test for that case
+ *  ahead of the switch so the common path is a compare and a branch that the
+ *  block layout can turn into a fall through.
  */
 
 bool Compiler::fgOptimizeSwitchJumps()
 {
     bool result = false; // Our return value
 
-#if 0
-    // TODO-CQ: Add switch jump optimizations?
-    if (!fgHasSwitch)
+    // Minimum percentage of the switch block's weight the dominant case needs, 0 disables this.
+    const unsigned minPercent = JitConfig.JitPeelSwitchMinPercent();
+
+    if ((minPercent == 0) || !fgHasSwitch || !fgHaveValidEdgeWeights)
+    {
         return false;
+    }
 
-    if (!fgHaveValidEdgeWeights)
+    // We may need a temp for the switch value.
+    if (lvaLocalVarRefCounted())
+    {
         return false;
+    }
 
-    for (BasicBlock* bSrc = fgFirstBB; bSrc != NULL; bSrc = bSrc->bbNext)
+    for (BasicBlock* bSrc = fgFirstBB; bSrc != nullptr; bSrc = bSrc->bbNext)
     {
-        if (bSrc->bbJumpKind == BBJ_SWITCH)
+        if ((bSrc->bbJumpKind != BBJ_SWITCH) || bSrc->IsLIR() || bSrc->isRunRarely() ||
+            (bSrc->bbWeight == BB_ZERO_WEIGHT))
         {
-            unsigned        jumpCnt; jumpCnt = bSrc->bbJumpSwt->bbsCount;
-            BasicBlock**    jumpTab; jumpTab = bSrc->bbJumpSwt->bbsDstTab;
+            continue;
+        }
 
-            do
+        BBswtDesc*   swtDesc = bSrc->bbJumpSwt;
+        unsigned     jumpCnt = swtDesc->bbsCount;
+        BasicBlock** jumpTab = swtDesc->bbsDstTab;
+
+        // Find the heaviest case that takes at least minPercent of the switch's weight.
+        // Edge weights are per successor, so only cases whose target isn't shared with
+        // another case (including the default) can be peeled.
+        BasicBlock*          bDominant      = nullptr;
+        unsigned             dominantCase   = 0;
+        BasicBlock::weight_t dominantWeight = BB_ZERO_WEIGHT;
+        const unsigned       caseCnt        = swtDesc->bbsHasDefault ? (jumpCnt - 1) : jumpCnt;
+
+        for (unsigned i = 0; i < caseCnt; i++)
+        {
+            BasicBlock* bDst      = jumpTab[i];
+            flowList*   edgeToDst = fgGetPredForBlock(bDst, bSrc);
+
+            if ((edgeToDst->flDupCount == 1) && (edgeToDst->flEdgeWeightMin > dominantWeight) &&
+                (edgeToDst->flEdgeWeightMin <= bSrc->bbWeight) &&
+                ((UINT64)edgeToDst->flEdgeWeightMin * 100 >= (UINT64)bSrc->bbWeight * minPercent))
             {
-                BasicBlock*   bDst       = *jumpTab;
-                flowList*     edgeToDst  = fgGetPredForBlock(bDst, bSrc);
-                double        outRatio   = (double) edgeToDst->flEdgeWeightMin  / (double) bSrc->bbWeight;
+                bDominant      = bDst;
+                dominantCase   = i;
+                dominantWeight = edgeToDst->flEdgeWeightMin;
+            }
+        }
 
-                if (outRatio >= 0.60)
-                {
-                    // straighten switch here...
-                }
+        if (bDominant == nullptr)
+        {
+            continue;
+        }
+
+        Statement* switchStmt = bSrc->lastStmt();
+        GenTree*   switchTree = switchStmt->GetRootNode();
+        noway_assert(switchTree->OperIs(GT_SWITCH));
+
+        GenTree* switchVal = switchTree->gtGetOp1();
+
+        // The switch value is needed twice now, so spill it unless it's an unaliased local.
+        if (!switchVal->OperIs(GT_LCL_VAR) || lvaTable[switchVal->AsLclVar()->GetLclNum()].lvAddrExposed)
+        {
+            const unsigned  tmpNum  = lvaGrabTemp(true DEBUGARG("switch value"));
+            const var_types valType = genActualType(switchVal->TypeGet());
+
+            GenTree* asg = gtNewTempAssign(tmpNum, switchVal);
+            fgInsertStmtBefore(bSrc, switchStmt, fgNewStmtFromTree(asg, bSrc, switchStmt->GetILOffsetX()));
+
+            switchVal                 = gtNewLclvNode(tmpNum, valType);
+            switchTree->AsOp()->gtOp1 = switchVal;
+            gtUpdateStmtSideEffects(switchStmt);
+            if (fgStmtListThreaded)
+            {
+                gtSetStmtInfo(switchStmt);
+                fgSetStmtSeq(switchStmt);
             }
-            while (++jumpTab, --jumpCnt);
         }
+
+        JITDUMP("Peeling dominant case %u of the switch in " FMT_BB " (" FMT_BB ", weight %u of %u)\n", dominantCase,
+                bSrc->bbNum, bDominant->bbNum, dominantWeight, bSrc->bbWeight);
+
+        // Move the switch into a new block that takes all the other cases.
+        BasicBlock* bSwitch = fgSplitBlockAtEnd(bSrc);
+        fgRemoveStmt(bSrc, switchStmt);
+        fgInsertStmtAtEnd(bSwitch, switchStmt);
+        bSwitch->modifyBBWeight(bSrc->bbWeight - dominantWeight);
+
+        // And test for the dominant case in the original block.
+        GenTree* relop = gtNewOperNode(GT_EQ, TYP_INT, gtCloneExpr(switchVal),
+                                       gtNewIconNode(dominantCase, genActualType(switchVal->TypeGet())));
+        relop->gtFlags |= GTF_RELOP_JMP_USED;
+        GenTree* jmpTree = gtNewOperNode(GT_JTRUE, TYP_VOID, relop);
+        fgInsertStmtAtEnd(bSrc, fgNewStmtFromTree(jmpTree, bSrc, switchStmt->GetILOffsetX()));
+
+        bSrc->bbJumpKind = BBJ_COND;
+        bSrc->bbJumpDest = bDominant;
+        flowList* edgeToDominant = fgAddRefPred(bDominant, bSrc);
+
+        // Move the dominant case's weight onto the new edge.
+        flowList* edgeToSwitch            = fgGetPredForBlock(bSwitch, bSrc);
+        flowList* switchToDominant        = fgGetPredForBlock(bDominant, bSwitch);
+        edgeToDominant->flEdgeWeightMin   = dominantWeight;
+        edgeToDominant->flEdgeWeightMax   = dominantWeight;
+        edgeToSwitch->flEdgeWeightMin     = bSwitch->bbWeight;
+        edgeToSwitch->flEdgeWeightMax     = bSwitch->bbWeight;
+        switchToDominant->flEdgeWeightMin = BB_ZERO_WEIGHT;
+        switchToDominant->flEdgeWeightMax = BB_ZERO_WEIGHT;
+
+        result = true;
     }
-#endif
 
     return result;
 }
@@ -15135,9 +15534,6 @@ void Compiler::fgReorderBlocks()
     //
     if (fgIsUsingProfileWeights())
     {
-        //
-        // Note that this is currently not yet implemented
-        //
         optimizedSwitches = fgOptimizeSwitchJumps();
         if (optimizedSwitches)
         {
@@ -22585,7 +22981,7 @@ Compiler::fgWalkResult Compiler::fgLateDevirtualization(GenTree** pTree, fgWalkD
             const bool             isLateDevirtualization = true;
             bool explicitTailCall = (call->AsCall()->gtCallMoreFlags & GTF_CALL_M_EXPLICIT_TAILCALL) != 0;
             comp->impDevirtualizeCall(call, &method, &methodFlags, &context, nullptr, isLateDevirtualization,
-                                      explicitTailCall);
+                                      explicitTailCall, BAD_IL_OFFSET);
         }
     }
     else if (tree->OperGet() == GT_ASG)
@@ -23737,6 +24133,37 @@ void Compiler::fgInlineAppendStatements(InlineInfo* inlineInfo, BasicBlock* bloc
             gtDispStmt(nullStmt);
         }
 #endif // DEBUG
+
+        // If the inlinee body throws, the statement above is skipped. When the call site is
+        // in a try region, the handlers that can catch the exception run in this frame while
+        // the object is still pinned, so unpin it at the start of each of them as well.
+        if (lclVarInfo[argCnt + lclNum].lclIsPinned && inlineInfo->iciBlock->hasTryIndex())
+        {
+            for (unsigned XTnum = 0; XTnum < compHndBBtabCount; XTnum++)
+            {
+                if (!bbInTryRegions(XTnum, inlineInfo->iciBlock))
+                {
+                    continue;
+                }
+
+                BasicBlock* hndBeg    = ehGetDsc(XTnum)->ebdHndBeg;
+                Statement*  firstStmt = hndBeg->FirstNonPhiDef();
+                Statement*  unpinStmt = gtNewStmt(gtNewTempAssign(tmpNum, gtNewZeroConNode(lclTyp)));
+
+                // The catch arg has to be evaluated first. It isn't always spilled to a temp,
+                // so go after whatever statement uses it rather than only after an assignment.
+                if ((firstStmt != nullptr) && gtHasCatchArg(firstStmt->GetRootNode()))
+                {
+                    fgInsertStmtAfter(hndBeg, firstStmt, unpinStmt);
+                }
+                else
+                {
+                    fgInsertStmtAtBeg(hndBeg, unpinStmt);
+                }
+
+                JITDUMP("Unpinning V%02u at the start of handler " FMT_BB "\n", tmpNum, hndBeg->bbNum);
+            }
+        }
     }
 
     // There should not be any GC ref locals left to null out.
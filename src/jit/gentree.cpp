@@ -301,6 +301,9 @@ void GenTree::InitNodeSize()
     static_assert_no_msg(sizeof(GenTreeLclVar)       <= TREE_NODE_SZ_SMALL);
     static_assert_no_msg(sizeof(GenTreeLclFld)       <= TREE_NODE_SZ_SMALL);
     static_assert_no_msg(sizeof(GenTreeCC)           <= TREE_NODE_SZ_SMALL);
+#if defined(_TARGET_XARCH_) || defined(_TARGET_ARM64_)
+    static_assert_no_msg(sizeof(GenTreeOpCC)         <= TREE_NODE_SZ_SMALL);
+#endif
     static_assert_no_msg(sizeof(GenTreeCast)         <= TREE_NODE_SZ_LARGE); // *** large node
     static_assert_no_msg(sizeof(GenTreeBox)          <= TREE_NODE_SZ_LARGE); // *** large node
     static_assert_no_msg(sizeof(GenTreeField)        <= TREE_NODE_SZ_LARGE); // *** large node
@@ -9351,6 +9354,12 @@ void Compiler::gtDispNodeName(GenTree* tree)
     {
         sprintf_s(bufp, sizeof(buf), " %s [+0x%02x]%c", name, tree->AsPutArgStk()->getArgOffset(), 0);
     }
+#if defined(_TARGET_XARCH_) || defined(_TARGET_ARM64_)
+    else if (tree->gtOper == GT_SELECTCC)
+    {
+        sprintf_s(bufp, sizeof(buf), " %s %s%c", name, tree->AsOpCC()->gtCondition.Name(), 0);
+    }
+#endif
     else if (tree->gtOper == GT_CALL)
     {
         const char* callType = "CALL";
@@ -12672,6 +12681,25 @@ GenTree* Compiler::gtFoldExprSpecial(GenTree* tree)
                 }
             }
 
+            // Optimize null checks of static readonly fields; once the class is
+            // initialized the runtime can tell us the field's value is not null,
+            // and it won't change. Flags and singletons are commonly tested this way.
+            if ((val == 0) && (oper != GT_GT) && !opHasSideEffects && op->OperIs(GT_FIELD) && op->TypeIs(TYP_REF) &&
+                (op->AsField()->gtFldObj == nullptr) && ((op->gtFlags & GTF_FLD_VOLATILE) == 0))
+            {
+                bool isExact   = false;
+                bool isNonNull = false;
+                gtGetFieldClassHandle(op->AsField()->gtFldHnd, &isExact, &isNonNull);
+
+                if (isNonNull)
+                {
+                    JITDUMP("\nReplacing static readonly field %s null with %d [%06u]\n", GenTree::OpName(oper),
+                            (oper == GT_NE) ? 1 : 0, dspTreeID(tree));
+
+                    return NewMorphedIntConNode((oper == GT_NE) ? 1 : 0);
+                }
+            }
+
             break;
 
         case GT_ADD:
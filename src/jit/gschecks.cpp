@@ -532,7 +532,8 @@ void Compiler::gsParamsToShadows()
 
             opAssign                            = gtNewCpObjNode(dst, src, clsHnd, false);
             lvaTable[shadowVar].lvIsMultiRegArg = lvaTable[lclNum].lvIsMultiRegArg;
-            lvaTable[shadowVar].lvIsMultiRegRet = lvaTable[lclNum].lvIsMultiRegRet;
+            lvaTable[shadowVar].lvIsMultiRegRet    = lvaTable[lclNum].lvIsMultiRegRet;
+            lvaTable[shadowVar].lvIsMultiRegRetVal = lvaTable[lclNum].lvIsMultiRegRetVal;
         }
         else
         {
@@ -119,6 +119,9 @@ GTSTRUCT_1(HWIntrinsic , GT_HWIntrinsic)
 GTSTRUCT_1(AllocObj    , GT_ALLOCOBJ)
 GTSTRUCT_1(RuntimeLookup, GT_RUNTIMELOOKUP)
 GTSTRUCT_2(CC          , GT_JCC, GT_SETCC)
+#if defined(_TARGET_XARCH_) || defined(_TARGET_ARM64_)
+GTSTRUCT_1(OpCC        , GT_SELECTCC)
+#endif
 #if defined(_TARGET_X86_)
 GTSTRUCT_1(MultiRegOp  , GT_MUL_LONG)
 #elif defined (_TARGET_ARM_)
@@ -6458,7 +6458,12 @@ void Compiler::impCheckForPInvokeCall(
         // Check legality
         if (!impCanPInvokeInlineCallSite(block))
         {
-            return;
+            // The try region restriction exists because of the inlined call frame. Calls that
+            // suppress the GC transition do not link a frame so only the handler restriction applies.
+            if (!call->IsSuppressGCTransition() || block->hasHndIndex())
+            {
+                return;
+            }
         }
 
         // Legal PInvoke CALL in PInvoke IL stubs must be inlined to avoid infinite recursive
@@ -6472,8 +6477,9 @@ void Compiler::impCheckForPInvokeCall(
 
             // Size-speed tradeoff: don't use inline pinvoke at rarely
             // executed call sites.  The non-inline version is more
-            // compact.
-            if (block->isRunRarely())
+            // compact, unless the GC transition is suppressed and the
+            // inline version is just a call.
+            if (block->isRunRarely() && !call->IsSuppressGCTransition())
             {
                 return;
             }
@@ -8252,7 +8258,26 @@ var_types Compiler::impImportCall(OPCODE                  opcode,
             bool       explicitTailCall       = (tailCall & PREFIX_TAILCALL_EXPLICIT) != 0;
             const bool isLateDevirtualization = false;
             impDevirtualizeCall(call->AsCall(), &callInfo->hMethod, &callInfo->methodFlags, &callInfo->contextHandle,
-                                &exactContextHnd, isLateDevirtualization, explicitTailCall);
+                                &exactContextHnd, isLateDevirtualization, explicitTailCall, rawILOffset);
+
+            // If we're instrumenting tier0 code, record the class of 'this'
+            // so tier1 can guess for it. See fgInstrumentClassProbes.
+            if (call->AsCall()->IsVirtual() && (call->AsCall()->gtCallType == CT_USER_FUNC) &&
+                opts.jitFlags->IsSet(JitFlags::JIT_FLAG_BBINSTR) && opts.jitFlags->IsSet(JitFlags::JIT_FLAG_TIER0) &&
+                !compIsForInlining() && (JitConfig.JitClassProfiling() > 0))
+            {
+                JITDUMP("\nimpImportCall: marking [%06u] as a class probe candidate\n", dspTreeID(call));
+
+                ClassProfileCandidateInfo* pInfo = new (this, CMK_Inlining) ClassProfileCandidateInfo;
+                pInfo->ilOffset                  = rawILOffset;
+                pInfo->probeIndex                = fgClassProbeCount++;
+
+                // Save off the stub address since it shares a union with the candidate info.
+                pInfo->stubAddr = call->AsCall()->gtStubCallStubAddr;
+
+                call->AsCall()->gtClassProfileCandidateInfo = pInfo;
+                call->AsCall()->gtCallMoreFlags |= GTF_CALL_M_CLASS_PROFILE;
+            }
         }
 
         if (impIsThis(obj))
@@ -8965,9 +8990,9 @@ GenTree* Compiler::impFixupStructReturnType(GenTree* op, CORINFO_CLASS_HANDLE re
 
         if (op->gtOper == GT_LCL_VAR)
         {
-            // Make sure that this struct stays in memory and doesn't get promoted.
-            unsigned lclNum                  = op->AsLclVarCommon()->GetLclNum();
-            lvaTable[lclNum].lvIsMultiRegRet = true;
+            // This struct is only promoted if its fields can be moved straight into the return registers.
+            unsigned lclNum                     = op->AsLclVarCommon()->GetLclNum();
+            lvaTable[lclNum].lvIsMultiRegRetVal = true;
 
             // TODO-1stClassStructs: Handle constant propagation and CSE-ing of multireg returns.
             op->gtFlags |= GTF_DONT_CSE;
@@ -9032,8 +9057,8 @@ GenTree* Compiler::impFixupStructReturnType(GenTree* op, CORINFO_CLASS_HANDLE re
 
             if (!lvaIsImplicitByRefLocal(lclNum))
             {
-                // Make sure this struct type is not struct promoted
-                lvaTable[lclNum].lvIsMultiRegRet = true;
+                // This struct is only promoted if its fields can be moved straight into the return registers.
+                lvaTable[lclNum].lvIsMultiRegRetVal = true;
 
                 // TODO-1stClassStructs: Handle constant propagation and CSE-ing of multireg returns.
                 op->gtFlags |= GTF_DONT_CSE;
@@ -18257,6 +18282,11 @@ void Compiler::impMakeDiscretionaryInlineObservations(InlineInfo* pInlineInfo, I
 
     inlineResult->NoteInt(InlineObservation::CALLSITE_FREQUENCY, static_cast<int>(frequency));
     inlineResult->NoteInt(InlineObservation::CALLSITE_WEIGHT, static_cast<int>(weight));
+
+    if ((pInlineInfo != nullptr) && pInlineInfo->iciBlock->hasProfileWeight())
+    {
+        inlineResult->Note(InlineObservation::CALLSITE_HAS_PROFILE);
+    }
 }
 
 /*****************************************************************************
@@ -19878,6 +19908,7 @@ bool Compiler::IsMathIntrinsic(GenTree* tree)
 //     exactContextHnd -- [OUT] updated context handle iff call devirtualized
 //     isLateDevirtualization -- if devirtualization is happening after importation
 //     isExplicitTailCalll -- [IN] true if we plan on using an explicit tail call
+//     ilOffset -- IL offset of the call, used to find class profile data
 //
 // Notes:
 //     Virtual calls in IL will always "invoke" the base class method.
@@ -19905,6 +19936,8 @@ bool Compiler::IsMathIntrinsic(GenTree* tree)
 //     When guarded devirtualization is enabled, this method will mark
 //     calls as guarded devirtualization candidates, if the type of `this`
 //     is not exactly known, and there is a plausible guess for the type.
+//     The class most often seen by the tier0 class probe for the call is
+//     preferred over guesses based on the static type.
 
 void Compiler::impDevirtualizeCall(GenTreeCall*            call,
                                    CORINFO_METHOD_HANDLE*  method,
@@ -19912,7 +19945,8 @@ void Compiler::impDevirtualizeCall(GenTreeCall*            call,
                                    CORINFO_CONTEXT_HANDLE* contextHandle,
                                    CORINFO_CONTEXT_HANDLE* exactContextHandle,
                                    bool                    isLateDevirtualization,
-                                   bool                    isExplicitTailCall)
+                                   bool                    isExplicitTailCall,
+                                   IL_OFFSET               ilOffset)
 {
     assert(call != nullptr);
     assert(method != nullptr);
@@ -20088,6 +20122,11 @@ void Compiler::impDevirtualizeCall(GenTreeCall*            call,
             return;
         }
 
+        if (impTryProfileGuidedDevirtualization(call, baseMethod, *contextHandle, ilOffset))
+        {
+            return;
+        }
+
         CORINFO_CLASS_HANDLE uniqueImplementingClass = NO_CLASS_HANDLE;
 
         // info.compCompHnd->getUniqueImplementingClass(objClass);
@@ -20127,7 +20166,7 @@ void Compiler::impDevirtualizeCall(GenTreeCall*            call,
         DWORD uniqueClassAttribs  = info.compCompHnd->getClassAttribs(uniqueImplementingClass);
 
         addGuardedDevirtualizationCandidate(call, uniqueImplementingMethod, uniqueImplementingClass,
-                                            uniqueMethodAttribs, uniqueClassAttribs);
+                                            uniqueMethodAttribs, uniqueClassAttribs, false);
         return;
     }
 
@@ -20194,6 +20233,19 @@ void Compiler::impDevirtualizeCall(GenTreeCall*            call,
     {
         JITDUMP("    Class not final or exact%s\n", isInterface ? "" : ", and method not final");
 
+        // Don't try guarded devirtualiztion when we're doing late devirtualization.
+        if (isLateDevirtualization)
+        {
+            JITDUMP("No guarded devirt during late devirtualization\n");
+            return;
+        }
+
+        // Did the tier0 class probe see a class worth guessing for?
+        if (impTryProfileGuidedDevirtualization(call, baseMethod, ownerType, ilOffset))
+        {
+            return;
+        }
+
         // Have we enabled guarded devirtualization by guessing the jit's best class?
         bool guessJitBestClass = true;
         INDEBUG(guessJitBestClass = (JitConfig.JitGuardedDevirtualizationGuessBestClass() > 0););
@@ -20204,19 +20256,13 @@ void Compiler::impDevirtualizeCall(GenTreeCall*            call,
             return;
         }
 
-        // Don't try guarded devirtualiztion when we're doing late devirtualization.
-        if (isLateDevirtualization)
-        {
-            JITDUMP("No guarded devirt during late devirtualization\n");
-            return;
-        }
-
         // We will use the class that introduced the method as our guess
         // for the runtime class of othe object.
         CORINFO_CLASS_HANDLE derivedClass = info.compCompHnd->getMethodClass(derivedMethod);
 
         // Try guarded devirtualization.
-        addGuardedDevirtualizationCandidate(call, derivedMethod, derivedClass, derivedMethodAttribs, objClassAttribs);
+        addGuardedDevirtualizationCandidate(call, derivedMethod, derivedClass, derivedMethodAttribs, objClassAttribs,
+                                            false);
         return;
     }
 
@@ -20593,6 +20639,68 @@ void Compiler::addFatPointerCandidate(GenTreeCall* call)
     helper.StoreRetExprResultsInArgs(call);
 }
 
+//------------------------------------------------------------------------
+// impTryProfileGuidedDevirtualization: see if the class probe for a virtual
+//    call saw a dominant class, and if so make the call a guarded
+//    devirtualization candidate for that class
+//
+// Arguments:
+//    call - virtual call that could not be devirtualized
+//    baseMethod - method the call invokes in IL
+//    ownerType - context for resolving the virtual method
+//    ilOffset - IL offset of the call
+//
+// Returns:
+//    true if there was a class worth guessing for
+//
+// Notes:
+//    Class profile data only exists for tier1 rejits of methods that were
+//    instrumented at tier0, see fgInstrumentClassProbes.
+//
+bool Compiler::impTryProfileGuidedDevirtualization(GenTreeCall*           call,
+                                                   CORINFO_METHOD_HANDLE  baseMethod,
+                                                   CORINFO_CONTEXT_HANDLE ownerType,
+                                                   IL_OFFSET              ilOffset)
+{
+    unsigned                   likelihood  = 0;
+    const CORINFO_CLASS_HANDLE likelyClass = fgGetLikelyClass(ilOffset, &likelihood);
+
+    if (likelyClass == NO_CLASS_HANDLE)
+    {
+        return false;
+    }
+
+    JITDUMP("Class probe saw %p (%s) for %u%% of the calls\n", dspPtr(likelyClass), eeGetClassName(likelyClass),
+            likelihood);
+
+    if (likelihood < (unsigned)JitConfig.JitGuardedDevirtualizationLikelihood())
+    {
+        JITDUMP("Likely class is not likely enough, sorry\n");
+        return false;
+    }
+
+    // Boxed receivers would need the unboxed entry point, leave them alone
+    const DWORD likelyClassAttribs = info.compCompHnd->getClassAttribs(likelyClass);
+    if ((likelyClassAttribs & CORINFO_FLG_VALUECLASS) != 0)
+    {
+        JITDUMP("Likely class is a value class, sorry\n");
+        return false;
+    }
+
+    CORINFO_METHOD_HANDLE likelyMethod = info.compCompHnd->resolveVirtualMethod(baseMethod, likelyClass, ownerType);
+
+    if (likelyMethod == nullptr)
+    {
+        JITDUMP("Can't figure out which method the likely class would invoke, sorry\n");
+        return false;
+    }
+
+    const DWORD likelyMethodAttribs = info.compCompHnd->getMethodAttribs(likelyMethod);
+    addGuardedDevirtualizationCandidate(call, likelyMethod, likelyClass, likelyMethodAttribs, likelyClassAttribs,
+                                        true);
+    return true;
+}
+
 //------------------------------------------------------------------------
 // addGuardedDevirtualizationCandidate: potentially mark the call as a guarded
 //    devirtualization candidate
@@ -20616,18 +20724,22 @@ void Compiler::addFatPointerCandidate(GenTreeCall* call)
 //    classHandle - class that will be tested for at runtime
 //    methodAttr - attributes of the method
 //    classAttr - attributes of the class
+//    isProfileGuess - true if the class was observed by a class probe
 //
 void Compiler::addGuardedDevirtualizationCandidate(GenTreeCall*          call,
                                                    CORINFO_METHOD_HANDLE methodHandle,
                                                    CORINFO_CLASS_HANDLE  classHandle,
                                                    unsigned              methodAttr,
-                                                   unsigned              classAttr)
+                                                   unsigned              classAttr,
+                                                   bool                  isProfileGuess)
 {
     // This transformation only makes sense for virtual calls
     assert(call->IsVirtual());
 
-    // Only mark calls if the feature is enabled.
-    const bool isEnabled = JitConfig.JitEnableGuardedDevirtualization() > 0;
+    // Only mark calls if the feature is enabled. Guesses backed by profile
+    // data have their own switch, so they can be used without the others.
+    const bool isEnabled = isProfileGuess ? (JitConfig.JitEnableProfileGuidedDevirtualization() > 0)
+                                          : (JitConfig.JitEnableGuardedDevirtualization() > 0);
 
     if (!isEnabled)
     {
@@ -678,7 +678,7 @@ private:
             const bool             isLateDevirtualization = true;
             bool explicitTailCall = (call->AsCall()->gtCallMoreFlags & GTF_CALL_M_EXPLICIT_TAILCALL) != 0;
             compiler->impDevirtualizeCall(call, &methodHnd, &methodFlags, &context, nullptr, isLateDevirtualization,
-                                          explicitTailCall);
+                                          explicitTailCall, BAD_IL_OFFSET);
 
             // Presumably devirt might fail? If so we should try and avoid
             // making this a guarded devirt candidate instead of ending
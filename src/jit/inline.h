@@ -515,6 +515,16 @@ struct GuardedDevirtualizationCandidateInfo
     void*                 stubAddr;
 };
 
+// ClassProfileCandidateInfo provides information about a virtual call
+// site that will get a class probe when the method is instrumented.
+
+struct ClassProfileCandidateInfo
+{
+    IL_OFFSET ilOffset;
+    unsigned  probeIndex;
+    void*     stubAddr;
+};
+
 // InlineCandidateInfo provides basic information about a particular
 // inline candidate.
 //
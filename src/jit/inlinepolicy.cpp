@@ -77,8 +77,11 @@ InlinePolicy* InlinePolicy::GetPolicy(Compiler* compiler, bool isPrejitRoot)
 
 #endif // defined(DEBUG) || defined(INLINE_DATA)
 
-    // Optionally install the ModelPolicy.
-    bool useModelPolicy = JitConfig.JitInlinePolicyModel() != 0;
+    // Optionally install the ModelPolicy, either for all methods or just for tier1 ones.
+    const int  modelPolicyMode = JitConfig.JitInlinePolicyModel();
+    const bool useModelPolicy =
+        (modelPolicyMode == 1) ||
+        ((modelPolicyMode == 2) && compiler->opts.jitFlags->IsSet(JitFlags::JIT_FLAG_TIER1));
 
     if (useModelPolicy)
     {
@@ -415,17 +418,6 @@ void DefaultPolicy::NoteBool(InlineObservation obs, bool value)
                 }
                 break;
 
-            case InlineObservation::CALLEE_HAS_PINNED_LOCALS:
-                if (m_CallsiteIsInTryRegion)
-                {
-                    // Inlining a method with pinned locals in a try
-                    // region requires wrapping the inline body in a
-                    // try/finally to ensure unpinning. Bail instead.
-                    SetFailure(InlineObservation::CALLSITE_PIN_IN_TRY_REGION);
-                    return;
-                }
-                break;
-
             case InlineObservation::CALLEE_HAS_LOCALLOC:
                 // We see this during the IL prescan. Ignore for now, we will
                 // bail out, if necessary, during importation
@@ -1156,6 +1148,7 @@ DiscretionaryPolicy::DiscretionaryPolicy(Compiler* compiler, bool isPrejitRoot)
     , m_CallerHasNewArray(false)
     , m_CallerHasNewObj(false)
     , m_CalleeHasGCStruct(false)
+    , m_CallSiteHasProfile(false)
 {
     // Empty
 }
@@ -1197,6 +1190,10 @@ void DiscretionaryPolicy::NoteBool(InlineObservation obs, bool value)
             // hotness for all candidates. So ignore.
             break;
 
+        case InlineObservation::CALLSITE_HAS_PROFILE:
+            m_CallSiteHasProfile = value;
+            break;
+
         default:
             DefaultPolicy::NoteBool(obs, value);
             break;
@@ -2106,6 +2103,28 @@ void ModelPolicy::DetermineProfitability(CORINFO_METHOD_INFO* methodInfo)
                 break;
         }
 
+        // With profile data, use how often the call site runs per call
+        // to the root method instead. Call sites that never ran only get
+        // size decreasing inlines, hot ones may grow the code more. Both
+        // weights must come from the profile, a call site block whose
+        // weight was estimated can't be compared with the entry count.
+        if (!m_IsPrejitRoot && m_CallSiteHasProfile && m_RootCompiler->fgHaveProfileData() &&
+            m_RootCompiler->fgFirstBB->hasProfileWeight())
+        {
+            const BasicBlock::weight_t entryWeight = m_RootCompiler->fgFirstBB->bbWeight;
+
+            if (m_CallSiteWeight == BB_ZERO_WEIGHT)
+            {
+                callSiteWeight = 0.0;
+            }
+            else if (entryWeight > BB_ZERO_WEIGHT)
+            {
+                const double maxCallSiteWeight = 10.0;
+                callSiteWeight = min((double)m_CallSiteWeight / (double)entryWeight, maxCallSiteWeight);
+                callSiteWeight = max(callSiteWeight, 0.1);
+            }
+        }
+
         // Determine the estimated number of instructions saved per
         // call to the root method per byte of code size impact. This
         // is our benefit figure of merit.
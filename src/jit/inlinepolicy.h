@@ -271,6 +271,7 @@ protected:
     bool        m_CallerHasNewArray;
     bool        m_CallerHasNewObj;
     bool        m_CalleeHasGCStruct;
+    bool        m_CallSiteHasProfile;
 };
 
 // ModelPolicy is an experimental policy that uses the results
@@ -261,6 +261,55 @@ void CodeGen::inst_JMP(emitJumpKind jmp, BasicBlock* tgtBlock)
     GetEmitter()->emitIns_J(emitter::emitJumpKindToIns(jmp), tgtBlock);
 }
 
+#ifdef _TARGET_ARM64_
+/*****************************************************************************
+ *
+ *  Convert a conditional jump kind to the condition of a conditional instruction.
+ */
+
+static insCond JumpKindToInsCond(emitJumpKind condition)
+{
+    switch (condition)
+    {
+        case EJ_eq:
+            return INS_COND_EQ;
+        case EJ_ne:
+            return INS_COND_NE;
+        case EJ_hs:
+            return INS_COND_HS;
+        case EJ_lo:
+            return INS_COND_LO;
+
+        case EJ_mi:
+            return INS_COND_MI;
+        case EJ_pl:
+            return INS_COND_PL;
+        case EJ_vs:
+            return INS_COND_VS;
+        case EJ_vc:
+            return INS_COND_VC;
+
+        case EJ_hi:
+            return INS_COND_HI;
+        case EJ_ls:
+            return INS_COND_LS;
+        case EJ_ge:
+            return INS_COND_GE;
+        case EJ_lt:
+            return INS_COND_LT;
+
+        case EJ_gt:
+            return INS_COND_GT;
+        case EJ_le:
+            return INS_COND_LE;
+
+        default:
+            NO_WAY("unexpected condition type");
+            return INS_COND_EQ;
+    }
+}
+#endif // _TARGET_ARM64_
+
 /*****************************************************************************
  *
  *  Generate a set instruction.
@@ -331,63 +380,37 @@ void CodeGen::inst_SET(emitJumpKind condition, regNumber reg)
     // These instructions only write the low byte of 'reg'
     GetEmitter()->emitIns_R(ins, EA_1BYTE, reg);
 #elif defined(_TARGET_ARM64_)
-    insCond cond;
-    /* Convert the condition to an insCond value */
-    switch (condition)
-    {
-        case EJ_eq:
-            cond = INS_COND_EQ;
-            break;
-        case EJ_ne:
-            cond = INS_COND_NE;
-            break;
-        case EJ_hs:
-            cond = INS_COND_HS;
-            break;
-        case EJ_lo:
-            cond = INS_COND_LO;
-            break;
+    GetEmitter()->emitIns_R_COND(INS_cset, EA_8BYTE, reg, JumpKindToInsCond(condition));
+#else
+    NYI("inst_SET");
+#endif
+}
 
-        case EJ_mi:
-            cond = INS_COND_MI;
-            break;
-        case EJ_pl:
-            cond = INS_COND_PL;
-            break;
-        case EJ_vs:
-            cond = INS_COND_VS;
-            break;
-        case EJ_vc:
-            cond = INS_COND_VC;
-            break;
+/*****************************************************************************
+ *
+ *  Generate a conditional select: dstReg = (condition) ? trueReg : falseReg
+ */
 
-        case EJ_hi:
-            cond = INS_COND_HI;
-            break;
-        case EJ_ls:
-            cond = INS_COND_LS;
-            break;
-        case EJ_ge:
-            cond = INS_COND_GE;
-            break;
-        case EJ_lt:
-            cond = INS_COND_LT;
-            break;
+void CodeGen::inst_SEL(emitJumpKind condition, emitAttr size, regNumber dstReg, regNumber trueReg, regNumber falseReg)
+{
+#ifdef _TARGET_XARCH_
+    // There's no three operand form, "falseReg" is conditionally moved over "trueReg".
+    noway_assert((dstReg != falseReg) || (trueReg == falseReg));
 
-        case EJ_gt:
-            cond = INS_COND_GT;
-            break;
-        case EJ_le:
-            cond = INS_COND_LE;
-            break;
+    static_assert_no_msg((INS_cmovg - INS_cmovo) == (INS_jg - INS_jo));
+    instruction jmpIns = emitter::emitJumpKindToIns(emitter::emitReverseJumpKind(condition));
+    assert((jmpIns >= INS_jo) && (jmpIns <= INS_jg));
+    instruction ins = (instruction)(INS_cmovo + (jmpIns - INS_jo));
 
-        default:
-            NO_WAY("unexpected condition type");
-            return;
+    if (dstReg != trueReg)
+    {
+        GetEmitter()->emitIns_R_R(INS_mov, size, dstReg, trueReg);
     }
-    GetEmitter()->emitIns_R_COND(INS_cset, EA_8BYTE, reg, cond);
+    GetEmitter()->emitIns_R_R(ins, size, dstReg, falseReg);
+#elif defined(_TARGET_ARM64_)
+    GetEmitter()->emitIns_R_R_R_COND(INS_csel, size, dstReg, trueReg, falseReg, JumpKindToInsCond(condition));
 #else
-    NYI("inst_SET");
+    NYI("inst_SEL");
 #endif
 }
 
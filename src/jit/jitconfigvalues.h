@@ -65,10 +65,12 @@ CONFIG_INTEGER(JitHashBreak, W("JitHashBreak"), -1)        // Same as JitBreak,
 CONFIG_INTEGER(JitHashDump, W("JitHashDump"), -1)          // Same as JitDump, but for a method hash
 CONFIG_INTEGER(JitHashDumpIR, W("JitHashDumpIR"), -1)      // Same as JitDumpIR, but for a method hash
 CONFIG_INTEGER(JitHashHalt, W("JitHashHalt"), -1)          // Same as JitHalt, but for a method hash
+CONFIG_INTEGER(JitIfConversion, W("JitIfConversion"), 1)   // If 0, don't replace branches with conditional selects
 CONFIG_INTEGER(JitInlineAdditionalMultiplier, W("JitInlineAdditionalMultiplier"), 0)
 CONFIG_INTEGER(JitInlinePrintStats, W("JitInlinePrintStats"), 0)
 CONFIG_INTEGER(JitInlineSize, W("JITInlineSize"), DEFAULT_MAX_INLINE_SIZE)
 CONFIG_INTEGER(JitInlineDepth, W("JITInlineDepth"), DEFAULT_MAX_INLINE_DEPTH)
+CONFIG_INTEGER(JitLoopBlockOps, W("JitLoopBlockOps"), 1) // If 0, don't replace array fill and copy loops by block ops
 CONFIG_INTEGER(JitLongAddress, W("JitLongAddress"), 0) // Force using the large pseudo instruction form for long address
 CONFIG_INTEGER(JitMaxTempAssert, W("JITMaxTempAssert"), 1)
 CONFIG_INTEGER(JitMaxUncheckedOffset, W("JitMaxUncheckedOffset"), 8)
@@ -188,6 +190,7 @@ CONFIG_STRING(JitDumpIRFormat, W("JitDumpIRFormat")) // Comma separated format c
 CONFIG_STRING(JitDumpIRPhase, W("JitDumpIRPhase"))   // Phase control for JitDumpIR, values = {* | phasename}
 CONFIG_STRING(JitLateDisasmTo, W("JITLateDisasmTo"))
 CONFIG_STRING(JitRange, W("JitRange"))
+CONFIG_STRING(JitReplayCSE, W("JitReplayCSE")) // Comma separated list of CSE numbers to promote, rejects all others
 CONFIG_STRING(JitStressModeNames, W("JitStressModeNames")) // Internal Jit stress mode: stress using the given set of
                                                            // stress mode names, e.g. STRESS_REGS, STRESS_TAILCALL
 CONFIG_STRING(JitStressModeNamesNot, W("JitStressModeNamesNot")) // Internal Jit stress mode: do NOT stress using the
@@ -312,6 +315,26 @@ CONFIG_INTEGER(JitMinOptsTrackGCrefs, W("JitMinOptsTrackGCrefs"), JitMinOptsTrac
 CONFIG_INTEGER(DisplayMemStats, W("JitMemStats"), 0) // Display JIT memory usage statistics
 
 CONFIG_INTEGER(JitAggressiveInlining, W("JitAggressiveInlining"), 0) // Aggressive inlining of all methods
+
+// Alignment of hot loop heads, see emitter::emitLoopAlign.
+CONFIG_INTEGER(JitAlignHotLoops, W("JitAlignHotLoops"), 0)           // If set, align the heads of hot small loops
+CONFIG_INTEGER(JitAlignLoopBoundary, W("JitAlignLoopBoundary"), 32)  // Boundary to align loop heads to, 16 or 32
+CONFIG_INTEGER(JitAlignLoopMinBlockWeight, W("JitAlignLoopMinBlockWeight"), 8) // Minimum loop head weight, in
+                                                                               // multiples of BB_UNITY_WEIGHT
+CONFIG_INTEGER(JitAlignLoopMaxCodeSize, W("JitAlignLoopMaxCodeSize"), 96) // Don't align loops larger than this
+
+// Peeling of the dominant case of switches, see Compiler::fgOptimizeSwitchJumps.
+CONFIG_INTEGER(JitPeelSwitchMinPercent, W("JitPeelSwitchMinPercent"), 55) // Minimum percentage of the switch block
+                                                                           // weight a case needs to get peeled, 0
+                                                                           // disables peeling
+
+CONFIG_INTEGER(JitPartialUnrollLoops, W("JitPartialUnrollLoops"), 0) // Partially unroll single block loops whose
+                                                                     // trip count isn't constant
+
+CONFIG_INTEGER(JitElideNewObjWriteBarriers, W("JitElideNewObjWriteBarriers"), 1) // Elide write barriers for stores
+                                                                                 // into just allocated objects, only
+                                                                                 // done without concurrent GC
+
 CONFIG_INTEGER(JitELTHookEnabled, W("JitELTHookEnabled"), 0)         // If 1, emit Enter/Leave/TailCall callbacks
 CONFIG_INTEGER(JitInlineSIMDMultiplier, W("JitInlineSIMDMultiplier"), 3)
 
@@ -325,6 +348,7 @@ CONFIG_INTEGER(JitDoCopyProp, W("JitDoCopyProp"), 1)   // Perform copy propagati
 CONFIG_INTEGER(JitDoEarlyProp, W("JitDoEarlyProp"), 1) // Perform Early Value Propagation
 CONFIG_INTEGER(JitDoLoopHoisting, W("JitDoLoopHoisting"), 1)   // Perform loop hoisting on loop invariant values
 CONFIG_INTEGER(JitDoRangeAnalysis, W("JitDoRangeAnalysis"), 1) // Perform range check analysis
+CONFIG_INTEGER(JitDoRedundantBranchOpts, W("JitDoRedundantBranchOpts"), 1) // Fold branches implied by dominating ones
 CONFIG_INTEGER(JitDoSsa, W("JitDoSsa"), 1) // Perform Static Single Assignment (SSA) numbering on the variables
 CONFIG_INTEGER(JitDoValueNumber, W("JitDoValueNumber"), 1) // Perform value numbering on method expressions
 
@@ -377,6 +401,8 @@ CONFIG_STRING(JitNoInlineRange, W("JitNoInlineRange"))
 CONFIG_STRING(JitInlineReplayFile, W("JitInlineReplayFile"))
 #endif // defined(DEBUG) || defined(INLINE_DATA)
 
+// ModelPolicy selection: 0 = use the DefaultPolicy, 1 = use the ModelPolicy for all methods,
+// 2 = use the ModelPolicy only for tier1 methods.
 CONFIG_INTEGER(JitInlinePolicyModel, W("JitInlinePolicyModel"), 0)
 CONFIG_INTEGER(JitObjectStackAllocation, W("JitObjectStackAllocation"), 0)
 
@@ -395,6 +421,22 @@ CONFIG_INTEGER(JitEnableRemoveEmptyTry, W("JitEnableRemoveEmptyTry"), 0)
 // Overall master enable for Guarded Devirtualization. Currently not enabled by default.
 CONFIG_INTEGER(JitEnableGuardedDevirtualization, W("JitEnableGuardedDevirtualization"), 0)
 
+// Guarded Devirtualization for classes observed by tier0 class probes. Only has an
+// effect when the runtime supplies profile data.
+CONFIG_INTEGER(JitEnableProfileGuidedDevirtualization, W("JitEnableProfileGuidedDevirtualization"), 1)
+
+// Patchpoints in the loops of tier0 code, the method is promoted to tier1 once a
+// single frame has taken JitPatchpointThreshold backward branches. Currently not enabled by default.
+CONFIG_INTEGER(JitPatchpoints, W("JitPatchpoints"), 0)
+CONFIG_INTEGER(JitPatchpointThreshold, W("JitPatchpointThreshold"), 1000)
+
+// Add class probes to virtual calls in instrumented tier0 code
+CONFIG_INTEGER(JitClassProfiling, W("JitClassProfiling"), 1)
+
+// Percentage of the sampled receivers that the most common class needs to make up
+// before it is worth guessing for
+CONFIG_INTEGER(JitGuardedDevirtualizationLikelihood, W("JitGuardedDevirtualizationLikelihood"), 50)
+
 #if defined(DEBUG)
 // Various policies for GuardedDevirtualization
 CONFIG_INTEGER(JitGuardedDevirtualizationGuessUniqueInterface, W("JitGuardedDevirtualizationGuessUniqueInterface"), 1)
@@ -39,7 +39,7 @@ public:
 
     #endif // !defined(_TARGET_X86_)
 
-        JIT_FLAG_UNUSED6                 = 13,
+        JIT_FLAG_NO_CONCURRENT_GC        = 13, // The GC never runs a background GC, so it doesn't use the write watch
 
     #if defined(_TARGET_X86_) || defined(_TARGET_AMD64_)
 
@@ -246,6 +246,8 @@ public:
 
 #endif
 
+        FLAGS_EQUAL(CORJIT_FLAGS::CORJIT_FLAG_NO_CONCURRENT_GC, JIT_FLAG_NO_CONCURRENT_GC);
+
 #if defined(_TARGET_X86_) || defined(_TARGET_AMD64_)
 
         FLAGS_EQUAL(CORJIT_FLAGS::CORJIT_FLAG_USE_AVX, JIT_FLAG_USE_AVX);
@@ -1608,12 +1608,6 @@ void Compiler::StructPromotionHelper::CheckRetypedAsScalar(CORINFO_FIELD_HANDLE
 //
 bool Compiler::StructPromotionHelper::CanPromoteStructType(CORINFO_CLASS_HANDLE typeHnd)
 {
-    if (!compiler->eeIsValueClass(typeHnd))
-    {
-        // TODO-ObjectStackAllocation: Enable promotion of fields of stack-allocated objects.
-        return false;
-    }
-
     if (structPromotionInfo.typeHnd == typeHnd)
     {
         // Asking for the same type of struct as the last time.
@@ -1649,7 +1643,10 @@ bool Compiler::StructPromotionHelper::CanPromoteStructType(CORINFO_CLASS_HANDLE
 
     COMP_HANDLE compHandle = compiler->info.compCompHnd;
 
-    unsigned structSize = compHandle->getClassSize(typeHnd);
+    // Reference class types only get here for stack-allocated objects (see CanPromoteStructVar).
+    // Their field offsets include the method table pointer, which becomes a hole in the promoted struct.
+    unsigned structSize = compiler->eeIsValueClass(typeHnd) ? compHandle->getClassSize(typeHnd)
+                                                            : compHandle->getHeapClassSize(typeHnd);
     if (structSize > MaxOffset)
     {
         return false; // struct is too large
@@ -1829,6 +1826,13 @@ bool Compiler::StructPromotionHelper::CanPromoteStructVar(unsigned lclNum)
     }
 
     CORINFO_CLASS_HANDLE typeHnd = varDsc->lvVerTypeInfo.GetClassHandle();
+
+    if (!varDsc->lvIsStackAllocatedObject && !compiler->eeIsValueClass(typeHnd))
+    {
+        JITDUMP("  struct promotion of V%02u is disabled because it has a reference class type\n", lclNum);
+        return false;
+    }
+
     return CanPromoteStructType(typeHnd);
 }
 
@@ -1923,6 +1927,18 @@ bool Compiler::StructPromotionHelper::ShouldPromoteStructVar(unsigned lclNum)
         }
     }
 
+#if FEATURE_MULTIREG_RET && (defined(UNIX_AMD64_ABI) || defined(_TARGET_ARM64_))
+    // A struct returned in multiple registers is returned field by field once it is promoted,
+    // which needs one field per return register.
+    if (shouldPromote && varDsc->lvIsMultiRegRetVal && (varTypeIsSIMD(varDsc) || !FieldsMatchReturnRegs()))
+    {
+        JITDUMP("Not promoting multireg returned struct local V%02u, because its fields don't match the return "
+                "registers.\n",
+                lclNum);
+        shouldPromote = false;
+    }
+#endif // FEATURE_MULTIREG_RET && (UNIX_AMD64_ABI || _TARGET_ARM64_)
+
     //
     // If the lvRefCnt is zero and we have a struct promoted parameter we can end up with an extra store of
     // the the incoming register into the stack frame slot.
@@ -1934,6 +1950,63 @@ bool Compiler::StructPromotionHelper::ShouldPromoteStructVar(unsigned lclNum)
     return shouldPromote;
 }
 
+#if FEATURE_MULTIREG_RET && (defined(UNIX_AMD64_ABI) || defined(_TARGET_ARM64_))
+//--------------------------------------------------------------------------------------------
+// FieldsMatchReturnRegs - check if the fields of the struct being promoted can be moved straight
+//   into the registers the struct is returned in.
+//
+// Return value:
+//   true if there is one field at the start of each return register and every field fits in
+//   its register, in which case Lowering returns the promoted struct as a GT_FIELD_LIST.
+//
+bool Compiler::StructPromotionHelper::FieldsMatchReturnRegs()
+{
+    ReturnTypeDesc retTypeDesc;
+    retTypeDesc.InitializeStructReturnType(compiler, structPromotionInfo.typeHnd);
+    unsigned regCount = retTypeDesc.GetReturnRegCount();
+
+    if (structPromotionInfo.fieldCnt != regCount)
+    {
+        return false;
+    }
+
+    if (!structPromotionInfo.fieldsSorted)
+    {
+        SortStructFields();
+    }
+
+    // This is the same layout genStructReturn uses to load an unpromoted struct.
+    unsigned regOffset = 0;
+    for (unsigned i = 0; i < regCount; i++)
+    {
+        const lvaStructFieldInfo& fieldInfo = structPromotionInfo.fields[i];
+        var_types                 regType   = retTypeDesc.GetReturnRegType(i);
+
+        if ((fieldInfo.fldOffset != regOffset) || varTypeIsStruct(fieldInfo.fldType))
+        {
+            return false;
+        }
+
+        if ((varTypeUsesFloatReg(fieldInfo.fldType) != varTypeUsesFloatReg(regType)) ||
+            (varTypeIsGC(fieldInfo.fldType) != varTypeIsGC(regType)))
+        {
+            return false;
+        }
+
+        // Small integer fields can go in a wider register, the bits above them are padding.
+        if (varTypeIsFloating(regType) ? (fieldInfo.fldType != regType)
+                                       : (genTypeSize(fieldInfo.fldType) > genTypeSize(regType)))
+        {
+            return false;
+        }
+
+        regOffset += genTypeSize(regType);
+    }
+
+    return true;
+}
+#endif // FEATURE_MULTIREG_RET && (UNIX_AMD64_ABI || _TARGET_ARM64_)
+
 //--------------------------------------------------------------------------------------------
 // SortStructFields - sort the fields according to the increasing order of the field offset.
 //
@@ -2656,3 +2656,166 @@ void Compiler::fgDispBBLiveness()
 }
 
 #endif // DEBUG
+
+//------------------------------------------------------------------------
+// fgMarkDefinitelyAssignedLocals: Find the IL locals that are fully defined
+//    on every path before they are used and mark them lvDefinitelyAssigned.
+//
+// Notes:
+//    With compInitMem codegen zeroes untracked and struct locals in the prolog
+//    even when liveness shows they are not live on entry, see genCheckUseBlockInit.
+//    For locals without GC pointers that zeroing is only observable by a use
+//    that isn't preceded by a full definition, which this forward "must be
+//    defined" dataflow rules out. Locals with GC pointers are still zeroed as
+//    their stack slots may be reported before they are defined.
+//
+//    A full definition is an assignment to the entire local. Every other
+//    reference, including partial definitions and taking the address, is
+//    treated as a use. Nothing is considered defined on entry to a handler.
+//
+void Compiler::fgMarkDefinitelyAssignedLocals()
+{
+    if (!info.compInitMem || opts.OptimizationDisabled() || opts.compDbgCode)
+    {
+        return;
+    }
+
+    assert(fgComputePredsDone);
+
+    // Number the candidates, these are the locals that genCheckUseBlockInit
+    // would zero only because of compInitMem.
+    unsigned* candidateIndex = new (this, CMK_Generic) unsigned[info.compLocalsCount];
+    unsigned  candidateCount = 0;
+
+    for (unsigned lclNum = 0; lclNum < info.compLocalsCount; lclNum++)
+    {
+        LclVarDsc* varDsc = lvaGetDesc(lclNum);
+
+        varDsc->lvDefinitelyAssigned = false;
+
+        if (varDsc->lvIsParam || varDsc->lvMustInit || varDsc->lvPromoted || varDsc->HasGCPtr() ||
+            (varDsc->lvTracked && (varDsc->lvType != TYP_STRUCT)))
+        {
+            candidateIndex[lclNum] = UINT_MAX;
+        }
+        else
+        {
+            candidateIndex[lclNum] = candidateCount++;
+        }
+    }
+
+    if (candidateCount == 0)
+    {
+        return;
+    }
+
+    BitVecTraits traits(candidateCount, this);
+
+    auto getCandidate = [&](GenTree* node) -> unsigned {
+        unsigned lclNum = node->AsLclVarCommon()->GetLclNum();
+        return (lclNum < info.compLocalsCount) ? candidateIndex[lclNum] : UINT_MAX;
+    };
+
+    // Visits the nodes of the block in execution order. Full definitions are
+    // added to "defined" and uses of candidates that aren't in "defined" are
+    // added to "needsInit", if that isn't null.
+    auto visitBlock = [&](BasicBlock* block, BitVec& defined, BitVec* needsInit) {
+        for (Statement* stmt : block->Statements())
+        {
+            for (GenTree* node = stmt->GetTreeList(); node != nullptr; node = node->gtNext)
+            {
+                if (node->OperIs(GT_ASG))
+                {
+                    GenTree* dst = node->AsOp()->gtGetOp1();
+                    if (dst->OperIs(GT_LCL_VAR) &&
+                        (genActualType(dst->TypeGet()) == genActualType(lvaGetDesc(dst->AsLclVarCommon())->TypeGet())))
+                    {
+                        unsigned index = getCandidate(dst);
+                        if (index != UINT_MAX)
+                        {
+                            BitVecOps::AddElemD(&traits, defined, index);
+                        }
+                    }
+                }
+                else if ((node->OperIsLocal() || node->OperIsLocalAddr()) && (needsInit != nullptr))
+                {
+                    // The destination of a full definition is handled by its GT_ASG.
+                    if (node->OperIs(GT_LCL_VAR) && ((node->gtFlags & GTF_VAR_DEF) != 0))
+                    {
+                        continue;
+                    }
+
+                    unsigned index = getCandidate(node);
+                    if ((index != UINT_MAX) && !BitVecOps::IsMember(&traits, defined, index))
+                    {
+                        BitVecOps::AddElemD(&traits, *needsInit, index);
+                    }
+                }
+            }
+        }
+    };
+
+    BitVec* blockIn  = new (this, CMK_Generic) BitVec[fgBBNumMax + 1];
+    BitVec* blockOut = new (this, CMK_Generic) BitVec[fgBBNumMax + 1];
+    BitVec* blockGen = new (this, CMK_Generic) BitVec[fgBBNumMax + 1];
+
+    for (BasicBlock* block = fgFirstBB; block != nullptr; block = block->bbNext)
+    {
+        blockGen[block->bbNum] = BitVecOps::MakeEmpty(&traits);
+        visitBlock(block, blockGen[block->bbNum], nullptr);
+
+        blockIn[block->bbNum]  = BitVecOps::MakeEmpty(&traits);
+        blockOut[block->bbNum] = BitVecOps::MakeFull(&traits);
+    }
+
+    // Iterate to a fixed point. The out sets start out full and only shrink.
+    bool changed;
+    do
+    {
+        changed = false;
+
+        for (BasicBlock* block = fgFirstBB; block != nullptr; block = block->bbNext)
+        {
+            BitVec& in = blockIn[block->bbNum];
+
+            if ((block == fgFirstBB) || bbIsHandlerBeg(block))
+            {
+                BitVecOps::ClearD(&traits, in);
+            }
+            else
+            {
+                BitVecOps::AssignNoCopy(&traits, in, BitVecOps::MakeFull(&traits));
+
+                for (flowList* pred = block->bbPreds; pred != nullptr; pred = pred->flNext)
+                {
+                    BitVecOps::IntersectionD(&traits, in, blockOut[pred->flBlock->bbNum]);
+                }
+            }
+
+            BitVec out = BitVecOps::Union(&traits, in, blockGen[block->bbNum]);
+            if (!BitVecOps::Equal(&traits, out, blockOut[block->bbNum]))
+            {
+                BitVecOps::AssignNoCopy(&traits, blockOut[block->bbNum], out);
+                changed = true;
+            }
+        }
+    } while (changed);
+
+    BitVec needsInit = BitVecOps::MakeEmpty(&traits);
+
+    for (BasicBlock* block = fgFirstBB; block != nullptr; block = block->bbNext)
+    {
+        BitVec defined = BitVecOps::MakeCopy(&traits, blockIn[block->bbNum]);
+        visitBlock(block, defined, &needsInit);
+    }
+
+    for (unsigned lclNum = 0; lclNum < info.compLocalsCount; lclNum++)
+    {
+        unsigned index = candidateIndex[lclNum];
+        if ((index != UINT_MAX) && !BitVecOps::IsMember(&traits, needsInit, index))
+        {
+            JITDUMP("V%02u is definitely assigned before use, it doesn't need prolog zeroing\n", lclNum);
+            lvaGetDesc(lclNum)->lvDefinitelyAssigned = true;
+        }
+    }
+}
@@ -2906,6 +2906,14 @@ GenTree* Lowering::LowerCompare(GenTree* cmp)
 //
 GenTree* Lowering::LowerJTrue(GenTreeOp* jtrue)
 {
+#if defined(_TARGET_XARCH_) || defined(_TARGET_ARM64_)
+    GenTree* select = LowerJTrueToSelect(jtrue);
+    if (select != nullptr)
+    {
+        return select;
+    }
+#endif
+
 #ifdef _TARGET_ARM64_
     GenTree* relop    = jtrue->gtGetOp1();
     GenTree* relopOp2 = relop->AsOp()->gtGetOp2();
@@ -2951,6 +2959,160 @@ GenTree* Lowering::LowerJTrue(GenTreeOp* jtrue)
     return nullptr;
 }
 
+#if defined(_TARGET_XARCH_) || defined(_TARGET_ARM64_)
+//------------------------------------------------------------------------
+// Lowering::LowerJTrueToSelect: Replaces a conditional branch around a single
+//    local store with a conditional select, if possible.
+//
+// Arguments:
+//    jtrue - the JTRUE node that ends the current block
+//
+// Return Value:
+//    The next node to lower if the branch was replaced, nullptr otherwise.
+//
+// Notes:
+//    Looks for
+//
+//         block:  if (cond) goto join;
+//        middle:  lcl = value;
+//          join:  ...
+//
+//    where "value" is a local or a constant and "middle" is only reached from
+//    "block", and turns it into
+//
+//         block:  CMP; lcl = SELECTCC<cond>(lcl, value);
+//        middle:  (empty)
+//
+//    The operands of the select are moved ahead of the compare so nothing
+//    can change the flags between the compare and the select.
+//
+//    Data dependent branches tend to be mispredicted, while cmov/csel costs
+//    about as much as a well predicted branch. If profile data shows that the
+//    branch is biased, it is left alone.
+//
+GenTree* Lowering::LowerJTrueToSelect(GenTreeOp* jtrue)
+{
+    if (comp->opts.OptimizationDisabled())
+    {
+        return nullptr;
+    }
+
+#ifdef _TARGET_XARCH_
+    if (!comp->opts.compUseCMOV)
+    {
+        return nullptr;
+    }
+#endif
+
+#ifdef DEBUG
+    if (JitConfig.JitIfConversion() == 0)
+    {
+        return nullptr;
+    }
+#endif
+
+    // Only integer compares can be turned into a CMP followed by a single flags check.
+    GenTree* relop = jtrue->gtGetOp1();
+    if ((relop->gtNext != jtrue) || !relop->OperIs(GT_EQ, GT_NE, GT_LT, GT_LE, GT_GE, GT_GT) ||
+        varTypeIsFloating(relop->gtGetOp1()))
+    {
+        return nullptr;
+    }
+
+    BasicBlock* block  = m_block;
+    BasicBlock* middle = block->bbNext;
+    BasicBlock* join   = block->bbJumpDest;
+    assert(block->bbJumpKind == BBJ_COND);
+
+    if ((middle == nullptr) || (middle == join) || (middle->bbJumpKind != BBJ_NONE) || (middle->bbNext != join) ||
+        (middle->bbRefs != 1) || !BasicBlock::sameEHRegion(block, middle) ||
+        comp->fgInDifferentRegions(block, middle))
+    {
+        return nullptr;
+    }
+
+    if (block->hasProfileWeight() && middle->hasProfileWeight() && (block->bbWeight != BB_ZERO_WEIGHT))
+    {
+        const double ratio = (double)middle->bbWeight / (double)block->bbWeight;
+        if ((ratio < 0.1) || (ratio > 0.9))
+        {
+            return nullptr;
+        }
+    }
+
+    LIR::Range& middleRange = LIR::AsRange(middle);
+    GenTree*    store       = middleRange.LastNode();
+    if ((store == nullptr) || !store->OperIs(GT_STORE_LCL_VAR))
+    {
+        return nullptr;
+    }
+
+    GenTree*   value  = store->gtGetOp1();
+    LclVarDsc* varDsc = comp->lvaGetDesc(store->AsLclVarCommon());
+
+    // GC pointers are left alone since the select reads the local even when
+    // it wasn't read before, small locals would need to be normalized.
+    if (!varTypeIsIntOrI(store) || (varDsc->TypeGet() != store->TypeGet()) || varDsc->lvAddrExposed ||
+        (value->gtNext != store) || (genActualType(value) != store->TypeGet()))
+    {
+        return nullptr;
+    }
+
+    if (value->OperIs(GT_LCL_VAR))
+    {
+        if (comp->lvaGetDesc(value->AsLclVarCommon())->TypeGet() != value->TypeGet())
+        {
+            return nullptr;
+        }
+    }
+    else if (!value->IsCnsIntOrI() || value->IsIconHandle())
+    {
+        return nullptr;
+    }
+
+    GenTree* firstNode = middleRange.FirstNode();
+    for (GenTree* node = firstNode; node != value; node = node->gtNext)
+    {
+        if (!node->OperIs(GT_IL_OFFSET))
+        {
+            return nullptr;
+        }
+    }
+
+    JITDUMP("Replacing the branch around " FMT_BB " with a select in " FMT_BB "\n", middle->bbNum, block->bbNum);
+
+    GenCondition condition = GenCondition::FromIntegralRelop(relop);
+
+    relop->SetOper(GT_CMP);
+    relop->gtType = TYP_VOID;
+    relop->gtFlags |= GTF_SET_FLAGS;
+
+    // Debug info for the removed statement doesn't matter in optimized code.
+    for (GenTree* node = firstNode; node != nullptr;)
+    {
+        GenTree* next = node->gtNext;
+        middleRange.Remove(node);
+        node = next;
+    }
+
+    GenTree*     current = comp->gtNewLclvNode(store->AsLclVarCommon()->GetLclNum(), store->TypeGet());
+    GenTreeOpCC* select =
+        new (comp, GT_SELECTCC) GenTreeOpCC(GT_SELECTCC, store->TypeGet(), condition, current, value);
+    store->AsOp()->gtOp1 = select;
+
+    BlockRange().InsertBefore(relop, current, value);
+    BlockRange().InsertAfter(relop, select, store);
+    BlockRange().Remove(jtrue);
+
+    comp->fgRemoveRefPred(join, block);
+    block->bbJumpKind = BBJ_NONE;
+    block->bbJumpDest = nullptr;
+    middle->inheritWeight(block);
+
+    return select;
+}
+#endif // defined(_TARGET_XARCH_) || defined(_TARGET_ARM64_)
+
 //----------------------------------------------------------------------------------------------
 // LowerNodeCC: Lowers a node that produces a boolean value by setting the condition flags.
 //
@@ -3090,6 +3252,20 @@ void Lowering::LowerRet(GenTree* ret)
     }
 #endif // _TARGET_AMD64_
 
+#if FEATURE_MULTIREG_RET && (defined(UNIX_AMD64_ABI) || defined(_TARGET_ARM64_))
+    if (varTypeIsStruct(ret) && ret->gtGetOp1()->OperIs(GT_LCL_VAR))
+    {
+        LclVarDsc* varDsc = comp->lvaGetDesc(ret->gtGetOp1()->AsLclVar());
+
+        // Only locals that struct promotion checked against the return registers, a local that
+        // is also assigned from a multi-reg call keeps going through the stack frame.
+        if (varDsc->lvPromoted && varDsc->lvIsMultiRegRetVal && !varDsc->lvIsMultiRegRet)
+        {
+            LowerRetPromotedStruct(ret->AsUnOp());
+        }
+    }
+#endif // FEATURE_MULTIREG_RET && (UNIX_AMD64_ABI || _TARGET_ARM64_)
+
     // Method doing PInvokes has exactly one return block unless it has tail calls.
     if (comp->compMethodRequiresPInvokeFrame() && (comp->compCurBB == comp->genReturnBB))
     {
@@ -3098,6 +3274,55 @@ void Lowering::LowerRet(GenTree* ret)
     ContainCheckRet(ret->AsOp());
 }
 
+#if FEATURE_MULTIREG_RET && (defined(UNIX_AMD64_ABI) || defined(_TARGET_ARM64_))
+//------------------------------------------------------------------------
+// LowerRetPromotedStruct: Lower a multi-reg struct return of a promoted local.
+//
+// Arguments:
+//    ret - The GT_RETURN node, its operand is a promoted struct GT_LCL_VAR.
+//
+// Notes:
+//    Struct promotion only promotes a local returned in multiple registers when
+//    it has one field per return register (see FieldsMatchReturnRegs). Replace the
+//    local with a GT_FIELD_LIST of its fields so that each field is moved into its
+//    return register directly instead of going through the stack frame.
+//
+void Lowering::LowerRetPromotedStruct(GenTreeUnOp* ret)
+{
+    GenTreeLclVar* lclVar = ret->gtGetOp1()->AsLclVar();
+    LclVarDsc*     varDsc = comp->lvaGetDesc(lclVar);
+
+    assert(varDsc->lvPromoted && varDsc->lvIsMultiRegRetVal && !varDsc->lvIsMultiRegRet);
+
+    ReturnTypeDesc retTypeDesc;
+    retTypeDesc.InitializeStructReturnType(comp, comp->info.compMethodInfo->args.retTypeClass);
+
+    // FieldsMatchReturnRegs only lets such a local be promoted with one field per return register.
+    // The struct's stack home isn't kept up to date for an independently promoted local, so
+    // genStructReturn can't be used as a fallback.
+    noway_assert(varDsc->lvFieldCnt == retTypeDesc.GetReturnRegCount());
+
+    GenTreeFieldList* fieldList = new (comp, GT_FIELD_LIST) GenTreeFieldList();
+
+    for (unsigned i = 0; i < varDsc->lvFieldCnt; i++)
+    {
+        unsigned   fieldLclNum = varDsc->lvFieldLclStart + i;
+        LclVarDsc* fieldDsc    = comp->lvaGetDesc(fieldLclNum);
+        GenTree*   fieldLcl    = comp->gtNewLclvNode(fieldLclNum, fieldDsc->TypeGet());
+
+        fieldList->AddFieldLIR(comp, fieldLcl, fieldDsc->lvFldOffset, fieldDsc->TypeGet());
+        BlockRange().InsertBefore(ret, fieldLcl);
+    }
+
+    BlockRange().InsertBefore(ret, fieldList);
+    BlockRange().Remove(lclVar);
+    ret->gtOp1 = fieldList;
+
+    JITDUMP("Returning promoted struct V%02u field by field:\n", lclVar->GetLclNum());
+    DISPTREERANGE(BlockRange(), ret);
+}
+#endif // FEATURE_MULTIREG_RET && (UNIX_AMD64_ABI || _TARGET_ARM64_)
+
 GenTree* Lowering::LowerDirectCall(GenTreeCall* call)
 {
     noway_assert(call->gtCallType == CT_USER_FUNC || call->gtCallType == CT_HELPER);
@@ -5467,6 +5692,11 @@ void Lowering::LowerBlock(BasicBlock* block)
     // Lowering::CheckBlock() runs some extra checks on call arguments in
     // order to help catch unlowered nodes.
 
+    if (comp->opts.OptimizationEnabled() && !comp->GetInterruptible())
+    {
+        MarkNewObjectStores(block);
+    }
+
     GenTree* node = BlockRange().FirstNode();
     while (node != nullptr)
     {
@@ -5476,6 +5706,95 @@ void Lowering::LowerBlock(BasicBlock* block)
     assert(CheckBlock(comp, block));
 }
 
+//------------------------------------------------------------------------
+// MarkNewObjectStores: Find stores into just allocated objects that do not
+//    need a write barrier and mark them with GTF_IND_TGT_NOT_HEAP.
+//
+// Arguments:
+//    block - the block to search, it must not have been lowered yet
+//
+// Notes:
+//    An allocation helper call marked with GTF_CALL_M_ALLOC_SMALL_OBJ returns
+//    a gen0 object. Until a GC happens the object stays in gen0 so storing a
+//    reference into it cannot create an old to young reference that the card
+//    table needs to know about. The barrier also updates the write watch that
+//    a background GC uses to revisit objects it already marked, which this
+//    doesn't account for, so the allocation is only marked when the GC never
+//    runs a background GC (see ObjectAllocator::IsSmallObjectAllocation).
+//
+//    So a store into the object whose address is the local plus a constant
+//    offset does not need a barrier if no GC safe point and no other use of
+//    the local is between the allocation and the store. In partially
+//    interruptible code GC safe points are calls, so this is done only for
+//    methods that aren't fully interruptible and the walk stops at the first
+//    node that is or may turn into a call.
+//
+void Lowering::MarkNewObjectStores(BasicBlock* block)
+{
+    unsigned newObjLclNum = BAD_VAR_NUM;
+
+    for (GenTree* node : BlockRange())
+    {
+        if (node->OperIs(GT_STORE_LCL_VAR) && node->gtGetOp1()->IsCall() &&
+            ((node->gtGetOp1()->AsCall()->gtCallMoreFlags & GTF_CALL_M_ALLOC_SMALL_OBJ) != 0))
+        {
+            LclVarDsc* lcl = comp->lvaGetDesc(node->AsLclVar());
+            newObjLclNum   = (!lcl->lvAddrExposed && !lcl->lvPromoted) ? node->AsLclVar()->GetLclNum() : BAD_VAR_NUM;
+            continue;
+        }
+
+        if (newObjLclNum == BAD_VAR_NUM)
+        {
+            continue;
+        }
+
+        if (node->IsCall() || node->OperIs(GT_RETURNTRAP, GT_PROF_HOOK, GT_LCLHEAP) || node->OperIsBlk())
+        {
+            newObjLclNum = BAD_VAR_NUM;
+        }
+        else if (node->OperIsLocal() && (node->AsLclVarCommon()->GetLclNum() == newObjLclNum))
+        {
+            // The only uses allowed are as the address of a store into the object,
+            // LCL_VAR or ADD(LCL_VAR, CNS_INT). Anything else may publish the object.
+            LIR::Use use;
+            bool     isStoreAddr = false;
+
+            if (node->OperIs(GT_LCL_VAR) && BlockRange().TryGetUse(node, &use))
+            {
+                if (use.User()->OperIs(GT_ADD) && (use.User()->gtGetOp1() == node) &&
+                    use.User()->gtGetOp2()->IsCnsIntOrI())
+                {
+                    BlockRange().TryGetUse(use.User(), &use);
+                }
+
+                isStoreAddr = use.IsInitialized() && use.User()->OperIs(GT_STOREIND) &&
+                              (use.User()->AsStoreInd()->Addr() == use.Def());
+            }
+
+            if (!isStoreAddr)
+            {
+                newObjLclNum = BAD_VAR_NUM;
+            }
+        }
+        else if (node->OperIs(GT_STOREIND))
+        {
+            GenTree* addr = node->AsStoreInd()->Addr();
+
+            if (addr->OperIs(GT_ADD) && addr->gtGetOp2()->IsCnsIntOrI())
+            {
+                addr = addr->gtGetOp1();
+            }
+
+            if (addr->OperIs(GT_LCL_VAR) && (addr->AsLclVar()->GetLclNum() == newObjLclNum))
+            {
+                JITDUMP("Store [%06u] into new object V%02u doesn't need a write barrier\n", comp->dspTreeID(node),
+                        newObjLclNum);
+                node->gtFlags |= GTF_IND_TGT_NOT_HEAP;
+            }
+        }
+    }
+}
+
 /** Verifies if both of these trees represent the same indirection.
  * Used by Lower to annotate if CodeGen generate an instruction of the
  * form *addrMode BinOp= expr
@@ -5786,7 +6105,8 @@ void Lowering::ContainCheckRet(GenTreeOp* ret)
             GenTreeLclVarCommon* lclVarCommon = op1->AsLclVarCommon();
             LclVarDsc*           varDsc       = &(comp->lvaTable[lclVarCommon->GetLclNum()]);
             // This must be a multi-reg return or an HFA of a single element.
-            assert(varDsc->lvIsMultiRegRet || (varDsc->lvIsHfa() && varTypeIsValidHfaType(varDsc->lvType)));
+            assert(varDsc->lvIsMultiRegRet || varDsc->lvIsMultiRegRetVal ||
+                   (varDsc->lvIsHfa() && varTypeIsValidHfaType(varDsc->lvType)));
 
             // Mark var as contained if not enregistrable.
             if (!varTypeIsEnregisterable(op1))
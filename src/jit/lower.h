@@ -116,6 +116,7 @@ private:
 #endif // DEBUG
 
     void LowerBlock(BasicBlock* block);
+    void MarkNewObjectStores(BasicBlock* block);
     GenTree* LowerNode(GenTree* node);
 
     void CheckVSQuirkStackPaddingNeeded(GenTreeCall* call);
@@ -130,9 +131,15 @@ private:
     GenTree* OptimizeConstCompare(GenTree* cmp);
     GenTree* LowerCompare(GenTree* cmp);
     GenTree* LowerJTrue(GenTreeOp* jtrue);
+#if defined(_TARGET_XARCH_) || defined(_TARGET_ARM64_)
+    GenTree* LowerJTrueToSelect(GenTreeOp* jtrue);
+#endif
     GenTreeCC* LowerNodeCC(GenTree* node, GenCondition condition);
     void LowerJmpMethod(GenTree* jmp);
     void LowerRet(GenTree* ret);
+#if FEATURE_MULTIREG_RET && (defined(UNIX_AMD64_ABI) || defined(_TARGET_ARM64_))
+    void LowerRetPromotedStruct(GenTreeUnOp* ret);
+#endif
     GenTree* LowerDelegateInvoke(GenTreeCall* call);
     GenTree* LowerIndirectNonvirtCall(GenTreeCall* call);
     GenTree* LowerDirectCall(GenTreeCall* call);
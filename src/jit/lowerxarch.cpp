@@ -161,7 +161,7 @@ void Lowering::LowerBlockStore(GenTreeBlk* blkNode)
             blkNode->SetOper(GT_STORE_BLK);
         }
 
-        if (!blkNode->OperIs(GT_STORE_DYN_BLK) && (size <= INITBLK_UNROLL_LIMIT))
+        if (!blkNode->OperIs(GT_STORE_DYN_BLK) && (size <= comp->getInitBlkUnrollLimit()))
         {
             if (!src->OperIs(GT_CNS_INT))
             {
@@ -185,9 +185,10 @@ void Lowering::LowerBlockStore(GenTreeBlk* blkNode)
 
                 if (fill == 0)
                 {
-                    // If the size is multiple of XMM register size there's no need to load 0 in a GPR,
-                    // codegen will use xorps to generate 0 directly in the temporary XMM register.
-                    if ((size % XMM_REGSIZE_BYTES) == 0)
+                    // If the size is at least the XMM register size there's no need to load 0 in a GPR,
+                    // codegen will use xorps to generate 0 directly in the temporary XMM register and
+                    // store any remainder by overlapping the last XMM store.
+                    if (size >= XMM_REGSIZE_BYTES)
                     {
                         src->SetContained();
                     }
@@ -239,7 +240,7 @@ void Lowering::LowerBlockStore(GenTreeBlk* blkNode)
                 blkNode->SetOper(GT_STORE_BLK);
             }
 #ifndef JIT32_GCENCODER
-            else if (dstAddr->OperIsLocalAddr() && (size <= CPBLK_UNROLL_LIMIT))
+            else if (dstAddr->OperIsLocalAddr() && (size <= comp->getCpBlkUnrollLimit()))
             {
                 // If the size is small enough to unroll then we need to mark the block as non-interruptible
                 // to actually allow unrolling. The generated code does not report GC references loaded in the
@@ -270,8 +271,11 @@ void Lowering::LowerBlockStore(GenTreeBlk* blkNode)
             {
                 // Otherwise a write barrier is needed for every GC pointer in the layout
                 // so we need to check if there's a long enough sequence of non-GC slots.
-                ClassLayout* layout = blkNode->GetLayout();
-                unsigned     slots  = layout->GetSlotCount();
+                // Sequences that are small enough to unroll are copied using SIMD moves
+                // so they don't need REP MOVSD/Q either.
+                ClassLayout* layout   = blkNode->GetLayout();
+                unsigned     slots    = layout->GetSlotCount();
+                unsigned     maxSlots = comp->getCpBlkUnrollLimit() / TARGET_POINTER_SIZE;
                 for (unsigned i = 0; i < slots; i++)
                 {
                     if (layout->IsGCPtr(i))
@@ -282,12 +286,17 @@ void Lowering::LowerBlockStore(GenTreeBlk* blkNode)
                     {
                         nonGCSlots++;
 
-                        if (nonGCSlots >= CPOBJ_NONGC_SLOTS_LIMIT)
+                        if (nonGCSlots > maxSlots)
                         {
                             break;
                         }
                     }
                 }
+
+                if (nonGCSlots <= maxSlots)
+                {
+                    nonGCSlots = 0;
+                }
             }
 
             if (nonGCSlots >= CPOBJ_NONGC_SLOTS_LIMIT)
@@ -303,7 +312,7 @@ void Lowering::LowerBlockStore(GenTreeBlk* blkNode)
         {
             assert(blkNode->OperIs(GT_STORE_BLK, GT_STORE_DYN_BLK));
 
-            if (!blkNode->OperIs(GT_STORE_DYN_BLK) && (size <= CPBLK_UNROLL_LIMIT))
+            if (!blkNode->OperIs(GT_STORE_DYN_BLK) && (size <= comp->getCpBlkUnrollLimit()))
             {
                 blkNode->gtBlkOpKind = GenTreeBlk::BlkOpKindUnroll;
 
@@ -1552,6 +1552,7 @@ void LinearScan::identifyCandidates()
         // change between the constructor and the actual allocation.
         VarSetOps::AssignNoCopy(compiler, resolutionCandidateVars, VarSetOps::MakeEmpty(compiler));
         VarSetOps::AssignNoCopy(compiler, splitOrSpilledVars, VarSetOps::MakeEmpty(compiler));
+        VarSetOps::AssignNoCopy(compiler, backEdgeLiveVars, VarSetOps::MakeEmpty(compiler));
 
         // We set enregisterLocalVars to true only if there are tracked lclVars
         assert(compiler->lvaCount != 0);
@@ -3189,6 +3190,32 @@ bool LinearScan::canSpillReg(RegRecord* physRegRecord, LsraLocation refLocation,
         // of the spill candidate found so far.  We would consider spilling a greater weight
         // ref position only if the refPosition being allocated must need a reg.
         *recentAssignedRefWeight = getWeight(recentAssignedRef);
+
+        // The weight of a local is its weighted ref count over the whole method, which doesn't say
+        // where the references are. If the next reference is in a block that is colder than the
+        // current one, spilling only costs a store after the recent reference and a reload in that
+        // block, and it keeps the register free for the values that are used in the hot code.
+        // That doesn't hold for a local that is live on a backedge: if the loop header expects it
+        // in a register, resolution reloads it on the backedge, at the weight of the loop.
+        Interval*    assignedInterval = physRegRecord->assignedInterval;
+        RefPosition* nextRefPosition  = recentAssignedRef->nextRefPosition;
+        if (assignedInterval->isLocalVar && (nextRefPosition != nullptr) && (nextRefPosition->bbNum != curBBNum) &&
+            !VarSetOps::IsMember(compiler, backEdgeLiveVars, assignedInterval->getVarIndex(compiler)))
+        {
+            unsigned nextRefBlockWeight = blockInfo[nextRefPosition->bbNum].weight;
+            if (nextRefBlockWeight < blockInfo[curBBNum].weight)
+            {
+                unsigned spillWeight = nextRefBlockWeight;
+                if (!assignedInterval->isSpilled)
+                {
+                    spillWeight += blockInfo[recentAssignedRef->bbNum].weight;
+                }
+                if (spillWeight < *recentAssignedRefWeight)
+                {
+                    *recentAssignedRefWeight = spillWeight;
+                }
+            }
+        }
     }
     return true;
 }
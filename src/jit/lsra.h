@@ -1464,6 +1464,9 @@ private:
     VARSET_TP resolutionCandidateVars;
     // This set contains all the lclVars that are ever spilled or split.
     VARSET_TP splitOrSpilledVars;
+    // Set of lclVars that are live on a backedge, i.e. from a block to a successor that precedes it
+    // in the block sequence.
+    VARSET_TP backEdgeLiveVars;
     // Set of floating point variables to consider for callee-save registers.
     VARSET_TP fpCalleeSaveCandidateVars;
     // Set of variables exposed on EH flow edges.
@@ -367,9 +367,16 @@ int LinearScan::BuildNode(GenTree* tree)
         case GT_TEST_EQ:
         case GT_TEST_NE:
         case GT_JCMP:
+        case GT_CMP:
             srcCount = BuildCmp(tree);
             break;
 
+        case GT_SELECTCC:
+            srcCount = BuildBinaryUses(tree->AsOp());
+            assert(dstCount == 1);
+            BuildDef(tree);
+            break;
+
         case GT_CKFINITE:
             srcCount = 1;
             assert(dstCount == 1);
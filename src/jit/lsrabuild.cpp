@@ -2262,6 +2262,17 @@ void LinearScan::buildIntervals()
                     }
                     JITDUMP("\n");
                 }
+
+                // Remember the lclVars that are live into a successor we've already visited, so that
+                // canSpillReg won't treat them as cheap to spill in the body of the loop.
+                for (BasicBlock* succ : block->GetAllSuccs(compiler))
+                {
+                    if (isBlockVisited(succ))
+                    {
+                        VARSET_TP liveOnBackEdge(VarSetOps::Intersection(compiler, block->bbLiveOut, succ->bbLiveIn));
+                        VarSetOps::UnionD(compiler, backEdgeLiveVars, liveOnBackEdge);
+                    }
+                }
             }
 
             // Clear the "last use" flag on any vars that are live-out from this block.
@@ -3076,6 +3087,24 @@ int LinearScan::BuildReturn(GenTree* tree)
     }
     else
 #endif // !defined(_TARGET_64BIT_)
+#if FEATURE_MULTIREG_RET && (defined(UNIX_AMD64_ABI) || defined(_TARGET_ARM64_))
+        if (varTypeIsStruct(tree) && op1->OperIs(GT_FIELD_LIST))
+    {
+        // The fields of a promoted struct, each one goes in its own return register.
+        ReturnTypeDesc retTypeDesc;
+        retTypeDesc.InitializeStructReturnType(compiler, compiler->info.compMethodInfo->args.retTypeClass);
+
+        int srcCount = 0;
+        for (GenTreeFieldList::Use& use : op1->AsFieldList()->Uses())
+        {
+            BuildUse(use.GetNode(), genRegMask(retTypeDesc.GetABIReturnReg(srcCount)));
+            srcCount++;
+        }
+        assert((unsigned)srcCount == retTypeDesc.GetReturnRegCount());
+        return srcCount;
+    }
+    else
+#endif // FEATURE_MULTIREG_RET && (UNIX_AMD64_ABI || _TARGET_ARM64_)
         if ((tree->TypeGet() != TYP_VOID) && !op1->isContained())
     {
         regMaskTP useCandidates = RBM_NONE;
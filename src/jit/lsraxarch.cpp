@@ -263,6 +263,22 @@ int LinearScan::BuildNode(GenTree* tree)
             BuildDef(tree, allByteRegs());
             break;
 
+        case GT_SELECTCC:
+        {
+            // cmov only has a two operand form, the "true" value is copied to the target
+            // register and the "false" value is then conditionally moved over it. So the
+            // "false" value must stay live in a register other than the target's.
+            GenTree* trueVal  = tree->gtGetOp1();
+            GenTree* falseVal = tree->gtGetOp2();
+            assert(!trueVal->isContained() && !falseVal->isContained());
+
+            tgtPrefUse = BuildUse(trueVal);
+            srcCount   = 1 + BuildDelayFreeUses(falseVal);
+            assert(dstCount == 1);
+            BuildDef(tree);
+        }
+        break;
+
         case GT_JMP:
             srcCount = 0;
             assert(dstCount == 0);
@@ -1293,7 +1309,7 @@ int LinearScan::BuildBlockStore(GenTreeBlk* blkNode)
                 if (size >= XMM_REGSIZE_BYTES)
                 {
                     buildInternalFloatRegisterDefForNode(blkNode, internalFloatRegCandidates());
-                    SetContainsAVXFlags();
+                    SetContainsAVXFlags((size >= YMM_REGSIZE_BYTES) ? YMM_REGSIZE_BYTES : XMM_REGSIZE_BYTES);
                 }
 
 #ifdef _TARGET_X86_
@@ -1339,6 +1355,42 @@ int LinearScan::BuildBlockStore(GenTreeBlk* blkNode)
                 sizeRegMask = RBM_RCX;
             }
 
+            // Non-GC regions that are copied with SIMD moves need a temporary register. Codegen
+            // only does that when the destination is not on the stack, see genCodeForCpObj.
+            if (!dstAddr->OperIsLocalAddr())
+            {
+                ClassLayout* layout         = blkNode->GetLayout();
+                unsigned     slots          = layout->GetSlotCount();
+                unsigned     maxSlots       = compiler->getCpBlkUnrollLimit() / TARGET_POINTER_SIZE;
+                unsigned     maxUnrollSlots = 0;
+
+                for (unsigned i = 0; i < slots;)
+                {
+                    unsigned nonGCSlots = 0;
+                    for (; (i < slots) && !layout->IsGCPtr(i); i++)
+                    {
+                        nonGCSlots++;
+                    }
+
+                    if ((nonGCSlots >= CPOBJ_NONGC_SLOTS_LIMIT) && (nonGCSlots <= maxSlots))
+                    {
+                        maxUnrollSlots = max(maxUnrollSlots, nonGCSlots);
+                    }
+
+                    if (nonGCSlots == 0)
+                    {
+                        i++;
+                    }
+                }
+
+                if (maxUnrollSlots != 0)
+                {
+                    unsigned maxUnrollSize = maxUnrollSlots * TARGET_POINTER_SIZE;
+                    buildInternalFloatRegisterDefForNode(blkNode, internalFloatRegCandidates());
+                    SetContainsAVXFlags((maxUnrollSize >= YMM_REGSIZE_BYTES) ? YMM_REGSIZE_BYTES : XMM_REGSIZE_BYTES);
+                }
+            }
+
             // The srcAddr must be in a register.  If it was under a GT_IND, we need to subsume all of its
             // sources.
             dstAddrRegMask = RBM_RDI;
@@ -1349,7 +1401,8 @@ int LinearScan::BuildBlockStore(GenTreeBlk* blkNode)
             switch (blkNode->gtBlkOpKind)
             {
                 case GenTreeBlk::BlkOpKindUnroll:
-                    if ((size % XMM_REGSIZE_BYTES) != 0)
+                    // Blocks of at least XMM_REGSIZE_BYTES copy any remainder using an overlapping SIMD move.
+                    if (size < XMM_REGSIZE_BYTES)
                     {
                         regMaskTP regMask = allRegs(TYP_INT);
 #ifdef _TARGET_X86_
@@ -1365,7 +1418,7 @@ int LinearScan::BuildBlockStore(GenTreeBlk* blkNode)
                     if (size >= XMM_REGSIZE_BYTES)
                     {
                         buildInternalFloatRegisterDefForNode(blkNode, internalFloatRegCandidates());
-                        SetContainsAVXFlags();
+                        SetContainsAVXFlags((size >= YMM_REGSIZE_BYTES) ? YMM_REGSIZE_BYTES : XMM_REGSIZE_BYTES);
                     }
                     break;
 
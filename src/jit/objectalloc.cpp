@@ -51,6 +51,7 @@ void ObjectAllocator::DoPhase()
     {
         ComputeStackObjectPointers(&m_bitVecTraits);
         RewriteUses();
+        PrepareStackLocalsForPromotion();
     }
 }
 
@@ -473,6 +474,11 @@ GenTree* ObjectAllocator::MorphAllocObjNodeIntoHelperCall(GenTreeAllocObj* alloc
         helperCall->AsCall()->gtCallMoreFlags |= GTF_CALL_M_ALLOC_SIDE_EFFECTS;
     }
 
+    if (IsSmallObjectAllocation(allocObj))
+    {
+        helperCall->AsCall()->gtCallMoreFlags |= GTF_CALL_M_ALLOC_SMALL_OBJ;
+    }
+
 #ifdef FEATURE_READYTORUN_COMPILER
     if (entryPoint.addr != nullptr)
     {
@@ -553,6 +559,10 @@ unsigned int ObjectAllocator::MorphAllocObjNodeIntoStackAlloc(GenTreeAllocObj* a
 
     comp->fgInsertStmtBefore(block, stmt, newStmt);
 
+    comp->lvaGetDesc(lclNum)->lvIsStackAllocatedObject = 1;
+    m_StackLocals.Push(lclNum);
+    m_StackLocalToMethodTableStoreMap.AddOrUpdate(lclNum, newStmt);
+
     return lclNum;
 }
 
@@ -639,6 +649,9 @@ bool ObjectAllocator::CanLclVarEscapeViaParentStack(ArrayStack<GenTree*>* parent
 
             case GT_EQ:
             case GT_NE:
+            case GT_NULLCHECK:
+                // Comparing or null checking the reference (e.g. a discarded field load
+                // left behind by an inlined callee) doesn't make it escaping.
                 canLclVarEscapeViaParentStack = false;
                 break;
 
@@ -747,6 +760,7 @@ void ObjectAllocator::UpdateAncestorTypes(GenTree* tree, ArrayStack<GenTree*>* p
 
             case GT_EQ:
             case GT_NE:
+            case GT_NULLCHECK:
                 break;
 
             case GT_COMMA:
@@ -915,3 +929,131 @@ void ObjectAllocator::RewriteUses()
         }
     }
 }
+
+//------------------------------------------------------------------------
+// PrepareStackLocalsForPromotion: Find stack-allocated objects whose fields
+//                                 can become independently promoted locals.
+//
+// Notes:
+//    After RewriteUses every use of a stack-allocated object is the address
+//    of its stack local. If all of these addresses only feed field accesses
+//    the object's identity is never observed, so its method table pointer is
+//    never read. The method table store is removed for such locals so that
+//    struct promotion can replace the whole object by its fields.
+//    Locals whose address is used in any other way keep the store; they are
+//    address exposed and only get dependently promoted, if at all.
+
+void ObjectAllocator::PrepareStackLocalsForPromotion()
+{
+    class StackLocalUsesVisitor final : public GenTreeVisitor<StackLocalUsesVisitor>
+    {
+        ObjectAllocator* m_allocator;
+
+    public:
+        enum
+        {
+            DoPreOrder    = true,
+            DoLclVarsOnly = true,
+            ComputeStack  = true,
+        };
+
+        StackLocalUsesVisitor(ObjectAllocator* allocator)
+            : GenTreeVisitor<StackLocalUsesVisitor>(allocator->comp), m_allocator(allocator)
+        {
+        }
+
+        Compiler::fgWalkResult PreOrderVisit(GenTree** use, GenTree* user)
+        {
+            GenTree* tree = *use;
+            assert(tree->IsLocal());
+
+            const unsigned int lclNum = tree->AsLclVarCommon()->GetLclNum();
+            Statement*         mtStore;
+
+            if (m_allocator->m_StackLocalToMethodTableStoreMap.TryGetValue(lclNum, &mtStore) &&
+                !IsFieldAccessOnlyUse(tree))
+            {
+                JITDUMP("Stack local V%02u is used as a whole object at [%06u]\n", lclNum,
+                        m_compiler->dspTreeID(tree));
+                m_allocator->m_StackLocalToMethodTableStoreMap.TryRemove(lclNum, &mtStore);
+            }
+
+            return Compiler::fgWalkResult::WALK_CONTINUE;
+        }
+
+    private:
+        bool IsFieldAccessOnlyUse(GenTree* tree)
+        {
+            assert(tree == m_ancestors.Top());
+
+            if (m_ancestors.Height() < 2)
+            {
+                return false;
+            }
+
+            GenTree* parent = m_ancestors.Top(1);
+
+            // Explicit zero initialization of the object memory.
+            if (parent->OperIs(GT_ASG) && (parent->AsOp()->gtGetOp1() == tree))
+            {
+                return true;
+            }
+
+            // Otherwise expect FIELD(ADDR(LCL_VAR)) where the address of the field isn't taken.
+            if (!parent->OperIs(GT_ADDR) || (m_ancestors.Height() < 3))
+            {
+                return false;
+            }
+
+            GenTree* field = m_ancestors.Top(2);
+            if (!field->OperIs(GT_FIELD) || (field->AsField()->gtFldObj != parent) ||
+                FieldSeqStore::IsPseudoField(field->AsField()->gtFldHnd))
+            {
+                return false;
+            }
+
+            return (m_ancestors.Height() < 4) || !m_ancestors.Top(3)->OperIs(GT_ADDR);
+        }
+    };
+
+    BasicBlock* block;
+
+    foreach_block(comp, block)
+    {
+        for (Statement* stmt : block->Statements())
+        {
+            StackLocalUsesVisitor stackLocalUsesVisitor(this);
+            Statement*            mtStore;
+            GenTree*              root = stmt->GetRootNode();
+
+            // Skip the method table stores themselves.
+            if (root->OperIs(GT_ASG) && root->gtGetOp1()->OperIs(GT_FIELD) &&
+                (root->gtGetOp1()->AsField()->gtFldObj != nullptr))
+            {
+                GenTreeLclVarCommon* lcl = root->gtGetOp1()->AsField()->gtFldObj->IsLocalAddrExpr();
+                if ((lcl != nullptr) && m_StackLocalToMethodTableStoreMap.TryGetValue(lcl->GetLclNum(), &mtStore) &&
+                    (mtStore == stmt))
+                {
+                    continue;
+                }
+            }
+
+            stackLocalUsesVisitor.WalkTree(stmt->GetRootNodePointer(), nullptr);
+        }
+    }
+
+    for (int i = 0; i < m_StackLocals.Height(); i++)
+    {
+        const unsigned int stackLclNum = m_StackLocals.Bottom(i);
+        Statement*         mtStore;
+
+        if (comp->lvaGetDesc(stackLclNum)->lvIsStackAllocatedObject &&
+            m_StackLocalToMethodTableStoreMap.TryGetValue(stackLclNum, &mtStore))
+        {
+            JITDUMP("Removing method table store of stack local V%02u, only its fields are accessed\n",
+                    stackLclNum);
+            mtStore->GetRootNode()->gtBashToNOP();
+            comp->lvaTable[stackLclNum].lvFieldAccessed = 1;
+        }
+    }
+}
@@ -23,6 +23,7 @@ XXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXX
 class ObjectAllocator final : public Phase
 {
     typedef SmallHashTable<unsigned int, unsigned int, 8U> LocalToLocalMap;
+    typedef SmallHashTable<unsigned int, Statement*, 8U> LocalToStmtMap;
 
     //===============================================================================
     // Data members
@@ -36,6 +37,10 @@ class ObjectAllocator final : public Phase
     BitVec              m_DefinitelyStackPointingPointers;
     LocalToLocalMap     m_HeapLocalToStackLocalMap;
     BitSetShortLongRep* m_ConnGraphAdjacencyMatrix;
+    // Stack locals created for stack-allocated objects and the statements
+    // initializing their method table pointers.
+    ArrayStack<unsigned int> m_StackLocals;
+    LocalToStmtMap           m_StackLocalToMethodTableStoreMap;
 
     //===============================================================================
     // Methods
@@ -49,6 +54,7 @@ protected:
 
 private:
     bool CanAllocateLclVarOnStack(unsigned int lclNum, CORINFO_CLASS_HANDLE clsHnd);
+    bool IsSmallObjectAllocation(GenTreeAllocObj* allocObj);
     bool CanLclVarEscape(unsigned int lclNum);
     void MarkLclVarAsPossiblyStackPointing(unsigned int lclNum);
     void MarkLclVarAsDefinitelyStackPointing(unsigned int lclNum);
@@ -62,6 +68,7 @@ private:
     void ComputeStackObjectPointers(BitVecTraits* bitVecTraits);
     bool     MorphAllocObjNodes();
     void     RewriteUses();
+    void     PrepareStackLocalsForPromotion();
     GenTree* MorphAllocObjNodeIntoHelperCall(GenTreeAllocObj* allocObj);
     unsigned int MorphAllocObjNodeIntoStackAlloc(GenTreeAllocObj* allocObj, BasicBlock* block, Statement* stmt);
     struct BuildConnGraphVisitorCallbackData;
@@ -71,6 +78,12 @@ private:
     static Compiler::fgWalkResult AssertWhenAllocObjFoundVisitor(GenTree** pTree, Compiler::fgWalkData* data);
 #endif // DEBUG
     static const unsigned int s_StackAllocMaxSize = 0x2000U;
+    // Objects of this size or larger are allocated on the large object heap (see LARGE_OBJECT_SIZE in gc.h).
+    // The GC's threshold (GCLOHThreshold) may be raised but not lowered.
+    static const unsigned int s_LargeObjectSize = 85000U;
+    // Objects within this many bytes of s_LargeObjectSize aren't considered small, in case the
+    // VM's base size of a class has more padding than IsSmallObjectAllocation accounts for.
+    static const unsigned int s_LargeObjectSizeMargin = 0x400U;
 };
 
 //===============================================================================
@@ -81,6 +94,8 @@ inline ObjectAllocator::ObjectAllocator(Compiler* comp)
     , m_AnalysisDone(false)
     , m_bitVecTraits(comp->lvaCount, comp)
     , m_HeapLocalToStackLocalMap(comp->getAllocator())
+    , m_StackLocals(comp->getAllocator())
+    , m_StackLocalToMethodTableStoreMap(comp->getAllocator())
 {
     // Disable checks since this phase runs before fgComputePreds phase.
     // Checks are not expected to pass before fgComputePreds.
@@ -146,6 +161,63 @@ inline bool ObjectAllocator::CanAllocateLclVarOnStack(unsigned int lclNum, CORIN
     return !CanLclVarEscape(lclNum) && (classSize <= s_StackAllocMaxSize);
 }
 
+//------------------------------------------------------------------------
+// IsSmallObjectAllocation: Returns true iff the allocation returns a new
+//                          object that is still in gen0.
+//
+// Arguments:
+//    allocObj - GT_ALLOCOBJ node of the allocation
+//
+// Return Value:
+//    Returns true iff the new object is allocated in gen0 and no GC can
+//    happen between its allocation and the helper's return.
+//
+// Notes:
+//    Used to elide write barriers for stores into the new object, see
+//    Lowering::MarkNewObjectStores. Boxes aren't considered and neither
+//    are ready to run allocations since the class size may change.
+//
+//    Only the CORINFO_HELP_NEWSFAST helpers are considered. The VM uses
+//    CORINFO_HELP_NEWFAST instead when allocations are tracked, since the
+//    profiler's ObjectAllocated callback can trigger a GC, which could
+//    promote the new object before the helper returns.
+//
+//    The GC puts objects on the large object heap based on their base size,
+//    which includes the object header that getHeapClassSize leaves out.
+//
+//    Only done when the VM says that the GC never runs a background GC. A
+//    background GC finds stores into objects it has already marked through
+//    the write watch that the barrier updates, and it isn't established that
+//    a new gen0 object can never be one of those.
+
+inline bool ObjectAllocator::IsSmallObjectAllocation(GenTreeAllocObj* allocObj)
+{
+    if (comp->opts.OptimizationDisabled() || comp->opts.IsReadyToRun() ||
+        !comp->opts.jitFlags->IsSet(JitFlags::JIT_FLAG_NO_CONCURRENT_GC) ||
+        (JitConfig.JitElideNewObjWriteBarriers() == 0))
+    {
+        return false;
+    }
+
+    if ((allocObj->gtNewHelper != CORINFO_HELP_NEWSFAST) && (allocObj->gtNewHelper != CORINFO_HELP_NEWSFAST_ALIGN8))
+    {
+        return false;
+    }
+
+    CORINFO_CLASS_HANDLE clsHnd       = allocObj->gtAllocObjClsHnd;
+    DWORD                classAttribs = comp->info.compCompHnd->getClassAttribs(clsHnd);
+
+    if ((classAttribs & CORINFO_FLG_VALUECLASS) != 0)
+    {
+        return false;
+    }
+
+    const unsigned int baseSize =
+        roundUp(comp->info.compCompHnd->getHeapClassSize(clsHnd) + TARGET_POINTER_SIZE, TARGET_POINTER_SIZE);
+
+    return baseSize + s_LargeObjectSizeMargin < s_LargeObjectSize;
+}
+
 //------------------------------------------------------------------------
 // CanLclVarEscape:          Returns true iff local variable can
 //                           potentially escape from the method
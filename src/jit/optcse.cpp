@@ -1252,6 +1252,7 @@ class CSE_Heuristic
 {
     Compiler* m_pCompiler;
     unsigned  m_addCSEcount;
+    unsigned  m_enregCSEcount; // count of the promoted CSEs that are likely to be enregistered
 
     unsigned               aggressiveRefCnt;
     unsigned               moderateRefCnt;
@@ -1285,23 +1286,13 @@ public:
     //
     void Initialize()
     {
-        m_addCSEcount = 0; /* Count of the number of LclVars for CSEs that we added */
+        m_addCSEcount   = 0; /* Count of the number of LclVars for CSEs that we added */
+        m_enregCSEcount = 0;
 
-        // Record the weighted ref count of the last "for sure" callee saved LclVar
-        aggressiveRefCnt = 0;
-        moderateRefCnt   = 0;
-        enregCount       = 0;
-        largeFrame       = false;
-        hugeFrame        = false;
-        sortTab          = nullptr;
-        sortSiz          = 0;
-
-#ifdef _TARGET_XARCH_
-        if (m_pCompiler->compLongUsed)
-        {
-            enregCount++;
-        }
-#endif
+        largeFrame = false;
+        hugeFrame  = false;
+        sortTab    = nullptr;
+        sortSiz    = 0;
 
         unsigned   frameSize        = 0;
         unsigned   regAvailEstimate = ((CNT_CALLEE_ENREG * 3) + (CNT_CALLEE_TRASH * 2) + 1);
@@ -1392,6 +1383,40 @@ public:
 #endif
         }
 
+        ComputePromotionCutoffs();
+
+#ifdef DEBUG
+        if (m_pCompiler->verbose)
+        {
+            printf("Framesize estimate is 0x%04X\n", frameSize);
+            printf("We have a %s frame\n", hugeFrame ? "huge" : (largeFrame ? "large" : "small"));
+        }
+#endif
+    }
+
+    // Determine the aggressive and moderate cutoffs from the weighted ref counts of
+    // the tracked locals, which are sorted by decreasing weight. The cutoffs are the
+    // weights of the locals that are unlikely to get a register (aggressive) or a
+    // callee saved register (moderate).
+    //
+    // Each CSE that was already promoted and can be enregistered competes for the same
+    // registers, so it pushes one more local out. This keeps a method with many CSEs
+    // from promoting them all with the "will get a register" cost estimate.
+    //
+    void ComputePromotionCutoffs()
+    {
+        // Record the weighted ref count of the last "for sure" callee saved LclVar
+        aggressiveRefCnt = 0;
+        moderateRefCnt   = 0;
+        enregCount       = m_enregCSEcount;
+
+#ifdef _TARGET_XARCH_
+        if (m_pCompiler->compLongUsed)
+        {
+            enregCount++;
+        }
+#endif
+
         for (unsigned trackedIndex = 0; trackedIndex < m_pCompiler->lvaTrackedCount; trackedIndex++)
         {
             LclVarDsc* varDsc = m_pCompiler->lvaGetDescByTrackedIndex(trackedIndex);
@@ -1452,8 +1477,6 @@ public:
             printf("\n");
             printf("Aggressive CSE Promotion cutoff is %u\n", aggressiveRefCnt);
             printf("Moderate CSE Promotion cutoff is %u\n", moderateRefCnt);
-            printf("Framesize estimate is 0x%04X\n", frameSize);
-            printf("We have a %s frame\n", hugeFrame ? "huge" : (largeFrame ? "large" : "small"));
         }
 #endif
     }
@@ -1664,6 +1687,43 @@ public:
         // Indicate whether to perform CSE or not.
         return ret;
     }
+
+    // Check whether JitReplayCSE decides this candidate. Returns 1 if the candidate
+    // is in the list, -1 if it isn't, and 0 if JitReplayCSE isn't set. This allows
+    // trying out a set of CSE decisions for a method without changing the heuristic.
+    //
+    int optConfigReplayCSE(unsigned cseIndex)
+    {
+        const WCHAR* replayList = JitConfig.JitReplayCSE();
+        if (replayList == nullptr)
+        {
+            return 0;
+        }
+
+        for (const WCHAR* p = replayList; *p != W('\0');)
+        {
+            if ((*p < W('0')) || (*p > W('9')))
+            {
+                p++;
+                continue;
+            }
+
+            unsigned value = 0;
+            for (; (*p >= W('0')) && (*p <= W('9')); p++)
+            {
+                value = (value * 10) + (*p - W('0'));
+            }
+
+            if (value == cseIndex)
+            {
+                JITDUMP("Promoting CSE #%02u because it is in JitReplayCSE\n", cseIndex);
+                return 1;
+            }
+        }
+
+        JITDUMP("No CSE #%02u because it is not in JitReplayCSE\n", cseIndex);
+        return -1;
+    }
 #endif
 
     // Given a CSE candidate decide whether it passes or fails the profitability heuristic
@@ -1674,6 +1734,12 @@ public:
         bool result = false;
 
 #ifdef DEBUG
+        int replayResult = optConfigReplayCSE(candidate->CseIndex());
+        if (replayResult != 0)
+        {
+            return (replayResult > 0);
+        }
+
         int stressResult = optConfigBiasedCSE();
         if (stressResult != 0)
         {
@@ -2514,7 +2580,16 @@ public:
 
             if (doCSE)
             {
+                const bool likelyEnregistered =
+                    !varTypeIsFloating(candidate.Expr()) && (candidate.Expr()->TypeGet() != TYP_STRUCT);
+
                 PerformCSE(&candidate);
+
+                if (likelyEnregistered)
+                {
+                    m_enregCSEcount++;
+                    ComputePromotionCutoffs();
+                }
             }
         }
     }
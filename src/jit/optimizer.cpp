@@ -3915,6 +3915,625 @@ void Compiler::optUnrollLoops()
 #pragma warning(pop)
 #endif
 
+//------------------------------------------------------------------------
+// optPartiallyUnrollLoops: Unroll single block counted loops whose trip
+//    count isn't a constant.
+//
+// Notes:
+//    Looks for innermost do-while loops of the form
+//
+//        do { body; i++; } while (i < limit);
+//
+//    where the limit doesn't change in the loop, and replicates the body
+//    "factor" times in a new loop that runs while at least "factor" iterations
+//    are left. The original loop is kept after it to run the remaining ones:
+//
+//        if ((i < limit) && (limit - i >= factor))
+//        {
+//            do { body; i++; ... body; i++; } while (limit - i >= factor);
+//            if (i >= limit) goto exit;
+//        }
+//        do { body; i++; } while (i < limit);
+//      exit:
+//
+//    The unrolled loop takes over the loop table entry of the original loop,
+//    which is left to the surrounding loop like the slow path of a cloned loop.
+//    The unroll factor depends on the size of the body and, when profile data
+//    is available, on the average trip count of the loop.
+//
+//    Off by default, JitPartialUnrollLoops=1 enables it.
+
+void Compiler::optPartiallyUnrollLoops()
+{
+    if ((JitConfig.JitPartialUnrollLoops() == 0) || (compCodeOpt() == SMALL_CODE) || (optLoopCount == 0))
+    {
+        return;
+    }
+
+#ifdef DEBUG
+    if (JitConfig.JitNoUnroll())
+    {
+        return;
+    }
+#endif
+
+    JITDUMP("\n*************** In optPartiallyUnrollLoops()\n");
+
+    bool change = false;
+
+    for (unsigned lnum = 0; lnum < optLoopCount; lnum++)
+    {
+        LoopDsc& loop = optLoopTable[lnum];
+
+        const unsigned requiredFlags = LPFLG_DO_WHILE | LPFLG_ITER;
+        if (((loop.lpFlags & requiredFlags) != requiredFlags) ||
+            ((loop.lpFlags & (LPFLG_REMOVED | LPFLG_DONT_UNROLL)) != 0) || (loop.lpChild != BasicBlock::NOT_IN_LOOP))
+        {
+            continue;
+        }
+
+        BasicBlock* head  = loop.lpHead;
+        BasicBlock* block = loop.lpTop;
+        if ((block != loop.lpBottom) || (block != loop.lpEntry) || (block->bbJumpKind != BBJ_COND) ||
+            (block->bbJumpDest != block) || (block->bbNext == nullptr) || (head->bbNext != block) ||
+            (block->bbRefs != 2) || !BasicBlock::sameEHRegion(head, block) || block->isRunRarely())
+        {
+            continue;
+        }
+
+        // The loop must only be entered by falling through from its head.
+        if ((head->bbJumpKind != BBJ_NONE) && ((head->bbJumpKind != BBJ_COND) || (head->bbJumpDest == block)))
+        {
+            continue;
+        }
+
+        // The iterator must count up by one and only be updated by the increment.
+        const unsigned iterVar = loop.lpIterVar();
+        GenTree*       incr    = loop.lpIterTree->gtGetOp2();
+        if ((loop.lpIterOper() != GT_ADD) || (loop.lpIterConst() != 1) || incr->gtOverflow() ||
+            (loop.lpIterOperType() != TYP_INT) || lvaTable[iterVar].lvAddrExposed ||
+            lvaTable[iterVar].lvIsStructField || optIsVarAssigned(block, block, loop.lpIterTree, iterVar))
+        {
+            continue;
+        }
+
+        GenTree* test  = loop.lpTestTree;
+        GenTree* limit = loop.lpLimit();
+        if (loop.lpIsReversed() || !test->OperIs(GT_LT) || ((test->gtFlags & GTF_UNSIGNED) != 0))
+        {
+            continue;
+        }
+
+        // The limit is evaluated outside of the loop now, so it must not change in it.
+        if ((loop.lpFlags & LPFLG_CONST_LIMIT) == 0)
+        {
+            GenTree* limitLcl = nullptr;
+            if ((loop.lpFlags & LPFLG_VAR_LIMIT) != 0)
+            {
+                limitLcl = limit;
+            }
+            else if (((loop.lpFlags & LPFLG_ARRLEN_LIMIT) != 0) && limit->OperIs(GT_ARR_LENGTH) &&
+                     !limit->OperMayThrow(this))
+            {
+                // A faulting array length can't be moved ahead of the first iteration.
+                limitLcl = limit->AsArrLen()->ArrRef();
+            }
+
+            if ((limitLcl == nullptr) || !limitLcl->OperIs(GT_LCL_VAR) ||
+                lvaTable[limitLcl->AsLclVarCommon()->GetLclNum()].lvAddrExposed ||
+                optIsVarAssigned(block, block, nullptr, limitLcl->AsLclVarCommon()->GetLclNum()))
+            {
+                continue;
+            }
+        }
+
+        Statement* testStmt = block->lastStmt();
+        Statement* incrStmt = (testStmt != nullptr) ? testStmt->GetPrevStmt() : nullptr;
+        if ((testStmt == nullptr) || !testStmt->GetRootNode()->OperIs(GT_JTRUE) ||
+            (testStmt->GetRootNode()->gtGetOp1() != test) || (incrStmt == testStmt) ||
+            (incrStmt->GetRootNode() != loop.lpIterTree) || (incrStmt == block->firstStmt()))
+        {
+            continue;
+        }
+
+        // Pick the unroll factor from the size of one iteration.
+        unsigned iterCostSz = 0;
+        for (Statement* stmt = block->firstStmt(); stmt != testStmt; stmt = stmt->GetNextStmt())
+        {
+            gtSetStmtInfo(stmt);
+            iterCostSz += stmt->GetCostSz();
+        }
+
+        unsigned factor = (iterCostSz <= 8) ? 8 : (iterCostSz <= 16) ? 4 : (iterCostSz <= 40) ? 2 : 1;
+
+        if (fgHaveProfileData())
+        {
+            // Don't bother when the loop doesn't usually run for a couple of unrolled iterations.
+            if (!block->hasProfileWeight() || !head->hasProfileWeight() || (head->bbWeight == BB_ZERO_WEIGHT))
+            {
+                continue;
+            }
+
+            const BasicBlock::weight_t tripCount = block->bbWeight / head->bbWeight;
+            while ((factor > 1) && (tripCount < 2 * factor))
+            {
+                factor /= 2;
+            }
+        }
+        else
+        {
+            // Without profile data assume a moderate trip count.
+            factor = min(factor, 4u);
+        }
+
+        if (factor < 2)
+        {
+            continue;
+        }
+
+        // Clone the body and the increment up front since cloning may fail.
+        ArrayStack<GenTree*> unrolledTrees(getAllocator(CMK_LoopOpt));
+        bool                 cloneOk = true;
+        for (unsigned i = 0; cloneOk && (i < factor); i++)
+        {
+            for (Statement* stmt = block->firstStmt(); stmt != testStmt; stmt = stmt->GetNextStmt())
+            {
+                GenTree* clone = gtCloneExpr(stmt->GetRootNode());
+                if (clone == nullptr)
+                {
+                    cloneOk = false;
+                    break;
+                }
+                unrolledTrees.Push(clone);
+            }
+        }
+
+        if (!cloneOk)
+        {
+            loop.lpFlags |= LPFLG_DONT_UNROLL;
+            continue;
+        }
+
+        JITDUMP("Partially unrolling loop L%02u (" FMT_BB ") over V%02u by %u\n", lnum, block->bbNum, iterVar,
+                factor);
+
+        BasicBlock* exit          = block->bbNext;
+        BasicBlock* entryTest     = fgNewBBafter(BBJ_COND, head, /* extendRegion */ true);
+        BasicBlock* countTest     = fgNewBBafter(BBJ_COND, entryTest, /* extendRegion */ true);
+        BasicBlock* unrolled      = fgNewBBafter(BBJ_COND, countTest, /* extendRegion */ true);
+        BasicBlock* remainderTest = fgNewBBafter(BBJ_COND, unrolled, /* extendRegion */ true);
+        assert(remainderTest->bbNext == block);
+
+        entryTest->bbJumpDest     = block;
+        countTest->bbJumpDest     = block;
+        unrolled->bbJumpDest      = unrolled;
+        remainderTest->bbJumpDest = exit;
+
+        BasicBlock* const testBlocks[] = {entryTest, countTest, remainderTest, unrolled};
+        for (unsigned i = 0; i < 3; i++)
+        {
+            testBlocks[i]->inheritWeight(head);
+            testBlocks[i]->bbNatLoopNum = loop.lpParent;
+        }
+
+        unrolled->bbFlags |= block->bbFlags;
+        unrolled->inheritWeight(block);
+        unrolled->modifyBBWeight(block->bbWeight / factor);
+        unrolled->bbNatLoopNum = lnum;
+
+        // The original loop now only runs the remaining iterations.
+        block->bbFlags &= ~BBF_LOOP_HEAD;
+        block->modifyBBWeight(min(block->bbWeight, head->bbWeight * factor));
+        block->bbNatLoopNum = loop.lpParent;
+
+        // if (i >= limit) goto block;
+        GenTree* relop = gtNewOperNode(GT_GE, TYP_INT, gtNewLclvNode(iterVar, TYP_INT), gtCloneExpr(limit));
+        fgInsertStmtAtEnd(entryTest, fgNewStmtFromTree(gtNewOperNode(GT_JTRUE, TYP_VOID, relop)));
+
+        // if (limit - i < factor) goto block;
+        //
+        // i < limit here so when limit - i overflows it's because way more than "factor"
+        // iterations are left, in which case unrolling is skipped without harm.
+        GenTree* left = gtNewOperNode(GT_SUB, TYP_INT, gtCloneExpr(limit), gtNewLclvNode(iterVar, TYP_INT));
+        relop         = gtNewOperNode(GT_LT, TYP_INT, left, gtNewIconNode(factor));
+        fgInsertStmtAtEnd(countTest, fgNewStmtFromTree(gtNewOperNode(GT_JTRUE, TYP_VOID, relop)));
+
+        for (int i = 0; i < unrolledTrees.Height(); i++)
+        {
+            fgInsertStmtAtEnd(unrolled, fgNewStmtFromTree(unrolledTrees.Bottom(i)));
+        }
+
+        // while (limit - i >= factor);
+        left  = gtNewOperNode(GT_SUB, TYP_INT, gtCloneExpr(limit), gtNewLclvNode(iterVar, TYP_INT));
+        relop = gtNewOperNode(GT_GE, TYP_INT, left, gtNewIconNode(factor));
+        fgInsertStmtAtEnd(unrolled, fgNewStmtFromTree(gtNewOperNode(GT_JTRUE, TYP_VOID, relop)));
+
+        // if (i >= limit) goto exit;
+        relop = gtNewOperNode(GT_GE, TYP_INT, gtNewLclvNode(iterVar, TYP_INT), gtCloneExpr(limit));
+        fgInsertStmtAtEnd(remainderTest, fgNewStmtFromTree(gtNewOperNode(GT_JTRUE, TYP_VOID, relop)));
+
+        for (BasicBlock* test : testBlocks)
+        {
+            fgMorphBlockStmt(test, test->lastStmt() DEBUGARG("Partial unrolling test"));
+        }
+
+        // The loop table entry now describes the unrolled loop. The iterator
+        // now steps by more than one per iteration, so drop it.
+        loop.lpHead    = countTest;
+        loop.lpFirst   = unrolled;
+        loop.lpTop     = unrolled;
+        loop.lpEntry   = unrolled;
+        loop.lpBottom  = unrolled;
+        loop.lpExit    = unrolled;
+        loop.lpExitCnt = 1;
+        loop.lpFlags &= ~(LPFLG_ITER | LPFLG_HOISTABLE | LPFLG_CONST | LPFLG_VAR_INIT | LPFLG_CONST_INIT |
+                          LPFLG_VAR_LIMIT | LPFLG_CONST_LIMIT | LPFLG_ARRLEN_LIMIT | LPFLG_SIMD_LIMIT |
+                          LPFLG_HAS_PREHEAD);
+        loop.lpFlags |= LPFLG_ONE_EXIT | LPFLG_DONT_UNROLL;
+
+        change = true;
+    }
+
+    if (change)
+    {
+        fgUpdateChangedFlowGraph();
+    }
+}
+
+//------------------------------------------------------------------------
+// optIsBlockLoopElemAccess: Check whether a tree is an access to the element
+//    of an array indexed by a loop iterator that can be extended to the
+//    remaining iterations of the loop.
+//
+// Arguments:
+//    tree     - the location of a store or the value of a load
+//    iterVar  - the loop iterator variable
+//    limit    - the loop limit tree
+//    pAddr    - [out] the address of the element
+//    pArrLcl  - [out] the array local
+//    pOffset  - [out] the offset of the first array element
+//
+// Return Value:
+//    true if "tree" is "arr[iterVar]" for a local array "arr" and primitive
+//    non-GC element type, and all the elements up to "limit" are known to be
+//    in bounds once the first one is. That is the case when the bounds check
+//    was removed by loop cloning, or when "limit" is the array length.
+//
+// Notes:
+//    The address shape matched here is created by fgMorphArrayIndex, see
+//    also optExtractArrIndex.
+
+bool Compiler::optIsBlockLoopElemAccess(
+    GenTree* tree, unsigned iterVar, GenTree* limit, GenTree** pAddr, unsigned* pArrLcl, ssize_t* pOffset)
+{
+    GenTree* check = nullptr;
+
+    if (tree->OperIs(GT_COMMA))
+    {
+        check = tree->gtGetOp1();
+        tree  = tree->gtGetOp2();
+    }
+
+    if (!tree->OperIs(GT_IND) || varTypeIsStruct(tree) || varTypeIsGC(tree) || varTypeIsFloating(tree) ||
+        ((tree->gtFlags & GTF_IND_VOLATILE) != 0))
+    {
+        return false;
+    }
+
+    // addr = arr + (index << scale + offset)
+    GenTree* addr = tree->gtGetOp1();
+    if (!addr->OperIs(GT_ADD) || !addr->gtGetOp1()->OperIs(GT_LCL_VAR) || !addr->gtGetOp2()->OperIs(GT_ADD))
+    {
+        return false;
+    }
+
+    GenTree* arr = addr->gtGetOp1();
+    GenTree* sio = addr->gtGetOp2();
+    GenTree* si  = sio->gtGetOp1();
+    GenTree* ofs = sio->gtGetOp2();
+
+    if (!arr->TypeIs(TYP_REF) || !ofs->IsCnsIntOrI())
+    {
+        return false;
+    }
+
+    unsigned elemSize = 1;
+    if (si->OperIs(GT_LSH))
+    {
+        if (!si->gtGetOp2()->IsCnsIntOrI())
+        {
+            return false;
+        }
+        elemSize = 1U << si->gtGetOp2()->AsIntCon()->gtIconVal;
+        si       = si->gtGetOp1();
+    }
+
+    if (elemSize != genTypeSize(tree->TypeGet()))
+    {
+        return false;
+    }
+
+#ifdef _TARGET_64BIT_
+    if (!si->OperIs(GT_CAST) || si->gtOverflow())
+    {
+        return false;
+    }
+    si = si->AsCast()->CastOp();
+#endif
+
+    if (!si->OperIs(GT_LCL_VAR) || (si->AsLclVarCommon()->GetLclNum() != iterVar))
+    {
+        return false;
+    }
+
+    const unsigned arrLcl = arr->AsLclVarCommon()->GetLclNum();
+
+    if ((check != nullptr) && !check->IsNothingNode())
+    {
+        // The iterator only grows, so a bounds check that passed for the first
+        // element can only fail for a later one if the limit isn't the length
+        // of this very array.
+        if (!check->OperIs(GT_ARR_BOUNDS_CHECK))
+        {
+            return false;
+        }
+
+        GenTreeBoundsChk* bndsChk = check->AsBoundsChk();
+        if (!bndsChk->gtIndex->OperIs(GT_LCL_VAR) || (bndsChk->gtIndex->AsLclVarCommon()->GetLclNum() != iterVar) ||
+            !bndsChk->gtArrLen->OperIs(GT_ARR_LENGTH) || !GenTree::Compare(bndsChk->gtArrLen, limit))
+        {
+            return false;
+        }
+
+        GenTree* lenArr = limit->AsArrLen()->ArrRef();
+        if (!lenArr->OperIs(GT_LCL_VAR) || (lenArr->AsLclVarCommon()->GetLclNum() != arrLcl))
+        {
+            return false;
+        }
+    }
+
+    *pAddr   = addr;
+    *pArrLcl = arrLcl;
+    *pOffset = ofs->AsIntConCommon()->IconValue();
+    return true;
+}
+
+//------------------------------------------------------------------------
+// optReplaceLoopsWithBlockOps: Replace simple counted loops that fill or
+//    copy arrays with block operations.
+//
+// Notes:
+//    Looks for single block loops of the form
+//
+//        do { a[i] = c;    i++; } while (i < limit);
+//        do { a[i] = b[i]; i++; } while (i < limit);
+//
+//    The loop body is kept for the first iteration, so any exception it
+//    throws is still thrown at the same point, and the remaining iterations
+//    are done by init or copy block operations:
+//
+//        a[i] = c; i++; if (i < limit) { initblk(&a[i], c, (limit - i) * size); i = limit; }
+//
+//    Block operations with a variable size are done by the memset/memcpy
+//    helpers, which are vectorized. The helpers are not GC interruptible, so
+//    large blocks are split into 64KB chunks with a GC safe back edge between
+//    them, see below.
+//    Loops over GC refs are not handled since the helpers may tear them.
+
+void Compiler::optReplaceLoopsWithBlockOps()
+{
+    if (optLoopCount == 0)
+    {
+        return;
+    }
+
+#ifdef DEBUG
+    if (JitConfig.JitLoopBlockOps() == 0)
+    {
+        return;
+    }
+#endif
+
+    JITDUMP("\n*************** In optReplaceLoopsWithBlockOps()\n");
+
+    bool change = false;
+
+    for (unsigned lnum = 0; lnum < optLoopCount; lnum++)
+    {
+        LoopDsc& loop = optLoopTable[lnum];
+
+        const unsigned requiredFlags = LPFLG_DO_WHILE | LPFLG_ITER;
+        if (((loop.lpFlags & requiredFlags) != requiredFlags) || ((loop.lpFlags & LPFLG_REMOVED) != 0))
+        {
+            continue;
+        }
+
+        BasicBlock* block = loop.lpTop;
+        if ((block != loop.lpBottom) || (block != loop.lpEntry) || (block->bbJumpKind != BBJ_COND) ||
+            (block->bbJumpDest != block) || (block->bbNext == nullptr))
+        {
+            continue;
+        }
+
+        // The iterator must count up by one to a limit that doesn't change in the loop.
+        const unsigned iterVar = loop.lpIterVar();
+        GenTree*       incr    = loop.lpIterTree->gtGetOp2();
+        if ((loop.lpIterOper() != GT_ADD) || (loop.lpIterConst() != 1) || incr->gtOverflow() ||
+            (loop.lpIterOperType() != TYP_INT) || lvaTable[iterVar].lvAddrExposed ||
+            lvaTable[iterVar].lvIsStructField)
+        {
+            continue;
+        }
+
+        GenTree* test  = loop.lpTestTree;
+        GenTree* limit = loop.lpLimit();
+        if (loop.lpIsReversed() || !test->OperIs(GT_LT) || ((test->gtFlags & GTF_UNSIGNED) != 0) ||
+            ((loop.lpFlags & (LPFLG_CONST_LIMIT | LPFLG_VAR_LIMIT | LPFLG_ARRLEN_LIMIT)) == 0))
+        {
+            continue;
+        }
+
+        if (limit->OperIs(GT_ARR_LENGTH) && !limit->AsArrLen()->ArrRef()->OperIs(GT_LCL_VAR))
+        {
+            continue;
+        }
+
+        // The body must be the store, the increment and the test.
+        Statement* storeStmt = block->firstStmt();
+        Statement* incrStmt  = (storeStmt != nullptr) ? storeStmt->GetNextStmt() : nullptr;
+        Statement* testStmt  = (incrStmt != nullptr) ? incrStmt->GetNextStmt() : nullptr;
+        if ((testStmt == nullptr) || (testStmt->GetNextStmt() != nullptr) ||
+            (incrStmt->GetRootNode() != loop.lpIterTree) || !testStmt->GetRootNode()->OperIs(GT_JTRUE) ||
+            (testStmt->GetRootNode()->gtGetOp1() != test))
+        {
+            continue;
+        }
+
+        GenTree* store = storeStmt->GetRootNode();
+        if (!store->OperIs(GT_ASG) || ((store->gtFlags & GTF_CALL) != 0))
+        {
+            continue;
+        }
+
+        GenTree* dstAddr;
+        unsigned dstLcl;
+        ssize_t  dstOffset;
+        if (!optIsBlockLoopElemAccess(store->gtGetOp1(), iterVar, limit, &dstAddr, &dstLcl, &dstOffset) ||
+            (dstLcl == iterVar))
+        {
+            continue;
+        }
+
+        GenTree*  dst       = store->gtGetOp1();
+        var_types elemType  = (dst->OperIs(GT_COMMA) ? dst->gtGetOp2() : dst)->TypeGet();
+        GenTree*  value     = store->gtGetOp2();
+        GenTree*  srcAddr   = nullptr;
+        GenTree*  fillValue = nullptr;
+
+        if (value->IsIntegralConst(0))
+        {
+            fillValue = gtNewIconNode(0);
+        }
+        else if ((genTypeSize(elemType) == 1) && value->IsCnsIntOrI())
+        {
+            fillValue = gtNewIconNode(value->AsIntCon()->gtIconVal & 0xFF);
+        }
+        else
+        {
+            unsigned srcLcl;
+            ssize_t  srcOffset;
+            GenTree* load = value->OperIs(GT_COMMA) ? value->gtGetOp2() : value;
+            if ((genTypeSize(load) != genTypeSize(elemType)) ||
+                !optIsBlockLoopElemAccess(value, iterVar, limit, &srcAddr, &srcLcl, &srcOffset) ||
+                (srcLcl == iterVar) || (srcOffset != dstOffset))
+            {
+                continue;
+            }
+        }
+
+        BasicBlock* exit = block->bbNext;
+
+        JITDUMP("Replacing loop L%02u (" FMT_BB ") over V%02u with a block %s\n", lnum, block->bbNum, iterVar,
+                (srcAddr == nullptr) ? "init" : "copy");
+
+        // Keep the first iteration and leave the loop when it was the only one.
+        test->SetOper(GenTree::ReverseRelop(test->OperGet()));
+        block->bbJumpDest = exit;
+        block->bbFlags &= ~(BBF_NEEDS_GCPOLL | BBF_LOOP_HEAD);
+        block->modifyBBWeight(block->bbWeight / BB_LOOP_WEIGHT);
+        block->bbNatLoopNum = loop.lpParent;
+
+        // The memset/memcpy helpers can't be interrupted by the GC so the remaining elements
+        // are done in chunks of at most loopBlockOpChunkSize bytes, with a loop back edge
+        // between chunks. That back edge makes the method fully interruptible or gets a GC
+        // poll, same as the original loop's back edge did.
+        //
+        //     chunkTest: if (limit - i <= chunkCount) goto last;
+        //     chunk:     do { blk(&a[i], chunkCount); i += chunkCount; } while (limit - i > chunkCount);
+        //     last:      blk(&a[i], limit - i); i = limit;
+        //
+        // i < limit here so limit - i can't overflow.
+
+        const unsigned loopBlockOpChunkSize = 64 * 1024;
+        const unsigned elemSize             = genTypeSize(elemType);
+        const int      chunkCount           = static_cast<int>(loopBlockOpChunkSize / elemSize);
+
+        BasicBlock* chunkTest = fgNewBBafter(BBJ_COND, block, /* extendRegion */ true);
+        BasicBlock* chunk     = fgNewBBafter(BBJ_COND, chunkTest, /* extendRegion */ true);
+        BasicBlock* last      = fgNewBBafter(BBJ_NONE, chunk, /* extendRegion */ true);
+        assert(last->bbNext == exit);
+
+        chunkTest->bbJumpDest = last;
+        chunk->bbJumpDest     = chunk;
+
+        BasicBlock* const newBlocks[] = {chunkTest, chunk, last};
+        for (BasicBlock* newBlock : newBlocks)
+        {
+            newBlock->inheritWeight(block);
+            newBlock->bbNatLoopNum = loop.lpParent;
+        }
+
+        chunk->bbFlags |= BBF_LOOP_HEAD;
+        if (opts.compGCPollType != GCPOLL_NONE)
+        {
+            chunk->bbFlags |= BBF_NEEDS_GCPOLL;
+        }
+
+        auto newBlkOp = [&](GenTree* count) {
+#ifdef _TARGET_64BIT_
+            count = gtNewCastNode(TYP_LONG, count, true, TYP_LONG);
+#endif
+            GenTree* size = count;
+            if (elemSize > 1)
+            {
+                size = gtNewOperNode(GT_MUL, TYP_I_IMPL, size, gtNewIconNode(elemSize, TYP_I_IMPL));
+            }
+
+            GenTree* blkOp = new (this, GT_DYN_BLK) GenTreeDynBlk(gtCloneExpr(dstAddr), size);
+            if (srcAddr == nullptr)
+            {
+                return gtNewBlkOpNode(blkOp, gtCloneExpr(fillValue), 0, false, false);
+            }
+
+            return gtNewBlkOpNode(blkOp, gtNewOperNode(GT_IND, TYP_STRUCT, gtCloneExpr(srcAddr)), 0, false, true);
+        };
+
+        auto newLeft = [&]() {
+            return gtNewOperNode(GT_SUB, TYP_INT, gtCloneExpr(limit), gtNewLclvNode(iterVar, TYP_INT));
+        };
+
+        auto appendStmt = [&](BasicBlock* newBlock, GenTree* tree) {
+            Statement* stmt = fgNewStmtFromTree(tree);
+            fgInsertStmtAtEnd(newBlock, stmt);
+            fgMorphBlockStmt(newBlock, stmt DEBUGARG("Loop block op"));
+        };
+
+        // if (limit - i <= chunkCount) goto last;
+        GenTree* relop = gtNewOperNode(GT_LE, TYP_INT, newLeft(), gtNewIconNode(chunkCount));
+        appendStmt(chunkTest, gtNewOperNode(GT_JTRUE, TYP_VOID, relop));
+
+        // do { blk(&a[i], chunkCount); i += chunkCount; } while (limit - i > chunkCount);
+        appendStmt(chunk, newBlkOp(gtNewIconNode(chunkCount)));
+        GenTree* iterIncr = gtNewOperNode(GT_ADD, TYP_INT, gtNewLclvNode(iterVar, TYP_INT), gtNewIconNode(chunkCount));
+        appendStmt(chunk, gtNewAssignNode(gtNewLclvNode(iterVar, TYP_INT), iterIncr));
+        relop = gtNewOperNode(GT_GT, TYP_INT, newLeft(), gtNewIconNode(chunkCount));
+        appendStmt(chunk, gtNewOperNode(GT_JTRUE, TYP_VOID, relop));
+
+        // blk(&a[i], limit - i); i = limit;
+        appendStmt(last, newBlkOp(newLeft()));
+        appendStmt(last, gtNewAssignNode(gtNewLclvNode(iterVar, TYP_INT), gtCloneExpr(limit)));
+
+        loop.lpFlags |= LPFLG_REMOVED;
+        loop.lpHead = loop.lpBottom = nullptr;
+        change      = true;
+    }
+
+    if (change)
+    {
+        fgUpdateChangedFlowGraph();
+    }
+}
+
 /*****************************************************************************
  *
  *  Return false if there is a code path from 'topBB' to 'botBB' that might
@@ -7741,8 +8360,13 @@ void Compiler::optComputeLoopSideEffectsOfBlock(BasicBlock* blk)
                                 continue;
                             }
                         }
-                        // Otherwise...
-                        memoryHavoc |= memoryKindSet(GcHeap, ByrefExposed);
+                        // Otherwise, see where the byref was defined. Conservatively assume
+                        // that byrefs may alias anything else in any case.
+                        if (!optRecordLoopHeapStore(mostNestedLoop, arg))
+                        {
+                            memoryHavoc |= memoryKindSet(GcHeap);
+                        }
+                        memoryHavoc |= memoryKindSet(ByrefExposed);
                     }
                     // Is the LHS an array index expression?
                     else if (lhs->ParseArrayElemForm(this, &arrInfo, &fldSeqArrElem))
@@ -7756,41 +8380,39 @@ void Compiler::optComputeLoopSideEffectsOfBlock(BasicBlock* blk)
                     }
                     else
                     {
-                        // We are only interested in IsFieldAddr()'s fldSeq out parameter.
-                        //
-                        GenTree*      obj          = nullptr; // unused
-                        GenTree*      staticOffset = nullptr; // unused
-                        FieldSeqNode* fldSeq       = nullptr;
-
-                        if (arg->IsFieldAddr(this, &obj, &staticOffset, &fldSeq) &&
-                            (fldSeq != FieldSeqStore::NotAField()))
+                        if (!optRecordLoopHeapStore(mostNestedLoop, arg))
                         {
-                            // Get the first (object) field from field seq.  GcHeap[field] will yield the "field map".
-                            assert(fldSeq != nullptr);
-                            if (fldSeq->IsFirstElemFieldSeq())
-                            {
-                                fldSeq = fldSeq->m_next;
-                                assert(fldSeq != nullptr);
-                            }
-
-                            AddModifiedFieldAllContainingLoops(mostNestedLoop, fldSeq->m_fieldHnd);
-                            // Conservatively assume byrefs may alias this object.
-                            memoryHavoc |= memoryKindSet(ByrefExposed);
-                        }
-                        else
-                        {
-                            memoryHavoc |= memoryKindSet(GcHeap, ByrefExposed);
+                            memoryHavoc |= memoryKindSet(GcHeap);
                         }
+                        // Conservatively assume byrefs may alias this object.
+                        memoryHavoc |= memoryKindSet(ByrefExposed);
                     }
                 }
                 else if (lhs->OperIsBlk())
                 {
                     GenTreeLclVarCommon* lclVarTree;
                     bool                 isEntire;
+                    ArrayInfo            arrInfo;
+                    FieldSeqNode*        fldSeqArrElem = nullptr;
                     if (!tree->DefinesLocal(this, &lclVarTree, &isEntire))
                     {
-                        // For now, assume arbitrary side effects on GcHeap/ByrefExposed...
-                        memoryHavoc |= memoryKindSet(GcHeap, ByrefExposed);
+                        // Struct copies to fields and array elements only write the
+                        // location of their type, unlike block ops with a given size.
+                        if ((lhs->gtFlags & GTF_IND_VOLATILE) != 0)
+                        {
+                            memoryHavoc |= memoryKindSet(GcHeap);
+                        }
+                        else if (lhs->OperIs(GT_OBJ) && lhs->ParseArrayElemForm(this, &arrInfo, &fldSeqArrElem))
+                        {
+                            CORINFO_CLASS_HANDLE elemTypeEq =
+                                EncodeElemType(arrInfo.m_elemType, arrInfo.m_elemStructType);
+                            AddModifiedElemTypeAllContainingLoops(mostNestedLoop, elemTypeEq);
+                        }
+                        else if (!lhs->OperIs(GT_OBJ) || !optRecordLoopHeapStore(mostNestedLoop, lhs->AsObj()->Addr()))
+                        {
+                            memoryHavoc |= memoryKindSet(GcHeap);
+                        }
+                        memoryHavoc |= memoryKindSet(ByrefExposed);
                     }
                     else if (lvaVarAddrExposed(lclVarTree->GetLclNum()))
                     {
@@ -7931,6 +8553,112 @@ void Compiler::optComputeLoopSideEffectsOfBlock(BasicBlock* blk)
     }
 }
 
+//------------------------------------------------------------------------
+// optRecordLoopHeapStore: Record the GcHeap location written by a store in a loop.
+//
+// Arguments:
+//    lnum  - the innermost loop containing the store
+//    addr  - the address the store writes to
+//    depth - the number of byref local definitions followed to get to "addr"
+//
+// Return Value:
+//    true if the store was recorded as a modification of a particular field or
+//    array element type, or doesn't write GcHeap at all; false if the store has
+//    to be treated as GcHeap havoc.
+//
+// Notes:
+//    Byref locals are followed to their SSA definition, so stores through "ref"
+//    locals and inlined "ref" parameters that point to a field or an array element
+//    don't keep loads from unrelated fields and arrays from being hoisted.
+//
+bool Compiler::optRecordLoopHeapStore(unsigned lnum, GenTree* addr, unsigned depth)
+{
+    addr = addr->gtEffectiveVal(/* commaOnly */ true);
+
+    if (addr->OperIs(GT_ADDR))
+    {
+        GenTree* location = addr->AsOp()->gtOp1;
+
+        if (location->OperIsLocal())
+        {
+            // Only the local is written, ByrefExposed havoc covers it.
+            return true;
+        }
+
+        if (location->OperIs(GT_CLS_VAR))
+        {
+            AddModifiedFieldAllContainingLoops(lnum, location->AsClsVar()->gtClsVarHnd);
+            return true;
+        }
+
+        if (location->OperIs(GT_IND) && ((location->gtFlags & GTF_IND_ARR_INDEX) != 0))
+        {
+            ArrayInfo arrInfo;
+            bool      b = GetArrayInfoMap()->Lookup(location, &arrInfo);
+            assert(b);
+            AddModifiedElemTypeAllContainingLoops(lnum, EncodeElemType(arrInfo.m_elemType, arrInfo.m_elemStructType));
+            return true;
+        }
+
+        return false;
+    }
+
+    if (addr->OperIs(GT_LCL_VAR))
+    {
+        const unsigned lclNum = addr->AsLclVar()->GetLclNum();
+        if (!addr->TypeIs(TYP_BYREF) || !lvaInSsa(lclNum) || (depth >= 2))
+        {
+            return false;
+        }
+
+        // Parameters and live-in locals have no definition tree.
+        GenTree* defLcl = lvaTable[lclNum].GetPerSsaData(addr->AsLclVar()->GetSsaNum())->m_defLoc.m_tree;
+        if (defLcl == nullptr)
+        {
+            return false;
+        }
+
+        GenTree* defParent = defLcl->gtGetParent(nullptr);
+        if ((defParent == nullptr) || !defParent->OperIs(GT_ASG) || (defParent->gtGetOp1() != defLcl))
+        {
+            return false;
+        }
+
+        return optRecordLoopHeapStore(lnum, defParent->gtGetOp2(), depth + 1);
+    }
+
+    ArrayInfo     arrInfo;
+    FieldSeqNode* fldSeq = nullptr;
+
+    if (addr->ParseArrayElemAddrForm(this, &arrInfo, &fldSeq))
+    {
+        AddModifiedElemTypeAllContainingLoops(lnum, EncodeElemType(arrInfo.m_elemType, arrInfo.m_elemStructType));
+        return true;
+    }
+
+    // We are only interested in IsFieldAddr()'s fldSeq out parameter.
+    //
+    GenTree* obj          = nullptr; // unused
+    GenTree* staticOffset = nullptr; // unused
+    fldSeq                = nullptr;
+
+    if (addr->IsFieldAddr(this, &obj, &staticOffset, &fldSeq) && (fldSeq != FieldSeqStore::NotAField()))
+    {
+        // Get the first (object) field from field seq.  GcHeap[field] will yield the "field map".
+        assert(fldSeq != nullptr);
+        if (fldSeq->IsFirstElemFieldSeq())
+        {
+            fldSeq = fldSeq->m_next;
+            assert(fldSeq != nullptr);
+        }
+
+        AddModifiedFieldAllContainingLoops(lnum, fldSeq->m_fieldHnd);
+        return true;
+    }
+
+    return false;
+}
+
 // Marks the containsCall information to "lnum" and any parent loops.
 void Compiler::AddContainsCallAllContainingLoops(unsigned lnum)
 {
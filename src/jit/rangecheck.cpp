@@ -876,7 +876,14 @@ Range RangeCheck::ComputeRangeForLocalDef(BasicBlock*          block,
 // I believe practical limits are still smaller than this number.
 #define ARRLEN_MAX (0x7FFFFFFF)
 
-// Get the limit's maximum possible value, treating array length to be ARRLEN_MAX.
+// The runtime doesn't allocate arrays with more than 0x7FFFFFC7 elements (see MaxArrayLength
+// in gchelpers.cpp). Other checked bounds, like the length of a span, can be up to ARRLEN_MAX.
+// Using the smaller limit for real arrays lets the overflow check accept strided induction
+// variables like "i += 2" in loops bounded by "i < a.Length".
+#define NEWARR_LEN_MAX (0x7FFFFFC7)
+
+// Get the limit's maximum possible value, treating array length to be NEWARR_LEN_MAX
+// and other bounds to be ARRLEN_MAX.
 bool RangeCheck::GetLimitMax(Limit& limit, int* pMax)
 {
     int& max1 = *pMax;
@@ -891,7 +898,7 @@ bool RangeCheck::GetLimitMax(Limit& limit, int* pMax)
             int tmp = GetArrLength(limit.vn);
             if (tmp <= 0)
             {
-                tmp = ARRLEN_MAX;
+                tmp = m_pCompiler->vnStore->IsVNArrLen(limit.vn) ? NEWARR_LEN_MAX : ARRLEN_MAX;
             }
             if (IntAddOverflows(tmp, limit.GetConstant()))
             {
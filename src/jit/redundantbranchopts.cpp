@@ -0,0 +1,250 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+// See the LICENSE file in the project root for more information.
+
+#include "jitpch.h"
+#ifdef _MSC_VER
+#pragma hdrstop
+#endif
+
+//------------------------------------------------------------------------
+// optRedundantBranches: try and optimize redundant conditional branches
+//    in the method
+//
+// Notes:
+//    A conditional branch is redundant if a dominating block ends with a
+//    compare that has the same (or the reversed) value number and the
+//    branch can only be reached from one of the dominating block's
+//    successors. Such branches are folded, fgUpdateFlowGraph cleans up
+//    the blocks that become unreachable.
+//
+void Compiler::optRedundantBranches()
+{
+    bool madeChanges = false;
+
+    for (BasicBlock* block = fgFirstBB; block != nullptr; block = block->bbNext)
+    {
+        // Skip over any removed blocks.
+        if ((block->bbFlags & BBF_REMOVED) != 0)
+        {
+            continue;
+        }
+
+        if (block->bbJumpKind == BBJ_COND)
+        {
+            madeChanges |= optRedundantBranch(block);
+        }
+    }
+
+    if (madeChanges)
+    {
+        fgModified = true;
+    }
+}
+
+//------------------------------------------------------------------------
+// optRedundantBranch: try and optimize a possibly redundant branch
+//
+// Arguments:
+//   block - block with branch to optimize
+//
+// Returns:
+//   True if the branch was optimized.
+//
+bool Compiler::optRedundantBranch(BasicBlock* const block)
+{
+    Statement* const stmt = block->lastStmt();
+
+    if (stmt == nullptr)
+    {
+        return false;
+    }
+
+    GenTree* const jumpTree = stmt->GetRootNode();
+
+    if (!jumpTree->OperIs(GT_JTRUE))
+    {
+        return false;
+    }
+
+    GenTree* const tree = jumpTree->AsOp()->gtOp1;
+
+    if (!tree->OperIsCompare())
+    {
+        return false;
+    }
+
+    // The operands are discarded when the branch is folded, so they must
+    // not have side effects.
+    if ((tree->gtFlags & GTF_SIDE_EFFECT) != 0)
+    {
+        return false;
+    }
+
+    const ValueNum treeVN = vnStore->VNConservativeNormalValue(tree->gtVNPair);
+
+    if ((treeVN == ValueNumStore::NoVN) || vnStore->IsVNConstant(treeVN))
+    {
+        return false;
+    }
+
+    VNFuncApp treeApp;
+    bool      treeIsFunc = vnStore->GetVNFunc(treeVN, &treeApp) && (treeApp.m_arity == 2);
+
+    // Walk up the dom tree looking for a compare that determines this one.
+    for (BasicBlock* domBlock = block->bbIDom; domBlock != nullptr; domBlock = domBlock->bbIDom)
+    {
+        if (domBlock->bbJumpKind != BBJ_COND)
+        {
+            continue;
+        }
+
+        Statement* const domStmt = domBlock->lastStmt();
+        GenTree* const   domTree = domStmt->GetRootNode()->AsOp()->gtOp1;
+
+        if (!domTree->OperIsCompare())
+        {
+            continue;
+        }
+
+        const ValueNum domVN = vnStore->VNConservativeNormalValue(domTree->gtVNPair);
+
+        // The dominating compare either has the same value, or the opposite one
+        // if it is the reversed equality compare of the same operands.
+        bool reversed = false;
+
+        if (domVN != treeVN)
+        {
+            VNFuncApp domApp;
+
+            if (!treeIsFunc || !vnStore->GetVNFunc(domVN, &domApp) || (domApp.m_arity != 2) ||
+                (domApp.m_args[0] != treeApp.m_args[0]) || (domApp.m_args[1] != treeApp.m_args[1]))
+            {
+                continue;
+            }
+
+            if (!(((treeApp.m_func == VNFunc(GT_EQ)) && (domApp.m_func == VNFunc(GT_NE))) ||
+                  ((treeApp.m_func == VNFunc(GT_NE)) && (domApp.m_func == VNFunc(GT_EQ)))))
+            {
+                continue;
+            }
+
+            reversed = true;
+        }
+
+        BasicBlock* const trueSuccessor  = domBlock->bbJumpDest;
+        BasicBlock* const falseSuccessor = domBlock->bbNext;
+
+        if (trueSuccessor == falseSuccessor)
+        {
+            continue;
+        }
+
+        // If the block can only be reached from one of the successors without
+        // evaluating the dominating compare again, the outcome is known.
+        const bool trueReaches  = optReachable(trueSuccessor, block, domBlock);
+        const bool falseReaches = optReachable(falseSuccessor, block, domBlock);
+
+        if (trueReaches == falseReaches)
+        {
+            // Either both paths lead here, or the walk gave up. A block
+            // further up the dom tree won't know more about this compare.
+            return false;
+        }
+
+        const bool relopIsTrue = trueReaches != reversed;
+
+        JITDUMP("\nDominator " FMT_BB " of " FMT_BB " has a relop with %s VN\n", domBlock->bbNum, block->bbNum,
+                reversed ? "the reversed" : "the same");
+        DISPTREE(domTree);
+        JITDUMP(" Redundant compare; current relop:\n");
+        DISPTREE(tree);
+        JITDUMP(FMT_BB " can only be reached via the %s edge, so the compare is %s\n", block->bbNum,
+                trueReaches ? "true" : "false", relopIsTrue ? "true" : "false");
+
+        // Transform the relop's operands to be both zeroes, like optVNConstantPropOnJTrue,
+        // and let morph fold the branch.
+        ValueNum vnZero               = vnStore->VNZeroForType(TYP_INT);
+        tree->AsOp()->gtOp1           = gtNewIconNode(0);
+        tree->AsOp()->gtOp1->gtVNPair = ValueNumPair(vnZero, vnZero);
+        tree->AsOp()->gtOp2           = gtNewIconNode(0);
+        tree->AsOp()->gtOp2->gtVNPair = ValueNumPair(vnZero, vnZero);
+        tree->SetOper(relopIsTrue ? GT_EQ : GT_NE);
+
+        ValueNum vnResult = vnStore->VNForIntCon(relopIsTrue ? 1 : 0);
+        tree->gtVNPair    = ValueNumPair(vnResult, vnResult);
+
+        fgMorphBlockStmt(block, stmt DEBUGARG(__FUNCTION__));
+        return true;
+    }
+
+    return false;
+}
+
+//------------------------------------------------------------------------
+// optReachable: see if there's a path from one block to another,
+//    not passing through a given block.
+//
+// Arguments:
+//    fromBlock     - starting block
+//    toBlock       - ending block
+//    excludedBlock - ignore paths that flow through this block
+//
+// Returns:
+//    true if there is a path, or if the walk was too expensive to finish;
+//    false if there is no such path.
+//
+// Notes:
+//    Exceptional flow is taken into account.
+//
+bool Compiler::optReachable(BasicBlock* const fromBlock, BasicBlock* const toBlock, BasicBlock* const excludedBlock)
+{
+    if (fromBlock == toBlock)
+    {
+        return true;
+    }
+
+    if (fromBlock == excludedBlock)
+    {
+        return false;
+    }
+
+    // Bound the cost of the walk, we're called for each pair of blocks.
+    const unsigned maxVisits = 1000;
+    unsigned       visits    = 0;
+
+    BitVecTraits traits(fgBBNumMax + 1, this);
+    BitVec       visited(BitVecOps::MakeEmpty(&traits));
+
+    ArrayStack<BasicBlock*> stack(getAllocator(CMK_ArrayStack));
+    stack.Push(fromBlock);
+    BitVecOps::AddElemD(&traits, visited, fromBlock->bbNum);
+
+    while (!stack.Empty())
+    {
+        BasicBlock* const nextBlock = stack.Pop();
+
+        if (++visits > maxVisits)
+        {
+            return true;
+        }
+
+        for (BasicBlock* succ : nextBlock->GetAllSuccs(this))
+        {
+            if (succ == toBlock)
+            {
+                return true;
+            }
+
+            if ((succ == excludedBlock) || BitVecOps::IsMember(&traits, visited, succ->bbNum))
+            {
+                continue;
+            }
+
+            BitVecOps::AddElemD(&traits, visited, succ->bbNum);
+            stack.Push(succ);
+        }
+    }
+
+    return false;
+}
@@ -215,6 +215,8 @@ typedef unsigned char   regNumberSmall;
 
   #define CPBLK_UNROLL_LIMIT       64      // Upper bound to let the code generator to loop unroll CpBlk.
   #define INITBLK_UNROLL_LIMIT     128     // Upper bound to let the code generator to loop unroll InitBlk.
+  #define CPBLK_AVX_UNROLL_LIMIT   256     // Upper bound to unroll CpBlk when 32 byte AVX moves are available.
+  #define INITBLK_AVX_UNROLL_LIMIT 256     // Upper bound to unroll InitBlk when 32 byte AVX stores are available.
   #define CPOBJ_NONGC_SLOTS_LIMIT  4       // For CpObj code generation, this is the the threshold of the number 
                                            // of contiguous non-gc slots that trigger generating rep movsq instead of 
                                            // sequences of movsq instructions
@@ -494,6 +496,8 @@ typedef unsigned char   regNumberSmall;
 
   #define CPBLK_UNROLL_LIMIT       64      // Upper bound to let the code generator to loop unroll CpBlk.
   #define INITBLK_UNROLL_LIMIT     128     // Upper bound to let the code generator to loop unroll InitBlk.
+  #define CPBLK_AVX_UNROLL_LIMIT   256     // Upper bound to unroll CpBlk when 32 byte AVX moves are available.
+  #define INITBLK_AVX_UNROLL_LIMIT 256     // Upper bound to unroll InitBlk when 32 byte AVX stores are available.
   #define CPOBJ_NONGC_SLOTS_LIMIT  4       // For CpObj code generation, this is the the threshold of the number 
                                            // of contiguous non-gc slots that trigger generating rep movsq instead of 
                                            // sequences of movsq instructions
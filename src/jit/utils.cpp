@@ -1432,6 +1432,8 @@ void HelperCallProperties::init()
 
             case CORINFO_HELP_DBG_IS_JUST_MY_CODE:
             case CORINFO_HELP_BBT_FCN_ENTER:
+            case CORINFO_HELP_CLASSPROFILE:
+            case CORINFO_HELP_PATCHPOINT:
             case CORINFO_HELP_POLL_GC:
             case CORINFO_HELP_MON_ENTER:
             case CORINFO_HELP_MON_EXIT:
@@ -146,6 +146,15 @@ public:
     --*/
     void *AllocateMemoryWithinRange(const void *beginAddress, const void *endAddress, SIZE_T allocationSize);
 
+    /*++
+    Function:
+        IsInHugePageRange
+
+        This function returns true if the reserved memory range was marked for transparent huge pages
+        and the specified memory lies within it.
+    --*/
+    bool IsInHugePageRange(const void *address, SIZE_T size);
+
 private:
     /*++
     Function:
@@ -191,6 +200,9 @@ private:
 
     // Remaining size of the reserved virtual memory that can be used to satisfy allocation requests.
     int32_t m_remainingReservedMemory;
+
+    // True if the reserved virtual memory was marked for transparent huge pages.
+    bool m_useHugePages;
 };
 
 #endif // __cplusplus
@@ -14,6 +14,7 @@
 
 #ifdef JITDUMP_SUPPORTED
 
+#include <errno.h>
 #include <fcntl.h>
 #include <pthread.h>
 #include <stdint.h>
@@ -22,6 +23,7 @@
 #include <sys/mman.h>
 #include <sys/types.h>
 #include <sys/stat.h>
+#include <sys/uio.h>
 #include <sys/syscall.h>
 #include <time.h>
 #include <unistd.h>
@@ -246,29 +248,50 @@ exit:
             if (!enabled)
                 goto exit;
 
-            // ToDo write debugInfo and unwindInfo immediately before the JitCodeLoadRecord (while lock is held).
-
             record.header.timestamp = GetTimeStampNS();
 
-            result = write(fd, &record, sizeof(JitCodeLoadRecord));
-
-            if (result == -1)
-                return FatalError(true);
-
-            result = write(fd, symbol, symbolLen + 1);
-
-            if (result == -1)
-                return FatalError(true);
-
-            result = write(fd, pCode, codeSize);
-
-            if (result == -1)
-                return FatalError(true);
-
-            result = fsync(fd);
-
-            if (result == -1)
-                return FatalError(true);
+            {
+                // Write the whole record with a single system call. Records are appended while the process
+                // runs and only need to be durable once the file is closed in Finish(), so there's no need
+                // to sync the file on this path.
+                struct iovec items[] = {
+                    // ToDo insert debugInfo and unwindInfo records immediately before the JitCodeLoadRecord.
+                    { &record, sizeof(JitCodeLoadRecord) },
+                    { (void *)symbol, symbolLen + 1 },
+                    { pCode, codeSize },
+                };
+                size_t itemsCount = sizeof(items) / sizeof(items[0]);
+                size_t itemsWritten = 0;
+                size_t bytesRemaining = record.header.total_size;
+
+                while (true)
+                {
+                    ssize_t written = writev(fd, items + itemsWritten, itemsCount - itemsWritten);
+
+                    if (written == -1)
+                    {
+                        if (errno == EINTR)
+                            continue;
+
+                        return FatalError(true);
+                    }
+
+                    if ((size_t)written == bytesRemaining)
+                        break;
+
+                    _ASSERTE((written > 0) && ((size_t)written < bytesRemaining));
+
+                    // Handle a partial write by skipping over the items (and the part of an item) already written
+                    bytesRemaining -= written;
+                    while ((size_t)written >= items[itemsWritten].iov_len)
+                    {
+                        written -= items[itemsWritten].iov_len;
+                        itemsWritten++;
+                    }
+                    items[itemsWritten].iov_base = (char *)items[itemsWritten].iov_base + written;
+                    items[itemsWritten].iov_len -= written;
+                }
+            }
 
 exit:
             result = pthread_mutex_unlock(&mutex);
@@ -204,15 +204,19 @@ VirtualAllocExNuma(
 #if HAVE_NUMA_H
             if (result != NULL && g_numaAvailable)
             {
+                const int bitsPerNodeMaskWord = sizeof(unsigned long) * 8;
                 int usedNodeMaskBits = g_highestNumaNode + 1;
-                int nodeMaskLength = (usedNodeMaskBits + sizeof(unsigned long) - 1) / sizeof(unsigned long);
+                int nodeMaskLength = (usedNodeMaskBits + bitsPerNodeMaskWord - 1) / bitsPerNodeMaskWord;
                 unsigned long nodeMask[nodeMaskLength];
                 memset(nodeMask, 0, sizeof(nodeMask));
 
-                int index = nndPreferred / sizeof(unsigned long);
-                nodeMask[index] = ((unsigned long)1) << (nndPreferred & (sizeof(unsigned long) - 1));
+                int index = nndPreferred / bitsPerNodeMaskWord;
+                nodeMask[index] = ((unsigned long)1) << (nndPreferred % bitsPerNodeMaskWord);
 
-                int st = mbind(result, dwSize, MPOL_PREFERRED, nodeMask, usedNodeMaskBits, 0);
+                // The kernel only looks at the first maxnode - 1 bits of the mask, so pass one more than
+                // the number of bits we use. Otherwise the bit for the highest node is dropped and
+                // MPOL_PREFERRED with an empty mask silently turns into local allocation.
+                int st = mbind(result, dwSize, MPOL_PREFERRED, nodeMask, usedNodeMaskBits + 1, 0);
 
                 _ASSERTE(st == 0);
                 // If the mbind fails, we still return the allocated memory since the nndPreferred is just a hint
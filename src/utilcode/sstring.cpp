@@ -1569,11 +1569,15 @@ BOOL SString::Equals(const SString &s) const
     switch (GetRepresentation())
     {
     case REPRESENTATION_UNICODE:
-        RETURN (wcsncmp(GetRawUnicode(), source.GetRawUnicode(), count) == 0);
+        // The counts are known to match so try the (vectorized) memcmp first; only
+        // fall back to wcsncmp, which stops at an embedded null, on a mismatch.
+        RETURN ((memcmp(GetRawUnicode(), source.GetRawUnicode(), count * sizeof(WCHAR)) == 0)
+                || (wcsncmp(GetRawUnicode(), source.GetRawUnicode(), count) == 0));
 
     case REPRESENTATION_ASCII:
     case REPRESENTATION_ANSI:
-        RETURN (strncmp(GetRawASCII(), source.GetRawASCII(), count) == 0);
+        RETURN ((memcmp(GetRawASCII(), source.GetRawASCII(), count) == 0)
+                || (strncmp(GetRawASCII(), source.GetRawASCII(), count) == 0));
 
     case REPRESENTATION_EMPTY:
         RETURN TRUE;
@@ -157,6 +157,152 @@ endif
 LEAF_END_MARKED JIT_WriteBarrier_PostGrow64, _TEXT
 
 
+; See comments for JIT_WriteBarrier_PostGrow64 (above). Instead of dirtying the
+; whole card table byte, and with it the 8 cards that byte covers, this only sets
+; the bit for the card containing the destination so the GC has less to scan for
+; each cross generation store. Other threads may be setting bits in the same
+; byte so the update has to be interlocked.
+LEAF_ENTRY JIT_WriteBarrier_Precise_PostGrow64, _TEXT
+        align 8
+        ; Do the move into the GC .  It is correct to take an AV here, the EH code
+        ; figures out that this came from a WriteBarrier and correctly maps it back
+        ; to the managed method which called the WriteBarrier (see setup in
+        ; InitializeExceptionHandling, vm\exceptionhandling.cpp).
+        mov     [rcx], rdx
+
+        NOP_3_BYTE ; padding for alignment of constant
+
+PATCH_LABEL JIT_WriteBarrier_Precise_PostGrow64_Patch_Label_Lower
+        mov     rax, 0F0F0F0F0F0F0F0F0h
+
+        ; Check the lower and upper ephemeral region bounds
+        cmp     rdx, rax
+        jb      Exit
+
+        nop ; padding for alignment of constant
+
+PATCH_LABEL JIT_WriteBarrier_Precise_PostGrow64_Patch_Label_Upper
+        mov     r8, 0F0F0F0F0F0F0F0F0h
+
+        cmp     rdx, r8
+        jae     Exit
+
+        nop ; padding for alignment of constant
+
+PATCH_LABEL JIT_WriteBarrier_Precise_PostGrow64_Patch_Label_CardTable
+        mov     rax, 0F0F0F0F0F0F0F0F0h
+
+        ; Each card table byte covers 8 cards, compute the bit of ours
+        mov     r8, rcx
+        shr     ecx, 08h
+        and     ecx, 07h
+        mov     r9d, 1
+        shl     r9d, cl
+
+        ; Touch the card, if not already dirty.
+        shr     r8, 0Bh
+        test    byte ptr [r8 + rax], r9b
+        jz      UpdateCardTable
+        REPRET
+
+    UpdateCardTable:
+        lock or byte ptr [r8 + rax], r9b
+ifdef FEATURE_MANUALLY_MANAGED_CARD_BUNDLES
+        NOP_3_BYTE ; padding for alignment of constant
+PATCH_LABEL JIT_WriteBarrier_Precise_PostGrow64_Patch_Label_CardBundleTable
+        mov     rax, 0F0F0F0F0F0F0F0F0h
+        shr     r8, 0Ah
+        cmp     byte ptr [r8 + rax], 0FFh
+        jne     UpdateCardBundleTable
+        REPRET
+
+    UpdateCardBundleTable:
+        mov     byte ptr [r8 + rax], 0FFh
+endif
+        ret
+
+    align 16
+    Exit:
+        REPRET
+LEAF_END_MARKED JIT_WriteBarrier_Precise_PostGrow64, _TEXT
+
+
+; See comments for JIT_WriteBarrier_PostGrow64 (above). Generation 0 is always
+; condemned so objects in it never need their cards set. Workstation GC has a
+; single generation 0 range at the top of the ephemeral segment, so besides
+; checking the reference we also skip the card update if the destination lives
+; in [gen0 start, ephemeral high), which covers stores between young objects.
+LEAF_ENTRY JIT_WriteBarrier_Gen0Filter_PostGrow64, _TEXT
+        align 8
+        ; Do the move into the GC .  It is correct to take an AV here, the EH code
+        ; figures out that this came from a WriteBarrier and correctly maps it back
+        ; to the managed method which called the WriteBarrier (see setup in
+        ; InitializeExceptionHandling, vm\exceptionhandling.cpp).
+        mov     [rcx], rdx
+
+        NOP_3_BYTE ; padding for alignment of constant
+
+PATCH_LABEL JIT_WriteBarrier_Gen0Filter_PostGrow64_Patch_Label_Lower
+        mov     rax, 0F0F0F0F0F0F0F0F0h
+
+        ; Check the lower and upper ephemeral region bounds
+        cmp     rdx, rax
+        jb      Exit
+
+        nop ; padding for alignment of constant
+
+PATCH_LABEL JIT_WriteBarrier_Gen0Filter_PostGrow64_Patch_Label_Upper
+        mov     r8, 0F0F0F0F0F0F0F0F0h
+
+        cmp     rdx, r8
+        jae     Exit
+
+        nop ; padding for alignment of constant
+
+PATCH_LABEL JIT_WriteBarrier_Gen0Filter_PostGrow64_Patch_Label_Gen0Low
+        mov     rax, 0F0F0F0F0F0F0F0F0h
+
+        ; Nothing to do if the destination is in generation 0 as well
+        cmp     rcx, rax
+        jb      CheckCardTable
+        cmp     rcx, r8
+        jb      Exit
+
+    CheckCardTable:
+        NOP_3_BYTE ; padding for alignment of constant
+        nop
+
+PATCH_LABEL JIT_WriteBarrier_Gen0Filter_PostGrow64_Patch_Label_CardTable
+        mov     rax, 0F0F0F0F0F0F0F0F0h
+
+        ; Touch the card table entry, if not already dirty.
+        shr     rcx, 0Bh
+        cmp     byte ptr [rcx + rax], 0FFh
+        jne     UpdateCardTable
+        REPRET
+
+    UpdateCardTable:
+        mov     byte ptr [rcx + rax], 0FFh
+ifdef FEATURE_MANUALLY_MANAGED_CARD_BUNDLES
+        shr     rcx, 0Ah
+        NOP_2_BYTE ; padding for alignment of constant
+PATCH_LABEL JIT_WriteBarrier_Gen0Filter_PostGrow64_Patch_Label_CardBundleTable
+        mov     rax, 0F0F0F0F0F0F0F0F0h
+        cmp     byte ptr [rcx + rax], 0FFh
+        jne     UpdateCardBundleTable
+        REPRET
+
+    UpdateCardBundleTable:
+        mov     byte ptr [rcx + rax], 0FFh
+endif
+        ret
+
+    align 16
+    Exit:
+        REPRET
+LEAF_END_MARKED JIT_WriteBarrier_Gen0Filter_PostGrow64, _TEXT
+
+
 ifdef FEATURE_SVR_GC
 
 LEAF_ENTRY JIT_WriteBarrier_SVR64, _TEXT
@@ -202,6 +348,50 @@ endif
         ret
 LEAF_END_MARKED JIT_WriteBarrier_SVR64, _TEXT
 
+
+; See comments for JIT_WriteBarrier_SVR64 and JIT_WriteBarrier_Precise_PostGrow64 (above).
+LEAF_ENTRY JIT_WriteBarrier_Precise_SVR64, _TEXT
+        align 8
+        ; Do the move into the GC .  It is correct to take an AV here, the EH code
+        ; figures out that this came from a WriteBarrier and correctly maps it back
+        ; to the managed method which called the WriteBarrier (see setup in
+        ; InitializeExceptionHandling, vm\exceptionhandling.cpp).
+        mov     [rcx], rdx
+
+        NOP_3_BYTE ; padding for alignment of constant
+
+PATCH_LABEL JIT_WriteBarrier_Precise_SVR64_PatchLabel_CardTable
+        mov     rax, 0F0F0F0F0F0F0F0F0h
+
+        ; Each card table byte covers 8 cards, compute the bit of ours
+        mov     r8, rcx
+        shr     ecx, 08h
+        and     ecx, 07h
+        mov     r9d, 1
+        shl     r9d, cl
+
+        shr     r8, 0Bh
+        test    byte ptr [r8 + rax], r9b
+        jz      UpdateCardTable
+        REPRET
+
+    UpdateCardTable:
+        lock or byte ptr [r8 + rax], r9b
+ifdef FEATURE_MANUALLY_MANAGED_CARD_BUNDLES
+        NOP_3_BYTE ; padding for alignment of constant
+PATCH_LABEL JIT_WriteBarrier_Precise_SVR64_PatchLabel_CardBundleTable
+        mov     rax, 0F0F0F0F0F0F0F0F0h
+        shr     r8, 0Ah
+        cmp     byte ptr [r8 + rax], 0FFh
+        jne     UpdateCardBundleTable
+        REPRET
+
+    UpdateCardBundleTable:
+        mov     byte ptr [r8 + rax], 0FFh
+endif
+        ret
+LEAF_END_MARKED JIT_WriteBarrier_Precise_SVR64, _TEXT
+
 endif
 
 
@@ -19,6 +19,7 @@
 
 extern uint8_t* g_ephemeral_low;
 extern uint8_t* g_ephemeral_high;
+extern uint8_t* g_gen0_low;
 extern uint32_t* g_card_table;
 extern uint32_t* g_card_bundle_table;
 
@@ -42,6 +43,25 @@ EXTERN_C void JIT_WriteBarrier_PostGrow64_Patch_Label_CardBundleTable();
 #endif
 EXTERN_C void JIT_WriteBarrier_PostGrow64_End();
 
+EXTERN_C void JIT_WriteBarrier_Precise_PostGrow64(Object **dst, Object *ref);
+EXTERN_C void JIT_WriteBarrier_Precise_PostGrow64_Patch_Label_Lower();
+EXTERN_C void JIT_WriteBarrier_Precise_PostGrow64_Patch_Label_Upper();
+EXTERN_C void JIT_WriteBarrier_Precise_PostGrow64_Patch_Label_CardTable();
+#ifdef FEATURE_MANUALLY_MANAGED_CARD_BUNDLES
+EXTERN_C void JIT_WriteBarrier_Precise_PostGrow64_Patch_Label_CardBundleTable();
+#endif
+EXTERN_C void JIT_WriteBarrier_Precise_PostGrow64_End();
+
+EXTERN_C void JIT_WriteBarrier_Gen0Filter_PostGrow64(Object **dst, Object *ref);
+EXTERN_C void JIT_WriteBarrier_Gen0Filter_PostGrow64_Patch_Label_Lower();
+EXTERN_C void JIT_WriteBarrier_Gen0Filter_PostGrow64_Patch_Label_Upper();
+EXTERN_C void JIT_WriteBarrier_Gen0Filter_PostGrow64_Patch_Label_Gen0Low();
+EXTERN_C void JIT_WriteBarrier_Gen0Filter_PostGrow64_Patch_Label_CardTable();
+#ifdef FEATURE_MANUALLY_MANAGED_CARD_BUNDLES
+EXTERN_C void JIT_WriteBarrier_Gen0Filter_PostGrow64_Patch_Label_CardBundleTable();
+#endif
+EXTERN_C void JIT_WriteBarrier_Gen0Filter_PostGrow64_End();
+
 #ifdef FEATURE_SVR_GC
 EXTERN_C void JIT_WriteBarrier_SVR64(Object **dst, Object *ref);
 EXTERN_C void JIT_WriteBarrier_SVR64_PatchLabel_CardTable();
@@ -49,6 +69,13 @@ EXTERN_C void JIT_WriteBarrier_SVR64_PatchLabel_CardTable();
 EXTERN_C void JIT_WriteBarrier_SVR64_PatchLabel_CardBundleTable();
 #endif
 EXTERN_C void JIT_WriteBarrier_SVR64_End();
+
+EXTERN_C void JIT_WriteBarrier_Precise_SVR64(Object **dst, Object *ref);
+EXTERN_C void JIT_WriteBarrier_Precise_SVR64_PatchLabel_CardTable();
+#ifdef FEATURE_MANUALLY_MANAGED_CARD_BUNDLES
+EXTERN_C void JIT_WriteBarrier_Precise_SVR64_PatchLabel_CardBundleTable();
+#endif
+EXTERN_C void JIT_WriteBarrier_Precise_SVR64_End();
 #endif // FEATURE_SVR_GC
 
 #ifdef FEATURE_USE_SOFTWARE_WRITE_WATCH_FOR_GC_HEAP
@@ -90,7 +117,9 @@ WriteBarrierManager g_WriteBarrierManager;
 #define CALC_PATCH_LOCATION(func,label,offset)      CalculatePatchLocation((PVOID)func, (PVOID)func##_##label, offset)
 
 WriteBarrierManager::WriteBarrierManager() : 
-    m_currentWriteBarrier(WRITE_BARRIER_UNINITIALIZED)
+    m_currentWriteBarrier(WRITE_BARRIER_UNINITIALIZED),
+    m_usePreciseCardMarking(false),
+    m_useGen0Filter(false)
 {
     LIMITED_METHOD_CONTRACT;
 }
@@ -151,6 +180,44 @@ void WriteBarrierManager::Validate()
     pCardBundleTableImmediate  = CALC_PATCH_LOCATION(JIT_WriteBarrier_SVR64, PatchLabel_CardBundleTable, 2);
     _ASSERTE_ALL_BUILDS("clr/src/VM/AMD64/JITinterfaceAMD64.cpp", (reinterpret_cast<UINT64>(pCardBundleTableImmediate) & 0x7) == 0);
 #endif // FEATURE_MANUALLY_MANAGED_CARD_BUNDLES
+#endif // FEATURE_SVR_GC
+
+    pLowerBoundImmediate      = CALC_PATCH_LOCATION(JIT_WriteBarrier_Precise_PostGrow64, Patch_Label_Lower, 2);
+    pUpperBoundImmediate      = CALC_PATCH_LOCATION(JIT_WriteBarrier_Precise_PostGrow64, Patch_Label_Upper, 2);
+    pCardTableImmediate       = CALC_PATCH_LOCATION(JIT_WriteBarrier_Precise_PostGrow64, Patch_Label_CardTable, 2);
+    _ASSERTE_ALL_BUILDS("clr/src/VM/AMD64/JITinterfaceAMD64.cpp", (reinterpret_cast<UINT64>(pLowerBoundImmediate) & 0x7) == 0);
+    _ASSERTE_ALL_BUILDS("clr/src/VM/AMD64/JITinterfaceAMD64.cpp", (reinterpret_cast<UINT64>(pUpperBoundImmediate) & 0x7) == 0);
+    _ASSERTE_ALL_BUILDS("clr/src/VM/AMD64/JITinterfaceAMD64.cpp", (reinterpret_cast<UINT64>(pCardTableImmediate) & 0x7) == 0);
+
+#ifdef FEATURE_MANUALLY_MANAGED_CARD_BUNDLES
+    pCardBundleTableImmediate = CALC_PATCH_LOCATION(JIT_WriteBarrier_Precise_PostGrow64, Patch_Label_CardBundleTable, 2);
+    _ASSERTE_ALL_BUILDS("clr/src/VM/AMD64/JITinterfaceAMD64.cpp", (reinterpret_cast<UINT64>(pCardBundleTableImmediate) & 0x7) == 0);
+#endif
+
+    PBYTE pGen0LowImmediate;
+
+    pLowerBoundImmediate      = CALC_PATCH_LOCATION(JIT_WriteBarrier_Gen0Filter_PostGrow64, Patch_Label_Lower, 2);
+    pUpperBoundImmediate      = CALC_PATCH_LOCATION(JIT_WriteBarrier_Gen0Filter_PostGrow64, Patch_Label_Upper, 2);
+    pGen0LowImmediate         = CALC_PATCH_LOCATION(JIT_WriteBarrier_Gen0Filter_PostGrow64, Patch_Label_Gen0Low, 2);
+    pCardTableImmediate       = CALC_PATCH_LOCATION(JIT_WriteBarrier_Gen0Filter_PostGrow64, Patch_Label_CardTable, 2);
+    _ASSERTE_ALL_BUILDS("clr/src/VM/AMD64/JITinterfaceAMD64.cpp", (reinterpret_cast<UINT64>(pLowerBoundImmediate) & 0x7) == 0);
+    _ASSERTE_ALL_BUILDS("clr/src/VM/AMD64/JITinterfaceAMD64.cpp", (reinterpret_cast<UINT64>(pUpperBoundImmediate) & 0x7) == 0);
+    _ASSERTE_ALL_BUILDS("clr/src/VM/AMD64/JITinterfaceAMD64.cpp", (reinterpret_cast<UINT64>(pGen0LowImmediate) & 0x7) == 0);
+    _ASSERTE_ALL_BUILDS("clr/src/VM/AMD64/JITinterfaceAMD64.cpp", (reinterpret_cast<UINT64>(pCardTableImmediate) & 0x7) == 0);
+
+#ifdef FEATURE_MANUALLY_MANAGED_CARD_BUNDLES
+    pCardBundleTableImmediate = CALC_PATCH_LOCATION(JIT_WriteBarrier_Gen0Filter_PostGrow64, Patch_Label_CardBundleTable, 2);
+    _ASSERTE_ALL_BUILDS("clr/src/VM/AMD64/JITinterfaceAMD64.cpp", (reinterpret_cast<UINT64>(pCardBundleTableImmediate) & 0x7) == 0);
+#endif
+
+#ifdef FEATURE_SVR_GC
+    pCardTableImmediate        = CALC_PATCH_LOCATION(JIT_WriteBarrier_Precise_SVR64, PatchLabel_CardTable, 2);
+    _ASSERTE_ALL_BUILDS("clr/src/VM/AMD64/JITinterfaceAMD64.cpp", (reinterpret_cast<UINT64>(pCardTableImmediate) & 0x7) == 0);
+
+#ifdef FEATURE_MANUALLY_MANAGED_CARD_BUNDLES
+    pCardBundleTableImmediate  = CALC_PATCH_LOCATION(JIT_WriteBarrier_Precise_SVR64, PatchLabel_CardBundleTable, 2);
+    _ASSERTE_ALL_BUILDS("clr/src/VM/AMD64/JITinterfaceAMD64.cpp", (reinterpret_cast<UINT64>(pCardBundleTableImmediate) & 0x7) == 0);
+#endif // FEATURE_MANUALLY_MANAGED_CARD_BUNDLES
 #endif // FEATURE_SVR_GC
 
 #ifdef FEATURE_USE_SOFTWARE_WRITE_WATCH_FOR_GC_HEAP
@@ -214,6 +281,14 @@ PCODE WriteBarrierManager::GetCurrentWriteBarrierCode()
 #ifdef FEATURE_SVR_GC
         case WRITE_BARRIER_SVR64:
             return GetEEFuncEntryPoint(JIT_WriteBarrier_SVR64);
+#endif // FEATURE_SVR_GC
+        case WRITE_BARRIER_PRECISE_POSTGROW64:
+            return GetEEFuncEntryPoint(JIT_WriteBarrier_Precise_PostGrow64);
+        case WRITE_BARRIER_GEN0_FILTER_POSTGROW64:
+            return GetEEFuncEntryPoint(JIT_WriteBarrier_Gen0Filter_PostGrow64);
+#ifdef FEATURE_SVR_GC
+        case WRITE_BARRIER_PRECISE_SVR64:
+            return GetEEFuncEntryPoint(JIT_WriteBarrier_Precise_SVR64);
 #endif // FEATURE_SVR_GC
 #ifdef FEATURE_USE_SOFTWARE_WRITE_WATCH_FOR_GC_HEAP
         case WRITE_BARRIER_WRITE_WATCH_PREGROW64:
@@ -246,6 +321,14 @@ size_t WriteBarrierManager::GetSpecificWriteBarrierSize(WriteBarrierType writeBa
 #ifdef FEATURE_SVR_GC
         case WRITE_BARRIER_SVR64:
             return MARKED_FUNCTION_SIZE(JIT_WriteBarrier_SVR64);
+#endif // FEATURE_SVR_GC
+        case WRITE_BARRIER_PRECISE_POSTGROW64:
+            return MARKED_FUNCTION_SIZE(JIT_WriteBarrier_Precise_PostGrow64);
+        case WRITE_BARRIER_GEN0_FILTER_POSTGROW64:
+            return MARKED_FUNCTION_SIZE(JIT_WriteBarrier_Gen0Filter_PostGrow64);
+#ifdef FEATURE_SVR_GC
+        case WRITE_BARRIER_PRECISE_SVR64:
+            return MARKED_FUNCTION_SIZE(JIT_WriteBarrier_Precise_SVR64);
 #endif // FEATURE_SVR_GC
 #ifdef FEATURE_USE_SOFTWARE_WRITE_WATCH_FOR_GC_HEAP
         case WRITE_BARRIER_WRITE_WATCH_PREGROW64:
@@ -348,6 +431,60 @@ int WriteBarrierManager::ChangeWriteBarrierTo(WriteBarrierType newWriteBarrier,
         }
 #endif // FEATURE_SVR_GC
 
+        case WRITE_BARRIER_PRECISE_POSTGROW64:
+        {
+            m_pLowerBoundImmediate      = CALC_PATCH_LOCATION(JIT_WriteBarrier_Precise_PostGrow64, Patch_Label_Lower, 2);
+            m_pUpperBoundImmediate      = CALC_PATCH_LOCATION(JIT_WriteBarrier_Precise_PostGrow64, Patch_Label_Upper, 2);
+            m_pCardTableImmediate       = CALC_PATCH_LOCATION(JIT_WriteBarrier_Precise_PostGrow64, Patch_Label_CardTable, 2);
+
+            // Make sure that we will be bashing the right places (immediates should be hardcoded to 0x0f0f0f0f0f0f0f0f0).
+            _ASSERTE_ALL_BUILDS("clr/src/VM/AMD64/JITinterfaceAMD64.cpp", 0xf0f0f0f0f0f0f0f0 == *(UINT64*)m_pLowerBoundImmediate);
+            _ASSERTE_ALL_BUILDS("clr/src/VM/AMD64/JITinterfaceAMD64.cpp", 0xf0f0f0f0f0f0f0f0 == *(UINT64*)m_pCardTableImmediate);
+            _ASSERTE_ALL_BUILDS("clr/src/VM/AMD64/JITinterfaceAMD64.cpp", 0xf0f0f0f0f0f0f0f0 == *(UINT64*)m_pUpperBoundImmediate);
+
+#ifdef FEATURE_MANUALLY_MANAGED_CARD_BUNDLES
+            m_pCardBundleTableImmediate = CALC_PATCH_LOCATION(JIT_WriteBarrier_Precise_PostGrow64, Patch_Label_CardBundleTable, 2);
+            _ASSERTE_ALL_BUILDS("clr/src/VM/AMD64/JITinterfaceAMD64.cpp", 0xf0f0f0f0f0f0f0f0 == *(UINT64*)m_pCardBundleTableImmediate);
+#endif
+            break;
+        }
+
+        case WRITE_BARRIER_GEN0_FILTER_POSTGROW64:
+        {
+            m_pLowerBoundImmediate      = CALC_PATCH_LOCATION(JIT_WriteBarrier_Gen0Filter_PostGrow64, Patch_Label_Lower, 2);
+            m_pUpperBoundImmediate      = CALC_PATCH_LOCATION(JIT_WriteBarrier_Gen0Filter_PostGrow64, Patch_Label_Upper, 2);
+            m_pGen0LowImmediate         = CALC_PATCH_LOCATION(JIT_WriteBarrier_Gen0Filter_PostGrow64, Patch_Label_Gen0Low, 2);
+            m_pCardTableImmediate       = CALC_PATCH_LOCATION(JIT_WriteBarrier_Gen0Filter_PostGrow64, Patch_Label_CardTable, 2);
+
+            // Make sure that we will be bashing the right places (immediates should be hardcoded to 0x0f0f0f0f0f0f0f0f0).
+            _ASSERTE_ALL_BUILDS("clr/src/VM/AMD64/JITinterfaceAMD64.cpp", 0xf0f0f0f0f0f0f0f0 == *(UINT64*)m_pLowerBoundImmediate);
+            _ASSERTE_ALL_BUILDS("clr/src/VM/AMD64/JITinterfaceAMD64.cpp", 0xf0f0f0f0f0f0f0f0 == *(UINT64*)m_pCardTableImmediate);
+            _ASSERTE_ALL_BUILDS("clr/src/VM/AMD64/JITinterfaceAMD64.cpp", 0xf0f0f0f0f0f0f0f0 == *(UINT64*)m_pUpperBoundImmediate);
+            _ASSERTE_ALL_BUILDS("clr/src/VM/AMD64/JITinterfaceAMD64.cpp", 0xf0f0f0f0f0f0f0f0 == *(UINT64*)m_pGen0LowImmediate);
+
+#ifdef FEATURE_MANUALLY_MANAGED_CARD_BUNDLES
+            m_pCardBundleTableImmediate = CALC_PATCH_LOCATION(JIT_WriteBarrier_Gen0Filter_PostGrow64, Patch_Label_CardBundleTable, 2);
+            _ASSERTE_ALL_BUILDS("clr/src/VM/AMD64/JITinterfaceAMD64.cpp", 0xf0f0f0f0f0f0f0f0 == *(UINT64*)m_pCardBundleTableImmediate);
+#endif
+            break;
+        }
+
+#ifdef FEATURE_SVR_GC
+        case WRITE_BARRIER_PRECISE_SVR64:
+        {
+            m_pCardTableImmediate       = CALC_PATCH_LOCATION(JIT_WriteBarrier_Precise_SVR64, PatchLabel_CardTable, 2);
+
+            // Make sure that we will be bashing the right places (immediates should be hardcoded to 0x0f0f0f0f0f0f0f0f0).
+            _ASSERTE_ALL_BUILDS("clr/src/VM/AMD64/JITinterfaceAMD64.cpp", 0xf0f0f0f0f0f0f0f0 == *(UINT64*)m_pCardTableImmediate);
+
+#ifdef FEATURE_MANUALLY_MANAGED_CARD_BUNDLES
+            m_pCardBundleTableImmediate = CALC_PATCH_LOCATION(JIT_WriteBarrier_Precise_SVR64, PatchLabel_CardBundleTable, 2);
+            _ASSERTE_ALL_BUILDS("clr/src/VM/AMD64/JITinterfaceAMD64.cpp", 0xf0f0f0f0f0f0f0f0 == *(UINT64*)m_pCardBundleTableImmediate);
+#endif
+            break;
+        }
+#endif // FEATURE_SVR_GC
+
 #ifdef FEATURE_USE_SOFTWARE_WRITE_WATCH_FOR_GC_HEAP
         case WRITE_BARRIER_WRITE_WATCH_PREGROW64:
         {
@@ -437,6 +574,11 @@ void WriteBarrierManager::Initialize()
     _ASSERTE_ALL_BUILDS("clr/src/VM/AMD64/JITinterfaceAMD64.cpp", cbWriteBarrierBuffer >= GetSpecificWriteBarrierSize(WRITE_BARRIER_POSTGROW64));
 #ifdef FEATURE_SVR_GC
     _ASSERTE_ALL_BUILDS("clr/src/VM/AMD64/JITinterfaceAMD64.cpp", cbWriteBarrierBuffer >= GetSpecificWriteBarrierSize(WRITE_BARRIER_SVR64));
+#endif // FEATURE_SVR_GC
+    _ASSERTE_ALL_BUILDS("clr/src/VM/AMD64/JITinterfaceAMD64.cpp", cbWriteBarrierBuffer >= GetSpecificWriteBarrierSize(WRITE_BARRIER_PRECISE_POSTGROW64));
+    _ASSERTE_ALL_BUILDS("clr/src/VM/AMD64/JITinterfaceAMD64.cpp", cbWriteBarrierBuffer >= GetSpecificWriteBarrierSize(WRITE_BARRIER_GEN0_FILTER_POSTGROW64));
+#ifdef FEATURE_SVR_GC
+    _ASSERTE_ALL_BUILDS("clr/src/VM/AMD64/JITinterfaceAMD64.cpp", cbWriteBarrierBuffer >= GetSpecificWriteBarrierSize(WRITE_BARRIER_PRECISE_SVR64));
 #endif // FEATURE_SVR_GC
 #ifdef FEATURE_USE_SOFTWARE_WRITE_WATCH_FOR_GC_HEAP
     _ASSERTE_ALL_BUILDS("clr/src/VM/AMD64/JITinterfaceAMD64.cpp", cbWriteBarrierBuffer >= GetSpecificWriteBarrierSize(WRITE_BARRIER_WRITE_WATCH_PREGROW64));
@@ -449,6 +591,9 @@ void WriteBarrierManager::Initialize()
 #if !defined(CODECOVERAGE)
     Validate();
 #endif
+
+    m_usePreciseCardMarking = (CLRConfig::GetConfigValue(CLRConfig::UNSUPPORTED_GCPreciseCardMarking) != 0);
+    m_useGen0Filter = (CLRConfig::GetConfigValue(CLRConfig::UNSUPPORTED_GCWriteBarrierGen0Filter) != 0);
 }
 
 bool WriteBarrierManager::NeedDifferentWriteBarrier(bool bReqUpperBoundsCheck, WriteBarrierType* pNewWriteBarrierType)
@@ -474,6 +619,28 @@ bool WriteBarrierManager::NeedDifferentWriteBarrier(bool bReqUpperBoundsCheck, W
             }
 #endif
 
+            // Only workstation GC has a single gen0 range we can filter destinations with.
+            if (m_useGen0Filter && !GCHeapUtilities::IsServerHeap())
+            {
+                writeBarrierType = WRITE_BARRIER_GEN0_FILTER_POSTGROW64;
+                continue;
+            }
+
+            if (m_usePreciseCardMarking)
+            {
+                // There is no pre grow flavor of the precise barrier, the upper bound check is
+                // cheap next to the card bit computation.
+#ifdef FEATURE_SVR_GC
+                if (GCHeapUtilities::IsServerHeap())
+                {
+                    writeBarrierType = WRITE_BARRIER_PRECISE_SVR64;
+                    continue;
+                }
+#endif // FEATURE_SVR_GC
+                writeBarrierType = WRITE_BARRIER_PRECISE_POSTGROW64;
+                continue;
+            }
+
             writeBarrierType = GCHeapUtilities::IsServerHeap() ? WRITE_BARRIER_SVR64 : WRITE_BARRIER_PREGROW64;
             continue;
 
@@ -492,6 +659,17 @@ bool WriteBarrierManager::NeedDifferentWriteBarrier(bool bReqUpperBoundsCheck, W
             break;
 #endif // FEATURE_SVR_GC
 
+        case WRITE_BARRIER_PRECISE_POSTGROW64:
+            break;
+
+        case WRITE_BARRIER_GEN0_FILTER_POSTGROW64:
+            break;
+
+#ifdef FEATURE_SVR_GC
+        case WRITE_BARRIER_PRECISE_SVR64:
+            break;
+#endif // FEATURE_SVR_GC
+
 #ifdef FEATURE_USE_SOFTWARE_WRITE_WATCH_FOR_GC_HEAP
         case WRITE_BARRIER_WRITE_WATCH_PREGROW64:
             if (bReqUpperBoundsCheck)
@@ -537,7 +715,20 @@ int WriteBarrierManager::UpdateEphemeralBounds(bool isRuntimeSuspended)
 
     switch (m_currentWriteBarrier)
     {
+        case WRITE_BARRIER_GEN0_FILTER_POSTGROW64:
+        {
+            // Change immediate if different from new g_gen0_low.
+            if (*(UINT64*)m_pGen0LowImmediate != (size_t)g_gen0_low)
+            {
+                *(UINT64*)m_pGen0LowImmediate = (size_t)g_gen0_low;
+                stompWBCompleteActions |= SWB_ICACHE_FLUSH;
+            }
+        }
+        //
+        // INTENTIONAL FALL-THROUGH!
+        //
         case WRITE_BARRIER_POSTGROW64:
+        case WRITE_BARRIER_PRECISE_POSTGROW64:
 #ifdef FEATURE_USE_SOFTWARE_WRITE_WATCH_FOR_GC_HEAP
         case WRITE_BARRIER_WRITE_WATCH_POSTGROW64:
 #endif // FEATURE_USE_SOFTWARE_WRITE_WATCH_FOR_GC_HEAP
@@ -568,6 +759,7 @@ int WriteBarrierManager::UpdateEphemeralBounds(bool isRuntimeSuspended)
 
 #ifdef FEATURE_SVR_GC
         case WRITE_BARRIER_SVR64:
+        case WRITE_BARRIER_PRECISE_SVR64:
 #ifdef FEATURE_USE_SOFTWARE_WRITE_WATCH_FOR_GC_HEAP
         case WRITE_BARRIER_WRITE_WATCH_SVR64:
 #endif // FEATURE_USE_SOFTWARE_WRITE_WATCH_FOR_GC_HEAP
@@ -654,11 +846,16 @@ int WriteBarrierManager::SwitchToWriteWatchBarrier(bool isRuntimeSuspended)
             break;
 
         case WRITE_BARRIER_POSTGROW64:
+        case WRITE_BARRIER_PRECISE_POSTGROW64:
+        case WRITE_BARRIER_GEN0_FILTER_POSTGROW64:
+            // There is no write watch flavor of the precise or gen0 filtering barriers,
+            // while background GC is running we just mark cards the regular way.
             newWriteBarrierType = WRITE_BARRIER_WRITE_WATCH_POSTGROW64;
             break;
 
 #ifdef FEATURE_SVR_GC
         case WRITE_BARRIER_SVR64:
+        case WRITE_BARRIER_PRECISE_SVR64:
             newWriteBarrierType = WRITE_BARRIER_WRITE_WATCH_SVR64;
             break;
 #endif // FEATURE_SVR_GC
@@ -684,12 +881,20 @@ int WriteBarrierManager::SwitchToNonWriteWatchBarrier(bool isRuntimeSuspended)
             break;
 
         case WRITE_BARRIER_WRITE_WATCH_POSTGROW64:
-            newWriteBarrierType = WRITE_BARRIER_POSTGROW64;
+            // Only workstation GC uses the post grow flavors.
+            if (m_useGen0Filter)
+            {
+                newWriteBarrierType = WRITE_BARRIER_GEN0_FILTER_POSTGROW64;
+            }
+            else
+            {
+                newWriteBarrierType = m_usePreciseCardMarking ? WRITE_BARRIER_PRECISE_POSTGROW64 : WRITE_BARRIER_POSTGROW64;
+            }
             break;
 
 #ifdef FEATURE_SVR_GC
         case WRITE_BARRIER_WRITE_WATCH_SVR64:
-            newWriteBarrierType = WRITE_BARRIER_SVR64;
+            newWriteBarrierType = m_usePreciseCardMarking ? WRITE_BARRIER_PRECISE_SVR64 : WRITE_BARRIER_SVR64;
             break;
 #endif // FEATURE_SVR_GC
 
@@ -31,7 +31,10 @@ CallCounter::CallCounter()
 {
     LIMITED_METHOD_CONTRACT;
 
-    m_lock.Init(LOCK_TYPE_DEFAULT);
+    for (UINT32 i = 0; i < StripeCount; ++i)
+    {
+        m_stripes[i].m_lock.Init(LOCK_TYPE_DEFAULT);
+    }
 }
 
 #endif // !DACCESS_COMPILE
@@ -42,12 +45,13 @@ bool CallCounter::IsCallCountingEnabled(PTR_MethodDesc pMethodDesc)
     _ASSERTE(pMethodDesc != PTR_NULL);
     _ASSERTE(pMethodDesc->IsEligibleForTieredCompilation());
 
+    Stripe *stripe = GetStripe(pMethodDesc);
 #ifndef DACCESS_COMPILE
-    SpinLockHolder holder(&m_lock);
+    SpinLockHolder holder(&stripe->m_lock);
 #endif
 
     PTR_CallCounterEntry entry =
-        (PTR_CallCounterEntry)const_cast<CallCounterEntry *>(m_methodToCallCount.LookupPtr(pMethodDesc));
+        (PTR_CallCounterEntry)const_cast<CallCounterEntry *>(stripe->m_methodToCallCount.LookupPtr(pMethodDesc));
     return entry == PTR_NULL || entry->IsCallCountingEnabled();
 }
 
@@ -66,9 +70,11 @@ void CallCounter::DisableCallCounting(MethodDesc* pMethodDesc)
     // called yet (if the entry does not yet exist in the hash table), if necessary that could be a different function like
     // TryDisable...() that would fail to disable call counting if the method has already been called.
 
-    SpinLockHolder holder(&m_lock);
+    Stripe *stripe = GetStripe(pMethodDesc);
+    SpinLockHolder holder(&stripe->m_lock);
 
-    CallCounterEntry *existingEntry = const_cast<CallCounterEntry *>(m_methodToCallCount.LookupPtr(pMethodDesc));
+    CallCounterEntry *existingEntry =
+        const_cast<CallCounterEntry *>(stripe->m_methodToCallCount.LookupPtr(pMethodDesc));
     if (existingEntry != nullptr)
     {
         existingEntry->DisableCallCounting();
@@ -77,7 +83,7 @@ void CallCounter::DisableCallCounting(MethodDesc* pMethodDesc)
 
     // Typically, the entry would already exist because OnMethodCalled() would have been called before this function on the same
     // thread. With multi-core JIT, a function may be jitted before it is called, in which case the entry would not exist.
-    m_methodToCallCount.Add(CallCounterEntry::CreateWithCallCountingDisabled(pMethodDesc));
+    stripe->m_methodToCallCount.Add(CallCounterEntry::CreateWithCallCountingDisabled(pMethodDesc));
 }
 
 NOINLINE bool CallCounter::OnMethodCodeVersionCalledSubsequently(NativeCodeVersion nativeCodeVersion, bool *doPublishRef)
@@ -127,17 +133,19 @@ bool CallCounter::IncrementCount(MethodDesc* pMethodDesc)
     // PERF: This as a simple to implement, but not so performant, call counter
     // Currently this is only called until we reach a fixed call count and then
     // disabled. Its likely we'll want to improve this at some point but
-    // its not as bad as you might expect. Allocating a counter inline in the
-    // MethodDesc or at some location computable from the MethodDesc should
-    // eliminate 1 pointer per-method (the MethodDesc* key) and the CPU
-    // overhead to acquire the lock/search the dictionary. Depending on where it
-    // is we may also be able to reduce it to 1 byte counter without wasting the
-    // following bytes for alignment. Further work to inline the OnMethodCalled
-    // callback directly into the jitted code would eliminate CPU overhead of 
-    // leaving the prestub unpatched, but may not be good overall as it increases
-    // the size of the jitted code.
+    // its not as bad as you might expect. The counts are striped over several
+    // locks to avoid serializing threads that call different methods.
+    // Allocating a counter inline in the MethodDesc or at some location
+    // computable from the MethodDesc should eliminate 1 pointer per-method (the
+    // MethodDesc* key) and the CPU overhead to acquire the lock/search the
+    // dictionary. Depending on where it is we may also be able to reduce it to
+    // 1 byte counter without wasting the following bytes for alignment. Further
+    // work to inline the OnMethodCalled callback directly into the jitted code
+    // would eliminate CPU overhead of leaving the prestub unpatched, but may not
+    // be good overall as it increases the size of the jitted code.
 
     int callCountLimit;
+    DWORD countingStartTickCount = 0;
     {
         //Be careful if you convert to something fully lock/interlocked-free that
         //you correctly handle what happens when some N simultaneous calls don't
@@ -145,17 +153,20 @@ bool CallCounter::IncrementCount(MethodDesc* pMethodDesc)
         //but TieredCompilationManager::OnMethodCalled() doesn't expect multiple calls
         //each claiming to be exactly the threshhold call count needed to trigger
         //optimization.
-        SpinLockHolder holder(&m_lock);
-        CallCounterEntry* pEntry = const_cast<CallCounterEntry*>(m_methodToCallCount.LookupPtr(pMethodDesc));
+        Stripe *stripe = GetStripe(pMethodDesc);
+        SpinLockHolder holder(&stripe->m_lock);
+        CallCounterEntry* pEntry = const_cast<CallCounterEntry*>(stripe->m_methodToCallCount.LookupPtr(pMethodDesc));
         if (pEntry == NULL)
         {
             callCountLimit = (int)g_pConfig->TieredCompilation_CallCountThreshold() - 1;
             _ASSERTE(callCountLimit >= 0);
-            m_methodToCallCount.Add(CallCounterEntry(pMethodDesc, callCountLimit));
+            countingStartTickCount = GetTickCount();
+            stripe->m_methodToCallCount.Add(CallCounterEntry(pMethodDesc, callCountLimit, countingStartTickCount));
         }
         else if (pEntry->IsCallCountingEnabled())
         {
             callCountLimit = --pEntry->callCountLimit;
+            countingStartTickCount = pEntry->countingStartTickCount;
         }
         else
         {
@@ -169,7 +180,11 @@ bool CallCounter::IncrementCount(MethodDesc* pMethodDesc)
     }
     if (callCountLimit == 0)
     {
-        GetAppDomain()->GetTieredCompilationManager()->AsyncPromoteMethodToTier1(pMethodDesc);
+        // Methods that reach the threshold within this period are called at a high rate and get optimized first
+        const DWORD HotMethodCallCountingMs = 100;
+
+        bool isHot = GetTickCount() - countingStartTickCount < HotMethodCallCountingMs;
+        GetAppDomain()->GetTieredCompilationManager()->AsyncPromoteMethodToTier1(pMethodDesc, isHot);
     }
     return false; // stop counting calls
 }
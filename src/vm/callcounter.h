@@ -17,11 +17,13 @@
 struct CallCounterEntry
 {
     CallCounterEntry() {}
-    CallCounterEntry(PTR_MethodDesc m, const int callCountLimit)
-        : pMethod(m), callCountLimit(callCountLimit) {}
+    CallCounterEntry(PTR_MethodDesc m, const int callCountLimit, DWORD countingStartTickCount = 0)
+        : pMethod(m), callCountLimit(callCountLimit), countingStartTickCount(countingStartTickCount) {}
 
     PTR_MethodDesc pMethod;
     int callCountLimit;
+    // Tick count of the first counted call, used to prioritize methods that reach the threshold quickly
+    DWORD countingStartTickCount;
 
 #ifndef DACCESS_COMPILE
     static CallCounterEntry CreateWithCallCountingDisabled(MethodDesc *m);
@@ -100,9 +102,27 @@ public:
 
 private:
 
-    // fields protected by lock
-    SpinLock m_lock;
-    CallCounterHash m_methodToCallCount;
+    // The call counts are split into several hash tables, each protected by its own lock. A method's table is selected
+    // by its MethodDesc address so that threads calling different methods, which is typical at startup when many
+    // methods are being call-counted at the same time, rarely contend on the same lock.
+    static const UINT32 StripeCount = 32;
+
+    struct Stripe
+    {
+        // fields protected by lock
+        SpinLock m_lock;
+        CallCounterHash m_methodToCallCount;
+    };
+
+    Stripe *GetStripe(PTR_MethodDesc pMethodDesc)
+    {
+        LIMITED_METHOD_DAC_CONTRACT;
+
+        // MethodDescs are at least 8-byte aligned, skip the low bits that are always zero
+        return &m_stripes[(dac_cast<TADDR>(pMethodDesc) >> 3) % StripeCount];
+    }
+
+    Stripe m_stripes[StripeCount];
 };
 
 #endif // FEATURE_TIERED_COMPILATION
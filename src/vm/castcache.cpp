@@ -12,6 +12,14 @@
 
 OBJECTHANDLE CastCache::s_cache = NULL;
 DWORD CastCache::s_lastFlushSize = INITIAL_CACHE_SIZE;
+DWORD CastCache::s_maximumCacheSize = MAXIMUM_CACHE_SIZE;
+
+DWORD CastCache::s_evictionCount = 0;
+DWORD CastCache::s_resizeCount = 0;
+#ifdef _DEBUG
+DWORD CastCache::s_hitCount = 0;
+DWORD CastCache::s_missCount = 0;
+#endif
 
 BASEARRAYREF CastCache::CreateCastCache(DWORD size)
 {
@@ -93,6 +101,11 @@ BOOL CastCache::MaybeReplaceCacheWithLarger(DWORD size)
         return FALSE;
     }
 
+    s_resizeCount++;
+
+    LOG((LF_CLASSLOADER, LL_INFO100, "CastCache: new table of %d entries, evictions %d, resizes %d\n",
+        size, s_evictionCount, s_resizeCount));
+
     StoreObjectInHandle(s_cache, newTable);
     return TRUE;
 }
@@ -123,6 +136,13 @@ void CastCache::Initialize()
     }
     CONTRACTL_END;
 
+    // the maximum size must be a power of two, round down and never go below the default limit
+    DWORD maximumCacheSize = CLRConfig::GetConfigValue(CLRConfig::INTERNAL_CastCacheMaxSize);
+    while (s_maximumCacheSize * 2 <= maximumCacheSize && s_maximumCacheSize * 2 > s_maximumCacheSize)
+    {
+        s_maximumCacheSize *= 2;
+    }
+
     s_cache = CreateGlobalHandle(NULL);
 }
 
@@ -174,6 +194,7 @@ TypeHandle::CastResult CastCache::TryGet(TADDR source, TADDR target)
                     break;
                 }
 
+                INDEBUG(s_hitCount++;)
                 return TypeHandle::CastResult(entryTargetAndResult);
             }
         }
@@ -189,6 +210,7 @@ TypeHandle::CastResult CastCache::TryGet(TADDR source, TADDR target)
         pEntry = &Elements(table)[index & TableMask(table)];
     }
 
+    INDEBUG(s_missCount++;)
     return TypeHandle::MaybeCast;
 }
 
@@ -295,6 +317,10 @@ void CastCache::TrySet(TADDR source, TADDR target, BOOL result)
         {
             pEntry->SetEntry(source, target, result);
             VolatileStore(&pEntry->version, newVersion + 1);
+
+            // NB: not interlocked, an approximate count is good enough to tell whether the table is thrashing
+            EvictionCount(table)++;
+            s_evictionCount++;
         }
     }
 }
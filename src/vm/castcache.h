@@ -45,6 +45,9 @@
 //
 // Whenever we need to replace or resize the table, we simply allocate a new one and atomically 
 // update the static handle. The old table may be still in use, but will eventually be collected by GC.
+//
+// Each table counts the entries it evicted. A table that evicts more entries than it can hold is thrashing
+// and may grow past the default limit, up to the configured maximum (CastCacheMaxSize).
 // 
 class CastCache
 {
@@ -177,6 +180,10 @@ private:
 // Considering that typically the cache size is small and that hit rates are high with good locality, 
 // just keeping the cache around seems a simple and viable strategy.
 // 
+// Programs that cast between many distinct type pairs (e.g. to many generic interface instantiations) may 
+// thrash a cache of that size, so the limit is only a soft one - a table that keeps evicting entries can grow 
+// further, up to s_maximumCacheSize.
+//
 // Additional behaviors that could be considered, if there are scenarios that could be improved:
 //     - flush the cache based on some heuristics
 //     - shrink the cache based on some heuristics
@@ -201,6 +208,16 @@ private:
 
     static OBJECTHANDLE   s_cache;
     static DWORD          s_lastFlushSize;
+    static DWORD          s_maximumCacheSize;
+
+    // Statistics, these are not interlocked and thus approximate. Hits and misses are only counted
+    // in debug builds, TryGet is too hot to touch shared memory.
+    static DWORD          s_evictionCount;
+    static DWORD          s_resizeCount;
+#ifdef _DEBUG
+    static DWORD          s_hitCount;
+    static DWORD          s_missCount;
+#endif
 
     FORCEINLINE static TypeHandle::CastResult TryGetFromCache(TADDR source, TADDR target)
     {
@@ -246,12 +263,19 @@ private:
         }
         CONTRACTL_END;
 
-        DWORD newSize = CacheElementCount(table) * 2;
+        DWORD size = CacheElementCount(table);
+        DWORD newSize = size * 2;
         if (newSize <= MAXIMUM_CACHE_SIZE)
         {
             return MaybeReplaceCacheWithLarger(newSize);
         }
 
+        // past the default limit only grow if the table is thrashing
+        if ((newSize <= s_maximumCacheSize) && (EvictionCount(table) >= size))
+        {
+            return MaybeReplaceCacheWithLarger(newSize);
+        }
+
         return false;
     }
 
@@ -305,6 +329,12 @@ private:
         return *((BYTE*)AuxData(table) + sizeof(DWORD) + 1);
     }
 
+    FORCEINLINE static DWORD& EvictionCount(BASEARRAYREF table)
+    {
+        LIMITED_METHOD_CONTRACT;
+        return *(DWORD*)((BYTE*)AuxData(table) + sizeof(DWORD) * 2);
+    }
+
     FORCEINLINE static DWORD CacheElementCount(BASEARRAYREF table)
     {
         LIMITED_METHOD_CONTRACT;
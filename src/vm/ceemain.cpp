@@ -708,7 +708,12 @@ void EEStartupHelper(COINITIEE fFlags)
         InitializeEventTracing();
 
         // Fire the EE startup ETW event
+#ifdef FEATURE_PAL
+        // ETWFireEvent is Windows only, fire it through the generated helper so EventPipe and LTTng see it
+        FireEtwEEStartupStart_V1(GetClrInstanceId());
+#else // FEATURE_PAL
         ETWFireEvent(EEStartupStart_V1);
+#endif // FEATURE_PAL
 #endif // FEATURE_EVENT_TRACE
 
         InitGSCookie();
@@ -1032,6 +1037,15 @@ void EEStartupHelper(COINITIEE fFlags)
         hr = S_OK;
         STRESS_LOG0(LF_STARTUP, LL_ALWAYS, "===================EEStartup Completed===================");
 
+#if defined(FEATURE_EVENT_TRACE) && !defined(CROSSGEN_COMPILE)
+        // Pairs with EEStartupStart_V1 so startup phase events have a closing bracket
+#ifdef FEATURE_PAL
+        FireEtwEEStartupEnd_V1(GetClrInstanceId());
+#else // FEATURE_PAL
+        ETWFireEvent(EEStartupEnd_V1);
+#endif // FEATURE_PAL
+#endif // FEATURE_EVENT_TRACE && !CROSSGEN_COMPILE
+
 #ifndef CROSSGEN_COMPILE
 
 #ifdef _DEBUG
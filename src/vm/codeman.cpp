@@ -59,6 +59,8 @@ SPTR_IMPL(ReadyToRunJitManager, ExecutionManager, m_pReadyToRunJitManager);
 Volatile<RangeSection *> ExecutionManager::m_CodeRangeList = NULL;
 Volatile<LONG> ExecutionManager::m_dwReaderCount = 0;
 Volatile<LONG> ExecutionManager::m_dwWriterLock = 0;
+Volatile<ExecutionManager::RangeSectionArray *> ExecutionManager::m_CodeRangeArray = NULL;
+Volatile<ExecutionManager::RangeSectionArray *> ExecutionManager::m_ObsoleteCodeRangeArrays = NULL;
 #else
 SPTR_IMPL(RangeSection, ExecutionManager, m_CodeRangeList);
 SVAL_IMPL(LONG, ExecutionManager, m_dwReaderCount);
@@ -3506,6 +3508,62 @@ void EEJitManager::AddToCleanupList(HostCodeHeap *pCodeHeap)
     }
 }
 
+//-----------------------------------------------------------------------------
+// Code start cache
+//
+// Stack walks (GC stack scans in particular) repeatedly map the same return
+// addresses to the start of their method. The nibble map scan that does this
+// is linear in the distance to the method header, so the results are kept in
+// a small direct mapped cache keyed by IP.
+//
+// Each entry is guarded by a sequence number that is odd while the entry is
+// being written, which lets readers detect torn entries without taking a lock.
+// Bumping the global epoch invalidates all the existing entries at once. This
+// is needed when code is freed or a code heap is deleted. Adding code only
+// changes the result for IPs that aren't in any method yet, and lookups are
+// only made for IPs in published code, except that a freed block may have been
+// looked up before it's reused. So once any code was freed, adding code bumps
+// the epoch as well.
+//-----------------------------------------------------------------------------
+
+struct CodeStartCacheEntry
+{
+    LONG    seq;
+    DWORD   epoch;
+    PCODE   pc;
+    TADDR   start;
+};
+
+#define CODE_START_CACHE_BITS 10
+#define CODE_START_CACHE_SIZE (1 << CODE_START_CACHE_BITS)
+
+static CodeStartCacheEntry g_CodeStartCache[CODE_START_CACHE_SIZE];
+static LONG g_CodeStartCacheEpoch;
+
+// Set once code was freed, see NibbleMapSet. Only accessed under m_CodeHeapCritSec.
+static BOOL g_CodeStartCacheHasFreedCode;
+
+static FORCEINLINE CodeStartCacheEntry * GetCodeStartCacheEntry(PCODE pc)
+{
+    LIMITED_METHOD_CONTRACT;
+
+    // Same hashing as StackwalkCache::GetKey
+    SIZE_T key = pc ^ (pc >> CODE_START_CACHE_BITS);
+#ifdef _WIN64
+    key ^= (key >> 32);
+#endif
+    return &g_CodeStartCache[key & (CODE_START_CACHE_SIZE - 1)];
+}
+
+static FORCEINLINE void InvalidateCodeStartCache()
+{
+    LIMITED_METHOD_CONTRACT;
+
+    // Must be called after the nibble map was updated. Lookups that raced with
+    // the update have either seen the new map or recorded the old epoch.
+    FastInterlockIncrement(&g_CodeStartCacheEpoch);
+}
+
 void EEJitManager::DeleteCodeHeap(HeapList *pHeapList)
 {
     CONTRACTL {
@@ -3534,6 +3592,9 @@ void EEJitManager::DeleteCodeHeap(HeapList *pHeapList)
 
     ExecutionManager::DeleteRange((TADDR)pHeapList);
 
+    // The address range may be reused by a new code heap
+    InvalidateCodeStartCache();
+
     LOG((LF_JIT, LL_INFO100, "DeleteCodeHeap start" FMT_ADDR "end" FMT_ADDR "\n",
                               (const BYTE*)pHeapList->startAddress, 
                               (const BYTE*)pHeapList->endAddress     ));
@@ -3730,10 +3791,51 @@ TADDR EEJitManager::FindMethodCode(PCODE currentPC)
     return dac_cast<PTR_EEJitManager>(pRS->pjit)->FindMethodCode(pRS, currentPC);
 }
 
+TADDR EEJitManager::FindMethodCode(RangeSection * pRangeSection, PCODE currentPC)
+{
+    LIMITED_METHOD_DAC_CONTRACT;
+
+#ifdef DACCESS_COMPILE
+    return FindMethodCodeInNibbleMap(pRangeSection, currentPC);
+#else
+    CodeStartCacheEntry * pEntry = GetCodeStartCacheEntry(currentPC);
+
+    // The epoch has to be read before the nibble map so that a result computed
+    // from a map that is being changed is recorded with the old epoch.
+    LONG epoch = VolatileLoad(&g_CodeStartCacheEpoch);
+    LONG seq = VolatileLoad(&pEntry->seq);
+
+    if ((seq & 1) == 0)
+    {
+        PCODE pc = VolatileLoad(&pEntry->pc);
+        TADDR start = VolatileLoad(&pEntry->start);
+        DWORD entryEpoch = VolatileLoad(&pEntry->epoch);
+
+        if (VolatileLoad(&pEntry->seq) == seq && pc == currentPC && entryEpoch == (DWORD)epoch)
+            return start;
+    }
+
+    TADDR start = FindMethodCodeInNibbleMap(pRangeSection, currentPC);
+
+    // Only cache successful lookups, and give up if another thread is
+    // updating the same entry - this is just a cache.
+    if (start != NULL && (seq & 1) == 0 &&
+        FastInterlockCompareExchange(&pEntry->seq, seq + 1, seq) == seq)
+    {
+        pEntry->pc = currentPC;
+        pEntry->start = start;
+        pEntry->epoch = (DWORD)epoch;
+        VolatileStore(&pEntry->seq, seq + 2);
+    }
+
+    return start;
+#endif // DACCESS_COMPILE
+}
+
 // Finds the header corresponding to the code at offset "delta".
 // Returns NULL if there is no header for the given "delta"
 
-TADDR EEJitManager::FindMethodCode(RangeSection * pRangeSection, PCODE currentPC)
+TADDR EEJitManager::FindMethodCodeInNibbleMap(RangeSection * pRangeSection, PCODE currentPC)
 {
     LIMITED_METHOD_DAC_CONTRACT;
 
@@ -3853,6 +3955,12 @@ void EEJitManager::NibbleMapSet(HeapList * pHp, TADDR pCode, BOOL bSet)
 
     // It is important for this update to be atomic. Synchronization would be required with FindMethodCode otherwise.
     *(pMap+index) = ((*(pMap+index))&mask)|value;
+
+    if (!bSet)
+        g_CodeStartCacheHasFreedCode = TRUE;
+
+    if (!bSet || g_CodeStartCacheHasFreedCode)
+        InvalidateCodeStartCache();
 }
 #endif // !DACCESS_COMPILE
 
@@ -4450,6 +4558,34 @@ RangeSection* ExecutionManager::GetRangeSection(TADDR addr)
         SUPPORTS_DAC;
     } CONTRACTL_END;
 
+#ifndef DACCESS_COMPILE
+    RangeSectionArray * pArray = m_CodeRangeArray;
+
+    if (pArray != NULL)
+    {
+        // The sections are sorted by descending LowAddress, find the first one that starts at or below addr
+        COUNT_T lo = 0;
+        COUNT_T hi = pArray->count;
+
+        while (lo < hi)
+        {
+            COUNT_T mid = (lo + hi) / 2;
+
+            if (pArray->sections[mid]->LowAddress <= addr)
+                hi = mid;
+            else
+                lo = mid + 1;
+        }
+
+        if ((lo < pArray->count) && (addr < pArray->sections[lo]->HighAddress))
+        {
+            return pArray->sections[lo];
+        }
+
+        return NULL;
+    }
+#endif
+
     RangeSection * pHead = m_CodeRangeList;
 
     if (pHead == NULL)
@@ -4710,7 +4846,7 @@ void ExecutionManager::AddRangeHelper(TADDR          pStartRange,
         PRECONDITION(pHeapListOrZapModule != NULL);
     } CONTRACTL_END;
 
-    RangeSection *pnewrange = new RangeSection;
+    NewHolder<RangeSection> pnewrange(new RangeSection);
 
     _ASSERTE(pEndRange > pStartRange);
 
@@ -4724,9 +4860,15 @@ void ExecutionManager::AddRangeHelper(TADDR          pStartRange,
 #if defined(_TARGET_AMD64_)
     pnewrange->pUnwindInfoTable = NULL;
 #endif // defined(_TARGET_AMD64_)
+
+    RangeSectionArray * pOldArray = NULL;
     {
         CrstHolder ch(&m_RangeCrst); // Acquire the Crst before linking in a new RangeList
 
+        // Allocate the new lookup array before linking in the new range so that
+        // running out of memory leaves the list and the array consistent.
+        RangeSectionArray * pNewArray = (RangeSectionArray *) new BYTE[RangeSectionArray::Size(GetRangeSectionCount() + 1)];
+
         RangeSection * current  = m_CodeRangeList;
         RangeSection * previous = NULL;
 
@@ -4769,6 +4911,96 @@ void ExecutionManager::AddRangeHelper(TADDR          pStartRange,
         {
             m_CodeRangeList = pnewrange;
         }
+
+        pnewrange.SuppressRelease();
+
+        FillRangeSectionArray(pNewArray);
+
+        // Readers may be using the old array, swap it under the writer lock so that
+        // it can be safely deleted afterwards.
+        WriterLockHolder wlh;
+        pOldArray = m_CodeRangeArray;
+        m_CodeRangeArray = pNewArray;
+    }
+
+    RetireRangeSectionArray(pOldArray);
+}
+
+// Returns the number of ranges in m_CodeRangeList
+COUNT_T ExecutionManager::GetRangeSectionCount()
+{
+    CONTRACTL {
+        NOTHROW;
+        GC_NOTRIGGER;
+        PRECONDITION(m_RangeCrst.OwnedByCurrentThread());
+    } CONTRACTL_END;
+
+    COUNT_T count = 0;
+
+    for (RangeSection * pCurr = m_CodeRangeList; pCurr != NULL; pCurr = pCurr->pnext)
+    {
+        count++;
+    }
+
+    return count;
+}
+
+// Copies m_CodeRangeList into pArray, which must be large enough to hold all the ranges
+void ExecutionManager::FillRangeSectionArray(RangeSectionArray * pArray)
+{
+    CONTRACTL {
+        NOTHROW;
+        GC_NOTRIGGER;
+        PRECONDITION(m_RangeCrst.OwnedByCurrentThread());
+    } CONTRACTL_END;
+
+    COUNT_T count = 0;
+
+    for (RangeSection * pCurr = m_CodeRangeList; pCurr != NULL; pCurr = pCurr->pnext)
+    {
+        pArray->sections[count++] = pCurr;
+    }
+
+    pArray->count = count;
+}
+
+// Queues a replaced lookup array for deletion at the next GC sync point
+void ExecutionManager::RetireRangeSectionArray(RangeSectionArray * pArray)
+{
+    CONTRACTL {
+        NOTHROW;
+        GC_NOTRIGGER;
+    } CONTRACTL_END;
+
+    if (pArray == NULL)
+        return;
+
+    if (!g_fEEStarted)
+    {
+        delete [] (BYTE *) pArray;
+        return;
+    }
+
+    RangeSectionArray * pHead;
+    do
+    {
+        pHead = m_ObsoleteCodeRangeArrays;
+        pArray->pNextObsolete = pHead;
+    }
+    while (FastInterlockCompareExchangePointer(m_ObsoleteCodeRangeArrays.GetPointer(), pArray, pHead) != pHead);
+}
+
+void ExecutionManager::ReclaimRangeSectionArrays()
+{
+    LIMITED_METHOD_CONTRACT;
+
+    RangeSectionArray * pArray = FastInterlockExchangePointer(m_ObsoleteCodeRangeArrays.GetPointer(), (RangeSectionArray *) NULL);
+
+    while (pArray != NULL)
+    {
+        RangeSectionArray * pNext = pArray->pNextObsolete;
+        delete [] (BYTE *) pArray;
+        pArray = pNext;
     }
 }
 
@@ -4781,6 +5013,8 @@ void ExecutionManager::DeleteRange(TADDR pStartRange)
     } CONTRACTL_END;
 
     RangeSection *pCurr = NULL;
+    RangeSectionArray *pOldArray = NULL;
+    RangeSectionArray *pNewArray = NULL;
     {
         // Acquire the Crst before unlinking a RangeList.
         // NOTE: The Crst must be acquired BEFORE we grab the writer lock, as the
@@ -4788,6 +5022,10 @@ void ExecutionManager::DeleteRange(TADDR pStartRange)
         // to enter a Crst after the forbid suspend thread region is entered
         CrstHolder ch(&m_RangeCrst);
 
+        // The new lookup array has to be allocated outside of the forbid suspend thread region.
+        // If the allocation fails lookups fall back to walking the list.
+        pNewArray = (RangeSectionArray *) new (nothrow) BYTE[RangeSectionArray::Size(GetRangeSectionCount())];
+
         // Acquire the WriterLock and prevent any readers from walking the RangeList.
         // This also forces us to enter a forbid suspend thread region, to prevent
         // hijacking profilers from grabbing this thread and walking it (the walk may
@@ -4821,6 +5059,15 @@ void ExecutionManager::DeleteRange(TADDR pStartRange)
                 head->pLastUsed = NULL;
             }
 
+            if (pNewArray != NULL)
+            {
+                FillRangeSectionArray(pNewArray);
+            }
+
+            pOldArray = m_CodeRangeArray;
+            m_CodeRangeArray = pNewArray;
+            pNewArray = NULL;
+
             //
             // Cannot delete pCurr here because we own the WriterLock and if this is
             // a hosted scenario then the hosting api callback cannot occur in a forbid
@@ -4829,6 +5076,10 @@ void ExecutionManager::DeleteRange(TADDR pStartRange)
         }
     }
 
+    // pNewArray is only left over if the range was not found
+    delete [] (BYTE *) pNewArray;
+    RetireRangeSectionArray(pOldArray);
+
     //
     // Now delete the node
     //
@@ -1064,6 +1064,11 @@ public:
 
     static TADDR FindMethodCode(RangeSection * pRangeSection, PCODE currentPC);
     static TADDR FindMethodCode(PCODE currentPC);
+
+private:
+    static TADDR FindMethodCodeInNibbleMap(RangeSection * pRangeSection, PCODE currentPC);
+
+public:
 #endif // !CROSSGEN_COMPILE
 	
 #if !defined DACCESS_COMPILE && !defined CROSSGEN_COMPILE
@@ -1342,6 +1347,11 @@ public:
     static PTR_Module FindZapModule(TADDR currentData);
     static PTR_Module FindReadyToRunModule(TADDR currentData);
 
+#ifndef DACCESS_COMPILE
+    // Frees the range section lookup arrays that were replaced since the last GC sync point
+    static void ReclaimRangeSectionArrays();
+#endif
+
     // FindZapModule flavor to be used during GC to find GCRefMap
     static PTR_Module FindModuleForGCRefMap(TADDR currentData);
 
@@ -1395,6 +1405,35 @@ private:
     SVAL_DECL(LONG, m_dwWriterLock);
 #endif
 
+#ifndef DACCESS_COMPILE
+    // Snapshot of m_CodeRangeList, in the same order (descending LowAddress), that lets
+    // GetRangeSection binary search instead of walking the list. It is rebuilt whenever
+    // a range is added or deleted and swapped in under the writer lock, so readers that
+    // hold the reader lock (or run while the runtime is suspended) can use it safely.
+    struct RangeSectionArray
+    {
+        RangeSectionArray * pNextObsolete; // links arrays waiting to be reclaimed
+        COUNT_T         count;
+        RangeSection *  sections[1];
+
+        static SIZE_T Size(COUNT_T capacity)
+        {
+            LIMITED_METHOD_CONTRACT;
+            return offsetof(RangeSectionArray, sections) + capacity * sizeof(RangeSection *);
+        }
+    };
+
+    static Volatile<RangeSectionArray *> m_CodeRangeArray;
+
+    // Replaced arrays may still be used by cooperative mode readers that do not take the
+    // reader lock, they are freed at the next GC sync point.
+    static Volatile<RangeSectionArray *> m_ObsoleteCodeRangeArrays;
+
+    static COUNT_T GetRangeSectionCount();
+    static void FillRangeSectionArray(RangeSectionArray * pArray);
+    static void RetireRangeSectionArray(RangeSectionArray * pArray);
+#endif
+
 #ifndef DACCESS_COMPILE
     class WriterLockHolder
     {
@@ -335,8 +335,10 @@ HRESULT EEConfig::Init()
     fTieredCompilation_QuickJit = false;
     fTieredCompilation_QuickJitForLoops = false;
     fTieredCompilation_CallCounting = false;
+    fTieredPGO = false;
     tieredCompilation_CallCountThreshold = 1;
     tieredCompilation_CallCountingDelayMs = 0;
+    tieredCompilation_BackgroundWorkerMaxCount = 1;
 #endif
 
 #ifndef CROSSGEN_COMPILE
@@ -1233,6 +1235,26 @@ fTrackDynamicMethodDebugInfo = CLRConfig::GetConfigValue(CLRConfig::UNSUPPORTED_
             }
         }
 
+        // By default use one background worker per 8 processors, up to 4, leaving most processors to the app's own
+        // startup work. Explicitly configured counts are still limited by the number of processors.
+        DWORD processorCount = (DWORD)GetCurrentProcessCpuCount();
+        tieredCompilation_BackgroundWorkerMaxCount =
+            CLRConfig::GetConfigValue(CLRConfig::INTERNAL_TC_BackgroundWorkerMaxCount);
+        if (tieredCompilation_BackgroundWorkerMaxCount == 0)
+        {
+            tieredCompilation_BackgroundWorkerMaxCount = min(processorCount / 8, (DWORD)4);
+        }
+        tieredCompilation_BackgroundWorkerMaxCount = min(tieredCompilation_BackgroundWorkerMaxCount, processorCount);
+        if (tieredCompilation_BackgroundWorkerMaxCount < 1)
+        {
+            tieredCompilation_BackgroundWorkerMaxCount = 1;
+        }
+
+        // Instrumentation is added at tier0, so without call counting there is
+        // no tier1 to consume it
+        fTieredPGO = fTieredCompilation_CallCounting &&
+            CLRConfig::GetConfigValue(CLRConfig::UNSUPPORTED_TieredPGO) != 0;
+
         if (ETW::CompilationLog::TieredCompilation::Runtime::IsEnabled())
         {
             ETW::CompilationLog::TieredCompilation::Runtime::SendSettings();
@@ -286,6 +286,8 @@ public:
     bool          TieredCompilation_CallCounting()  const { LIMITED_METHOD_CONTRACT; return fTieredCompilation_CallCounting; }
     DWORD         TieredCompilation_CallCountThreshold() const { LIMITED_METHOD_CONTRACT; return tieredCompilation_CallCountThreshold; }
     DWORD         TieredCompilation_CallCountingDelayMs() const { LIMITED_METHOD_CONTRACT; return tieredCompilation_CallCountingDelayMs; }
+    DWORD         TieredCompilation_BackgroundWorkerMaxCount() const { LIMITED_METHOD_CONTRACT; return tieredCompilation_BackgroundWorkerMaxCount; }
+    bool          TieredPGO(void)                   const { LIMITED_METHOD_CONTRACT;  return fTieredPGO; }
 #endif
 
 #ifndef CROSSGEN_COMPILE
@@ -1021,6 +1023,8 @@ private: //----------------------------------------------------------------
     bool fTieredCompilation_CallCounting;
     DWORD tieredCompilation_CallCountThreshold;
     DWORD tieredCompilation_CallCountingDelayMs;
+    DWORD tieredCompilation_BackgroundWorkerMaxCount;
+    bool fTieredPGO;
 #endif
 
 #ifndef CROSSGEN_COMPILE
@@ -104,48 +104,49 @@ EventPipeBuffer* EventPipeBufferManager::AllocateBufferForThread(EventPipeThread
     }
     CONTRACTL_END;
 
-    // Allocating a buffer requires us to take the lock.
-    SpinLockHolder _slh(&m_lock);
-
-    // if we are deallocating then give up, see the comments in SuspendWriteEvents() for why this is important.
-    if (m_writeEventSuspending.Load())
+    // The manager's lock protects the thread list and the size accounting, but allocating and zeroing
+    // the buffer memory itself can take a while for large buffers. To keep writers on other threads from
+    // spinning on the lock meanwhile we reserve the size under the lock, allocate the buffer without it,
+    // and then take the lock again to publish the buffer.
+    EventPipeBufferList *pThreadBufferList = NULL;
+    unsigned int bufferSize = 0;
     {
-        writeSuspended = TRUE;
-        return NULL;
-    }
+        SpinLockHolder _slh(&m_lock);
 
-    bool allocateNewBuffer = false;
+        // if we are deallocating then give up, see the comments in SuspendWriteEvents() for why this is important.
+        if (m_writeEventSuspending.Load())
+        {
+            writeSuspended = TRUE;
+            return NULL;
+        }
 
-    EventPipeBufferList *pThreadBufferList = pSessionState->GetBufferList();
-    if (pThreadBufferList == NULL)
-    {
-        pThreadBufferList = new (nothrow) EventPipeBufferList(this, pSessionState->GetThread());
+        pThreadBufferList = pSessionState->GetBufferList();
         if (pThreadBufferList == NULL)
         {
-            return NULL;
+            pThreadBufferList = new (nothrow) EventPipeBufferList(this, pSessionState->GetThread());
+            if (pThreadBufferList == NULL)
+            {
+                return NULL;
+            }
+
+            SListElem<EventPipeThreadSessionState *> *pElem = new (nothrow) SListElem<EventPipeThreadSessionState *>(pSessionState);
+            if (pElem == NULL)
+            {
+                delete pThreadBufferList;
+                return NULL;
+            }
+
+            m_pThreadSessionStateList->InsertTail(pElem);
+            pSessionState->SetBufferList(pThreadBufferList);
         }
 
-        SListElem<EventPipeThreadSessionState *> *pElem = new (nothrow) SListElem<EventPipeThreadSessionState *>(pSessionState);
-        if (pElem == NULL)
+        // Determine if policy allows us to allocate another buffer
+        size_t availableBufferSize = m_maxSizeOfAllBuffers - m_sizeOfAllBuffers;
+        if (requestSize > availableBufferSize)
         {
-            delete pThreadBufferList;
             return NULL;
         }
 
-        m_pThreadSessionStateList->InsertTail(pElem);
-        pSessionState->SetBufferList(pThreadBufferList);
-    }
-
-    // Determine if policy allows us to allocate another buffer
-    size_t availableBufferSize = m_maxSizeOfAllBuffers - m_sizeOfAllBuffers;
-    if (requestSize <= availableBufferSize)
-    {
-        allocateNewBuffer = true;
-    }
-
-    EventPipeBuffer *pNewBuffer = NULL;
-    if (allocateNewBuffer)
-    {
         // Pick a buffer size by multiplying the base buffer size by the number of buffers already allocated for this thread.
         unsigned int sizeMultiplier = pThreadBufferList->GetCount() + 1;
 
@@ -156,11 +157,10 @@ EventPipeBuffer* EventPipeBufferManager::AllocateBufferForThread(EventPipeThread
 #else
             100 * 1024; // 100K
 #endif
-        unsigned int bufferSize = baseBufferSize * sizeMultiplier;
+        bufferSize = baseBufferSize * sizeMultiplier;
 
         // Make sure that buffer size >= request size so that the buffer size does not
         // determine the max event size.
-        _ASSERTE(requestSize <= availableBufferSize);
         bufferSize = Max(requestSize, bufferSize);
         bufferSize = Min((unsigned int)bufferSize, (unsigned int)availableBufferSize);
 
@@ -168,58 +168,77 @@ EventPipeBuffer* EventPipeBufferManager::AllocateBufferForThread(EventPipeThread
         const unsigned int maxBufferSize = 1024 * 1024;
         bufferSize = Min(bufferSize, maxBufferSize);
 
-        // EX_TRY is used here as opposed to new (nothrow) because
-        // the constructor also allocates a private buffer, which
-        // could throw, and cannot be easily checked
-        EX_TRY
-        {
-            // The sequence counter is exclusively mutated on this thread so this is a thread-local
-            // read.
-            unsigned int sequenceNumber = pSessionState->GetVolatileSequenceNumber();
-            pNewBuffer = new EventPipeBuffer(bufferSize, pSessionState->GetThread(), sequenceNumber);
-        }
-        EX_CATCH
-        {
-            pNewBuffer = NULL;
-        }
-        EX_END_CATCH(SwallowAllExceptions);
+        // Reserve the space now so that concurrent allocations respect the session size limit.
+        m_sizeOfAllBuffers += bufferSize;
+    }
 
-        if (pNewBuffer == NULL)
-        {
-            return NULL;
-        }
+    EventPipeBuffer *pNewBuffer = NULL;
 
-        m_sizeOfAllBuffers += bufferSize;
-        if (m_sequencePointAllocationBudget != 0)
+    // EX_TRY is used here as opposed to new (nothrow) because
+    // the constructor also allocates a private buffer, which
+    // could throw, and cannot be easily checked
+    EX_TRY
+    {
+        // The sequence counter is exclusively mutated on this thread so this is a thread-local
+        // read.
+        unsigned int sequenceNumber = pSessionState->GetVolatileSequenceNumber();
+        pNewBuffer = new EventPipeBuffer(bufferSize, pSessionState->GetThread(), sequenceNumber);
+    }
+    EX_CATCH
+    {
+        pNewBuffer = NULL;
+    }
+    EX_END_CATCH(SwallowAllExceptions);
+
+    {
+        SpinLockHolder _slh(&m_lock);
+
+        if (pNewBuffer != NULL && !m_writeEventSuspending.Load())
         {
-            // sequence point bookkeeping
-            if (bufferSize >= m_remainingSequencePointAllocationBudget)
+            if (m_sequencePointAllocationBudget != 0)
             {
-                EventPipeSequencePoint* pSequencePoint = new (nothrow) EventPipeSequencePoint();
-                if (pSequencePoint != NULL)
+                // sequence point bookkeeping
+                if (bufferSize >= m_remainingSequencePointAllocationBudget)
+                {
+                    EventPipeSequencePoint* pSequencePoint = new (nothrow) EventPipeSequencePoint();
+                    if (pSequencePoint != NULL)
+                    {
+                        InitSequencePointThreadListHaveLock(pSequencePoint);
+                        EnqueueSequencePoint(pSequencePoint);
+                    }
+                    m_remainingSequencePointAllocationBudget = m_sequencePointAllocationBudget;
+                }
+                else
                 {
-                    InitSequencePointThreadListHaveLock(pSequencePoint);
-                    EnqueueSequencePoint(pSequencePoint);
+                    m_remainingSequencePointAllocationBudget -= bufferSize;
                 }
-                m_remainingSequencePointAllocationBudget = m_sequencePointAllocationBudget;
             }
-            else
-            {
-                m_remainingSequencePointAllocationBudget -= bufferSize;
-            }
-        }
 #ifdef _DEBUG
-        m_numBuffersAllocated++;
+            m_numBuffersAllocated++;
 #endif // _DEBUG
+
+            // Set the buffer on the thread.
+            pThreadBufferList->InsertTail(pNewBuffer);
+            return pNewBuffer;
+        }
+
+        // Either the allocation failed or writes were suspended while we were allocating. In the latter case
+        // no new buffers may be added to the list, see the comments in SuspendWriteEvents().
+        m_sizeOfAllBuffers -= bufferSize;
+        if (pNewBuffer == NULL)
+        {
+            return NULL;
+        }
     }
 
-    // Set the buffer on the thread.
-    if (pNewBuffer != NULL)
+    // The buffer was never published so nobody else can observe it, but it must be read-only to be deleted.
     {
-        pThreadBufferList->InsertTail(pNewBuffer);
-        return pNewBuffer;
+        SpinLockHolder _slh(pSessionState->GetThread()->GetLock());
+        pNewBuffer->ConvertToReadOnly();
     }
+    delete pNewBuffer;
 
+    writeSuspended = TRUE;
     return NULL;
 }
 
@@ -30,11 +30,37 @@ CLREvent * FinalizerThread::hEventFinalizerToShutDown = NULL;
 
 HANDLE FinalizerThread::MHandles[kHandleCount];
 
+DWORD FinalizerThread::cHelperThreads = 0;
+Thread * FinalizerThread::helperThreads[kMaxHelperThreads];
+CLREvent * FinalizerThread::hEventHelperWork[kMaxHelperThreads];
+BOOL FinalizerThread::helperInBatch[kMaxHelperThreads];
+CLREvent * FinalizerThread::hEventHelpersDone = NULL;
+OBJECTHANDLE FinalizerThread::hFinalizerBatch = NULL;
+Volatile<LONG> FinalizerThread::cBatchObjects = 0;
+Volatile<LONG> FinalizerThread::iNextBatchObject = 0;
+Volatile<LONG> FinalizerThread::cBusyHelpers = 0;
+
 BOOL FinalizerThread::IsCurrentThreadFinalizer()
 {
     LIMITED_METHOD_CONTRACT;
 
-    return GetThread() == g_pFinalizerThread;
+    Thread *pThread = GetThread();
+    if (pThread == g_pFinalizerThread)
+    {
+        return TRUE;
+    }
+
+    // Finalizers running on the helper threads must see the same behavior,
+    // eg waiting for pending finalizers from one of them would never return.
+    for (DWORD i = 0; i < cHelperThreads; i++)
+    {
+        if (helperThreads[i] == pThread)
+        {
+            return TRUE;
+        }
+    }
+
+    return FALSE;
 }
 
 void FinalizerThread::EnableFinalization()
@@ -120,6 +146,13 @@ void FinalizerThread::FinalizeAllObjects(int bitToCheck)
 
     unsigned int fcount = 0; 
 
+    if (cHelperThreads > 0)
+    {
+        fcount = FinalizeObjectsInBatches(bitToCheck);
+        FireEtwGCFinalizersEnd_V1(fcount, GetClrInstanceId());
+        return;
+    }
+
     Object* fobj = GCHeapUtilities::GetGCHeap()->GetNextFinalizable();
 
     Thread *pThread = GetThread();
@@ -141,6 +174,123 @@ void FinalizerThread::FinalizeAllObjects(int bitToCheck)
     FireEtwGCFinalizersEnd_V1(fcount, GetClrInstanceId());
 }
 
+// With FinalizerHelperThreadCount set, the finalizer thread pulls objects off the
+// finalization queue into a batch which it then runs together with the helper threads.
+// The batch is a managed array kept alive by a strong handle so the objects in it are
+// reported to the GC while finalizers run. Critical finalizers are only guaranteed to
+// run after the normal ones, so the first critical object always starts a new batch.
+unsigned int FinalizerThread::FinalizeObjectsInBatches(int bitToCheck)
+{
+    STATIC_CONTRACT_THROWS;
+    STATIC_CONTRACT_GC_TRIGGERS;
+    STATIC_CONTRACT_MODE_COOPERATIVE;
+
+    unsigned int fcount = 0;
+    BOOL fCriticalSeen = FALSE;
+    Thread *pThread = GetThread();
+
+    // If we came out of the previous pass on an exception, finish what is left of
+    // its batch first.
+    RunFinalizerBatch(pThread);
+    WaitForHelpers();
+
+    while (TRUE)
+    {
+        LONG count = 0;
+
+        // The last slot carries the object that ended the previous batch.
+        PTRARRAYREF batch = (PTRARRAYREF)ObjectFromHandle(hFinalizerBatch);
+        if (batch->GetAt(kFinalizerBatchSize) != NULL)
+        {
+            batch->SetAt(count++, batch->GetAt(kFinalizerBatchSize));
+            batch->SetAt(kFinalizerBatchSize, NULL);
+        }
+
+        while (count < kFinalizerBatchSize)
+        {
+            Object* fobj = GCHeapUtilities::GetGCHeap()->GetNextFinalizable();
+            if (fobj == NULL)
+            {
+                break;
+            }
+
+            if (fobj->GetHeader()->GetBits() & bitToCheck)
+            {
+                continue;
+            }
+
+            batch = (PTRARRAYREF)ObjectFromHandle(hFinalizerBatch);
+            MethodTable *pMT = fobj->GetMethodTable();
+            if (!fCriticalSeen && (pMT != NULL) && pMT->HasCriticalFinalizer())
+            {
+                fCriticalSeen = TRUE;
+                if (count > 0)
+                {
+                    batch->SetAt(kFinalizerBatchSize, ObjectToOBJECTREF(fobj));
+                    break;
+                }
+            }
+
+            batch->SetAt(count++, ObjectToOBJECTREF(fobj));
+        }
+
+        if (count == 0)
+        {
+            break;
+        }
+
+        fcount += count;
+        iNextBatchObject = 0;
+        cBatchObjects = count;
+
+        if (count >= kMinParallelBatchSize)
+        {
+            cBusyHelpers = cHelperThreads;
+            for (DWORD i = 0; i < cHelperThreads; i++)
+            {
+                hEventHelperWork[i]->Set();
+            }
+        }
+
+        RunFinalizerBatch(pThread);
+        WaitForHelpers();
+    }
+
+    return fcount;
+}
+
+void FinalizerThread::RunFinalizerBatch(Thread* pThread)
+{
+    STATIC_CONTRACT_THROWS;
+    STATIC_CONTRACT_GC_TRIGGERS;
+    STATIC_CONTRACT_MODE_COOPERATIVE;
+
+    LONG i;
+    while ((i = FastInterlockIncrement(&iNextBatchObject) - 1) < cBatchObjects)
+    {
+        PTRARRAYREF batch = (PTRARRAYREF)ObjectFromHandle(hFinalizerBatch);
+        Object* fobj = OBJECTREFToObject(batch->GetAt(i));
+        batch->SetAt(i, NULL);
+
+        DoOneFinalization(fobj, pThread);
+    }
+}
+
+void FinalizerThread::WaitForHelpers()
+{
+    STATIC_CONTRACT_NOTHROW;
+    STATIC_CONTRACT_GC_TRIGGERS;
+    STATIC_CONTRACT_MODE_COOPERATIVE;
+
+    // The event may still be set from a batch we did not have to wait for, so
+    // always go by the count.
+    while (cBusyHelpers != 0)
+    {
+        GCX_PREEMP();
+        hEventHelpersDone->Wait(INFINITE, FALSE);
+    }
+}
+
 void FinalizerThread::WaitForFinalizerEvent (CLREvent *event)
 {
     // Non-host environment
@@ -251,6 +401,7 @@ void FinalizerThread::WaitForFinalizerEvent (CLREvent *event)
 
 
 static BOOL s_FinalizerThreadOK = FALSE;
+static BOOL s_FinalizerHelperThreadsCreated = FALSE;
 
 
 
@@ -339,6 +490,12 @@ VOID FinalizerThread::FinalizerThreadWorker(void *args)
         {
             GetFinalizerThread()->DoExtraWorkForFinalizer();
         }
+        if (!s_FinalizerHelperThreadsCreated && g_fEEStarted)
+        {
+            s_FinalizerHelperThreadsCreated = TRUE;
+            CreateHelperThreads();
+        }
+
         LOG((LF_GC, LL_INFO100, "***** Calling Finalizers\n"));
         // We may mark the finalizer thread for abort.  If so the abort request is for previous finalizer method, not for next one.
         if (GetFinalizerThread()->IsAbortRequested())
@@ -467,6 +624,133 @@ DWORD WINAPI FinalizerThread::FinalizerThreadStart(void *args)
     return 0;
 }
 
+VOID FinalizerThread::FinalizerHelperThreadWorker(void *args)
+{
+    SCAN_IGNORE_THROW;
+    SCAN_IGNORE_TRIGGER;
+
+    Thread *pThread = GetThread();
+    DWORD index = 0;
+    while (helperThreads[index] != pThread)
+    {
+        index++;
+        _ASSERTE(index < kMaxHelperThreads);
+    }
+
+    while (!fQuitFinalizer)
+    {
+        _ASSERTE(pThread->PreemptiveGCDisabled());
+        pThread->EnablePreemptiveGC();
+        hEventHelperWork[index]->Wait(INFINITE, FALSE);
+        pThread->DisablePreemptiveGC();
+
+        helperInBatch[index] = TRUE;
+        RunFinalizerBatch(pThread);
+        helperInBatch[index] = FALSE;
+
+        if (FastInterlockDecrement(&cBusyHelpers) == 0)
+        {
+            hEventHelpersDone->Set();
+        }
+    }
+}
+
+DWORD WINAPI FinalizerThread::FinalizerHelperThreadStart(void *args)
+{
+    SCAN_IGNORE_THROW;
+    SCAN_IGNORE_TRIGGER;
+
+    DWORD index = (DWORD)(size_t)args;
+    Thread *pThread = helperThreads[index];
+
+    LOG((LF_GC, LL_INFO10, "Finalizer helper thread %d starting...\n", index));
+
+    if (pThread->HasStarted())
+    {
+        INSTALL_UNHANDLED_MANAGED_EXCEPTION_TRAP;
+
+        pThread->SetBackground(TRUE);
+
+        while (!fQuitFinalizer)
+        {
+            // Same exception policy as the finalizer thread.
+            ManagedThreadBase::FinalizerBase(FinalizerHelperThreadWorker);
+
+            // If we came out on an exception in the middle of a batch the finalizer
+            // thread is still waiting for us. The rest of the batch is picked up by
+            // the other threads.
+            if (helperInBatch[index])
+            {
+                helperInBatch[index] = FALSE;
+                if (FastInterlockDecrement(&cBusyHelpers) == 0)
+                {
+                    hEventHelpersDone->Set();
+                }
+            }
+        }
+
+        UNINSTALL_UNHANDLED_MANAGED_EXCEPTION_TRAP;
+
+        pThread->EnablePreemptiveGC();
+    }
+
+    return 0;
+}
+
+void FinalizerThread::CreateHelperThreads()
+{
+    CONTRACTL{
+        NOTHROW;
+        GC_TRIGGERS;
+        MODE_COOPERATIVE;
+    } CONTRACTL_END;
+
+    DWORD cRequested = min(CLRConfig::GetConfigValue(CLRConfig::UNSUPPORTED_FinalizerHelperThreadCount),
+                           (DWORD)kMaxHelperThreads);
+    if (cRequested == 0)
+    {
+        return;
+    }
+
+    EX_TRY
+    {
+        hEventHelpersDone = new CLREvent();
+        hEventHelpersDone->CreateAutoEvent(FALSE);
+
+        // One extra slot to carry the object that ended the previous batch.
+        PTRARRAYREF batch = (PTRARRAYREF)AllocateObjectArray(kFinalizerBatchSize + 1, g_pObjectClass);
+        hFinalizerBatch = CreateGlobalStrongHandle(batch);
+
+        for (DWORD i = 0; i < cRequested; i++)
+        {
+            hEventHelperWork[i] = new CLREvent();
+            hEventHelperWork[i]->CreateAutoEvent(FALSE);
+
+            Thread *pThread = SetupUnstartedThread();
+            helperThreads[i] = pThread;
+
+            if (!pThread->CreateNewThread(0, &FinalizerHelperThreadStart, (void *)(size_t)i, W(".NET Finalizer Helper")))
+            {
+                helperThreads[i] = NULL;
+                pThread->DecExternalCount(FALSE);
+                break;
+            }
+
+            pThread->StartThread();
+
+            // Only published once the thread can pick up work.
+            cHelperThreads = i + 1;
+        }
+    }
+    EX_CATCH
+    {
+        // We just run with whatever helpers we managed to start, possibly none.
+    }
+    EX_END_CATCH(SwallowAllExceptions);
+
+    LOG((LF_GC, LL_INFO10, "Started %d finalizer helper threads\n", cHelperThreads));
+}
+
 void FinalizerThread::FinalizerThreadCreate()
 {
     CONTRACTL{
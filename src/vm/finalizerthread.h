@@ -31,12 +31,37 @@ class FinalizerThread
 
     static HANDLE MHandles[kHandleCount];
 
+    // Helper threads that run finalizers alongside the finalizer thread, see
+    // code:FinalizerThread::FinalizeObjectsInBatches.
+    enum
+    {
+        kMaxHelperThreads       = 16,
+        kFinalizerBatchSize     = 256,
+        // Below this many objects a batch is not worth waking the helpers for
+        kMinParallelBatchSize   = 16,
+    };
+
+    static DWORD cHelperThreads;
+    static Thread *helperThreads[kMaxHelperThreads];
+    static CLREvent *hEventHelperWork[kMaxHelperThreads];
+    static BOOL helperInBatch[kMaxHelperThreads];
+    static CLREvent *hEventHelpersDone;
+    static OBJECTHANDLE hFinalizerBatch;
+    static Volatile<LONG> cBatchObjects;
+    static Volatile<LONG> iNextBatchObject;
+    static Volatile<LONG> cBusyHelpers;
+
     static void WaitForFinalizerEvent (CLREvent *event);
 
     static void DoOneFinalization(Object* fobj, Thread* pThread);
 
     static void FinalizeAllObjects(int bitToCheck);
 
+    static void CreateHelperThreads();
+    static unsigned int FinalizeObjectsInBatches(int bitToCheck);
+    static void RunFinalizerBatch(Thread* pThread);
+    static void WaitForHelpers();
+
 public:
     static Thread* GetFinalizerThread() 
     {
@@ -76,6 +101,9 @@ public:
     static VOID FinalizerThreadWorker(void *args);
     static DWORD WINAPI FinalizerThreadStart(void *args);
 
+    static VOID FinalizerHelperThreadWorker(void *args);
+    static DWORD WINAPI FinalizerHelperThreadStart(void *args);
+
     static void FinalizerThreadCreate();
 };
 
@@ -933,6 +933,7 @@ void GCToEEInterface::StompWriteBarrier(WriteBarrierParameters* args)
         assert(args->ephemeral_high != nullptr);
         g_ephemeral_low = args->ephemeral_low;
         g_ephemeral_high = args->ephemeral_high;
+        g_gen0_low = (args->gen0_low != nullptr) ? args->gen0_low : (uint8_t*)~0;
         stompWBCompleteActions |= ::StompWriteBarrierEphemeral(args->is_runtime_suspended);
         break;
     case WriteBarrierOp::Initialize:
@@ -965,6 +966,7 @@ void GCToEEInterface::StompWriteBarrier(WriteBarrierParameters* args)
         // called with the parameters (true, false), as it is above.
         g_ephemeral_low = args->ephemeral_low;
         g_ephemeral_high = args->ephemeral_high;
+        g_gen0_low = (args->gen0_low != nullptr) ? args->gen0_low : (uint8_t*)~0;
         stompWBCompleteActions |= ::StompWriteBarrierEphemeral(true);
         break;
     case WriteBarrierOp::SwitchToWriteWatch:
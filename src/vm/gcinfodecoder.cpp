@@ -65,6 +65,33 @@
     }
 #endif // !LOG_PIPTR
 
+//--------------------------------------------------------------------------
+// Helpers for walking live state bit vectors a word at a time
+//--------------------------------------------------------------------------
+
+static inline UINT32 LowestSetBitIndex(size_t bits)
+{
+    _ASSERTE(bits != 0);
+    DWORD index;
+#ifdef BIT64
+    BitScanForward64(&index, bits);
+#else
+    BitScanForward(&index, bits);
+#endif
+    return (UINT32)index;
+}
+
+static inline UINT32 CountSetBits(size_t bits)
+{
+    UINT32 count = 0;
+    while(bits != 0)
+    {
+        bits &= (bits - 1);
+        count++;
+    }
+    return count;
+}
+
 bool GcInfoDecoder::SetIsInterruptibleCB (UINT32 startOffset, UINT32 stopOffset, void * hCallback)
 {
     GcInfoDecoder *pThis = (GcInfoDecoder*)hCallback;
@@ -784,19 +811,23 @@ bool GcInfoDecoder::EnumerateLiveSlots(
                 m_Reader.Skip(m_SafePointIndex * numSlots);
             }
 
-            for(UINT32 slotIndex = 0; slotIndex < numSlots; slotIndex++)
+            // Read the live state a word at a time and only visit the set bits
+            for(UINT32 slotBase = 0; slotBase < numSlots; slotBase += BITS_PER_SIZE_T)
             {
-                if(m_Reader.ReadOneFast())
+                UINT32 numBits = min(numSlots - slotBase, (UINT32)BITS_PER_SIZE_T);
+                size_t liveBits = m_Reader.Read(numBits);
+                while(liveBits != 0)
                 {
                     ReportSlotToGC(
                             slotDecoder,
-                            slotIndex,
+                            slotBase + LowestSetBitIndex(liveBits),
                             pRD,
                             reportScratchSlots,
                             inputFlags,
                             pCallBack,
                             hCallBack
                             );
+                    liveBits &= (liveBits - 1);
                 }
             }
             goto ReportUntracked;
@@ -871,10 +902,10 @@ bool GcInfoDecoder::EnumerateLiveSlots(
             }
             else 
             {
-                for(UINT32 i = 0; i < numSlots; i++)
+                for(UINT32 slotBase = 0; slotBase < numSlots; slotBase += BITS_PER_SIZE_T)
                 {
-                    if(m_Reader.ReadOneFast())
-                        numCouldBeLiveSlots++;
+                    UINT32 numBits = min(numSlots - slotBase, (UINT32)BITS_PER_SIZE_T);
+                    numCouldBeLiveSlots += CountSetBits(m_Reader.Read(numBits));
                 }
             }
             _ASSERTE(numCouldBeLiveSlots > 0);
@@ -299,6 +299,19 @@ ClassLoader::CreateTypeHandleForNonCanonicalGenericInstantiation(
     BOOL canShareVtableChunks = MethodTable::CanShareVtableChunksFrom(pOldMT, pLoaderModule);
 #endif // FEATURE_PREJIT
 
+    // Instantiations over types from other modules (e.g. List<MyType>) live in a different loader module
+    // than their canonical method table. Every virtual slot of a non-canonical instantiation is the same
+    // as the canonical's, so the chunks can still be shared as long as the canonical method table cannot
+    // be unloaded before this one. The canonical's chunks must not be zapped since slots may be written
+    // through this method table, and NGen needs to decide sharing itself in MethodTable::Save.
+    if (!canShareVtableChunks &&
+        !IsCompilationProcess() &&
+        !pOldMT->IsZapped() &&
+        !pOldMT->GetLoaderAllocator()->IsCollectible())
+    {
+        canShareVtableChunks = TRUE;
+    }
+
     SIZE_T offsetOfUnsharedVtableChunks = allocSize.Value();
 
     // We either share all of the canonical's virtual slots or none of them
@@ -291,6 +291,39 @@ static MethodDesc * FindTightlyBoundUnboxingStub_DEBUG(MethodDesc * pMD)
 }
 #endif // _DEBUG
 
+// Choose the number of slots in the first bucket of a shared generic method's
+// dictionary. Lookups that do not fit in the first bucket are served by the much
+// slower JIT_GenericHandle helper, so larger methods (which tend to need more
+// generic lookups) get more slots up front.
+static WORD GetNumMethodDictionarySlots(MethodDesc* pGenericMD)
+{
+    CONTRACTL
+    {
+        THROWS;
+        GC_NOTRIGGER;
+    }
+    CONTRACTL_END
+
+    const WORD minSlots = 4;
+    const WORD maxSlots = 16;
+
+    if (!pGenericMD->HasILHeader())
+    {
+        return minSlots;
+    }
+
+    COR_ILMETHOD_DECODER::DecoderStatus status = COR_ILMETHOD_DECODER::FORMAT_ERROR;
+    COR_ILMETHOD_DECODER header(pGenericMD->GetILHeader(), pGenericMD->GetMDImport(), &status);
+    if (status != COR_ILMETHOD_DECODER::SUCCESS)
+    {
+        return minSlots;
+    }
+
+    // Roughly one extra slot for every 32 bytes of IL
+    DWORD numSlots = minSlots + header.GetCodeSize() / 32;
+    return (WORD)min(numSlots, (DWORD)maxSlots);
+}
+
 /* static */
 InstantiatedMethodDesc *
 InstantiatedMethodDesc::NewInstantiatedMethodDesc(MethodTable *pExactMT,
@@ -378,8 +411,7 @@ InstantiatedMethodDesc::NewInstantiatedMethodDesc(MethodTable *pExactMT,
             }
             else if (getWrappedCode)
             {
-                // 4 seems like a good number
-                pDL = DictionaryLayout::Allocate(4, pAllocator, &amt);
+                pDL = DictionaryLayout::Allocate(GetNumMethodDictionarySlots(pGenericMDescInRepMT), pAllocator, &amt);
 #ifdef _DEBUG 
                 {
                     SString name;
@@ -20,6 +20,7 @@
 #include "common.h"
 #include "hillclimbing.h"
 #include "win32threadpool.h"
+#include "threadpoolrequest.h"
 
 //
 // Default compilation mode is /fp:precise, which disables fp intrinsics. This causes us to pull in FP stuff (sin,cos,etc.) from
@@ -57,6 +58,7 @@ void HillClimbing::Initialize()
     m_throughputErrorSmoothingFactor = (double)CLRConfig::GetConfigValue(CLRConfig::INTERNAL_HillClimbing_ErrorSmoothingFactor) / 100.0;
     m_gainExponent = (double)CLRConfig::GetConfigValue(CLRConfig::INTERNAL_HillClimbing_GainExponent) / 100.0;
     m_maxSampleError = (double)CLRConfig::GetConfigValue(CLRConfig::INTERNAL_HillClimbing_MaxSampleErrorPercent) / 100.0;
+    m_favorLatency = CLRConfig::GetConfigValue(CLRConfig::INTERNAL_HillClimbing_FavorLatency) != 0;
     m_currentControlSetting = 0;
     m_totalSamples = 0;
     m_lastThreadCount = 0;
@@ -274,6 +276,14 @@ int HillClimbing::Update(int currentThreadCount, double sampleDuration, int numC
     if (move > 0.0 && ThreadpoolMgr::cpuUtilization > CpuUtilizationHigh)
         move = 0.0;
 
+    //
+    // If we're optimizing for latency rather than throughput, don't give up threads while work is still
+    // queued.  A small throughput gain from fewer threads isn't worth the extra queueing delay, and backing
+    // off here just makes us climb right back up a few samples later.
+    //
+    if (move < 0.0 && m_favorLatency && PerAppDomainTPCountList::AreRequestsPendingInAnyAppDomains())
+        move = 0.0;
+
     //
     // Apply the move to our control setting
     // 
@@ -49,6 +49,7 @@ private:
     double m_throughputErrorSmoothingFactor;
     double m_gainExponent;
     double m_maxSampleError;
+    bool m_favorLatency;
 
     double m_currentControlSetting;
     LONGLONG m_totalSamples;
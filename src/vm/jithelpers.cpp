@@ -2663,6 +2663,75 @@ HCIMPL1(Object*, JIT_NewS_MP_FastPortable, CORINFO_CLASS_HANDLE typeHnd_)
 }
 HCIMPLEND
 
+//*************************************************************
+// Allocation fast path for boxing value types
+//
+HCIMPL2(Object*, JIT_Box_MP_FastPortable, CORINFO_CLASS_HANDLE type, void* unboxedData)
+{
+    FCALL_CONTRACT;
+
+    do
+    {
+        _ASSERTE(GCHeapUtilities::UseThreadAllocationContexts());
+
+        Thread *thread = GetThread();
+
+        TypeHandle typeHandle(type);
+        _ASSERTE(!typeHandle.IsTypeDesc());
+        MethodTable *methodTable = typeHandle.AsMethodTable();
+
+        // The slow helper restores the type and rejects non value types
+        if (!methodTable->IsRestored_NoLogging() || !methodTable->IsValueType())
+        {
+            break;
+        }
+        _ASSERTE(!methodTable->IsNullable());
+
+#ifdef FEATURE_64BIT_ALIGNMENT
+        // The boxed payload may need 8 byte alignment, leave that to the allocator
+        if (methodTable->RequiresAlign8())
+        {
+            break;
+        }
+#endif // FEATURE_64BIT_ALIGNMENT
+
+        SIZE_T size = methodTable->GetBaseSize();
+        _ASSERTE(size % DATA_ALIGNMENT == 0);
+
+        gc_alloc_context *allocContext = thread->GetAllocContext();
+        BYTE *allocPtr = allocContext->alloc_ptr;
+        _ASSERTE(allocPtr <= allocContext->alloc_limit);
+        if (size > static_cast<SIZE_T>(allocContext->alloc_limit - allocPtr))
+        {
+            break;
+        }
+        allocContext->alloc_ptr = allocPtr + size;
+
+        _ASSERTE(allocPtr != nullptr);
+        Object *object = reinterpret_cast<Object *>(allocPtr);
+        _ASSERTE(object->HasEmptySyncBlockInfo());
+        object->SetMethodTable(methodTable);
+
+        // The new object is not published yet, so copying GC refs into it
+        // through the write barrier cannot race with a collection.
+        if (methodTable->ContainsPointers())
+        {
+            CopyValueClassUnchecked(object->GetData(), unboxedData, methodTable);
+        }
+        else
+        {
+            memcpyNoGCRefs(object->GetData(), unboxedData, methodTable->GetNumInstanceFieldBytes());
+        }
+
+        return object;
+    } while (false);
+
+    // Tail call to the slow helper
+    ENDFORBIDGC();
+    return HCCALL2(JIT_Box, type, unboxedData);
+}
+HCIMPLEND
+
 #include <optdefault.h>
 
 /*************************************************************/
@@ -5242,6 +5311,97 @@ HCIMPL1(void, JIT_LogMethodEnter, CORINFO_METHOD_HANDLE methHnd_)
 
 HCIMPLEND
 
+/*************************************************************/
+// Cheap xorshift generator for the class profile reservoir. The state is shared
+// by all threads without synchronization, racing updates only make the sample
+// a little less random.
+static UINT32 s_classProfileRandState = 0x2545F491;
+
+static UINT32 ClassProfileRand()
+{
+    LIMITED_METHOD_CONTRACT;
+
+    UINT32 x = s_classProfileRandState;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    s_classProfileRandState = x;
+    return x;
+}
+
+HCIMPL2(void, JIT_ClassProfile, Object *obj, void* tableAddress)
+{
+    FCALL_CONTRACT;
+    FC_GC_POLL_NOT_NEEDED();
+
+    OBJECTREF objRef = ObjectToOBJECTREF(obj);
+    VALIDATEOBJECTREF(objRef);
+
+    // The call that follows the probe reports the null reference
+    if (objRef == NULL)
+    {
+        return;
+    }
+
+    ICorJitInfo::ClassProfile* const classProfile = (ICorJitInfo::ClassProfile*)tableAddress;
+    MethodTable* pMT = objRef->GetMethodTable();
+
+    // The profile outlives any class that can be unloaded, so those are
+    // recorded as unknown and never become a guess for tier1
+    if (pMT->Collectible())
+    {
+        pMT = NULL;
+    }
+
+    // Updates from other threads may be lost, that only costs precision
+    const UINT32 count = classProfile->Count++;
+
+    // Keep the first SIZE classes, after that replace a random table entry
+    // with probability SIZE/count so the table stays a uniform sample
+    UINT32 index = count;
+    if (count >= ICorJitInfo::ClassProfile::SIZE)
+    {
+        index = (UINT32)(ClassProfileRand() % ((UINT64)count + 1));
+        if (index >= ICorJitInfo::ClassProfile::SIZE)
+        {
+            return;
+        }
+    }
+
+    classProfile->ClassTable[index] = (CORINFO_CLASS_HANDLE)pMT;
+}
+HCIMPLEND
+
+/*************************************************************/
+// Called from a loop in tier0 code once the frame's patchpoint counter runs
+// out. The frame keeps running tier0 code, the method is queued for tier1 so
+// the next call to it gets optimized code.
+HCIMPL2(void, JIT_Patchpoint, int* counter, CORINFO_METHOD_HANDLE methHnd_)
+{
+    FCALL_CONTRACT;
+
+    // Only ask once per frame
+    *counter = INT_MAX;
+
+#ifdef FEATURE_TIERED_COMPILATION
+    MethodDesc* pMD = GetMethod(methHnd_);
+
+    if (!pMD->IsEligibleForTieredCompilation() || !g_pConfig->TieredCompilation_CallCounting())
+    {
+        return;
+    }
+
+    HELPER_METHOD_FRAME_BEGIN_0();
+    GCX_PREEMP();
+
+    LOG((LF_TIEREDCOMPILATION, LL_INFO10000, "JIT_Patchpoint: promoting Method=0x%pM\n", pMD));
+    GetAppDomain()->GetTieredCompilationManager()->AsyncPromoteMethodToTier1(pMD, true /* isHot */);
+
+    HELPER_METHOD_FRAME_END();
+#endif // FEATURE_TIERED_COMPILATION
+}
+HCIMPLEND
+
 
 
 //========================================================================
@@ -66,6 +66,8 @@
 #include "perfmap.h"
 #endif
 
+#include "pgo.h"
+
 // The Stack Overflow probe takes place in the COOPERATIVE_TRANSITION_BEGIN() macro
 //
 
@@ -12026,8 +12028,6 @@ HRESULT CEEJitInfo::allocMethodBlockCounts (
 
     JIT_TO_EE_TRANSITION();
 
-#ifdef FEATURE_PREJIT
-
     // We need to know the code size. Typically we can get the code size
     // from m_ILHeader. For dynamic methods, m_ILHeader will be NULL, so
     // for that case we need to use DynamicResolver to get the code size.
@@ -12044,21 +12044,32 @@ HRESULT CEEJitInfo::allocMethodBlockCounts (
     {
         codeSize = m_ILHeader->GetCodeSize();    
     }
-    
-    *pBlockCounts = m_pMethodBeingCompiled->GetLoaderModule()->AllocateMethodBlockCounts(m_pMethodBeingCompiled->GetMemberDef(), count, codeSize);
-    hr = (*pBlockCounts != nullptr) ? S_OK : E_OUTOFMEMORY;
+
+#ifdef FEATURE_TIERED_COMPILATION
+    // Instrumented tier0 code keeps its counts in process for the tier1 rejit
+    if (m_jitFlags.IsSet(CORJIT_FLAGS::CORJIT_FLAG_TIER0))
+    {
+        hr = PgoManager::allocMethodBlockCounts(m_pMethodBeingCompiled, count, pBlockCounts, codeSize);
+    }
+    else
+#endif // FEATURE_TIERED_COMPILATION
+    {
+#ifdef FEATURE_PREJIT
+        *pBlockCounts = m_pMethodBeingCompiled->GetLoaderModule()->AllocateMethodBlockCounts(m_pMethodBeingCompiled->GetMemberDef(), count, codeSize);
+        hr = (*pBlockCounts != nullptr) ? S_OK : E_OUTOFMEMORY;
 #else // FEATURE_PREJIT
-    _ASSERTE(!"allocMethodBlockCounts not implemented on CEEJitInfo!");
-    hr = E_NOTIMPL;
+        _ASSERTE(!"allocMethodBlockCounts not implemented on CEEJitInfo!");
+        hr = E_NOTIMPL;
 #endif // !FEATURE_PREJIT
+    }
 
     EE_TO_JIT_TRANSITION();
     
     return hr;
 }
 
-// Consider implementing getBBProfileData on CEEJitInfo.  This will allow us
-// to use profile info in codegen for non zapped images.
+// Profile data is only available for methods that were instrumented at tier0
+// and are now being jitted at tier1.
 HRESULT CEEJitInfo::getMethodBlockCounts (
     CORINFO_METHOD_HANDLE         ftnHnd,
     UINT32 *                      pCount,          // pointer to the count of <ILOffset, ExecutionCount> tuples
@@ -12066,8 +12077,24 @@ HRESULT CEEJitInfo::getMethodBlockCounts (
     UINT32 *                      pNumRuns
     )
 {
-    LIMITED_METHOD_CONTRACT;
-    _ASSERTE(!"getMethodBlockCounts not implemented on CEEJitInfo!");
+    CONTRACTL {
+        NOTHROW;
+        GC_NOTRIGGER;
+        MODE_PREEMPTIVE;
+    } CONTRACTL_END;
+
+    *pCount = 0;
+    *pBlockCounts = NULL;
+    *pNumRuns = 0;
+
+#ifdef FEATURE_TIERED_COMPILATION
+    MethodDesc* pMD = GetMethod(ftnHnd);
+    if ((pMD == m_pMethodBeingCompiled) && (m_ILHeader != NULL))
+    {
+        return PgoManager::getMethodBlockCounts(pMD, m_ILHeader->GetCodeSize(), pCount, pBlockCounts, pNumRuns);
+    }
+#endif // FEATURE_TIERED_COMPILATION
+
     return E_NOTIMPL;
 }
 
@@ -12758,9 +12785,17 @@ CORJIT_FLAGS GetCompileFlags(MethodDesc * ftn, CORJIT_FLAGS flags, CORINFO_METHO
 
     flags.Set(CORJIT_FLAGS::CORJIT_FLAG_SKIP_VERIFICATION);
 
-    if (ftn->IsILStub() && !g_pConfig->GetTrackDynamicMethodDebugInfo())
+    // Concurrent GC can only be turned on at runtime (e.g. through GCSettings.LatencyMode) if
+    // it was enabled at startup, so this holds for the lifetime of the code.
+    if (!g_pConfig->GetGCconcurrent())
+    {
+        flags.Set(CORJIT_FLAGS::CORJIT_FLAG_NO_CONCURRENT_GC);
+    }
+
+    if (ftn->IsDynamicMethod() && !g_pConfig->GetTrackDynamicMethodDebugInfo())
     {
-        // no debug info available for IL stubs
+        // no debug info available for IL stubs and LCG methods, CEEJitInfo::CompressDebugInfo
+        // drops it anyway so don't make the JIT compute it
         flags.Clear(CORJIT_FLAGS::CORJIT_FLAG_DEBUG_INFO);
     }
 
@@ -219,6 +219,7 @@ EXTERN_C FCDECL2(Object*, JIT_IsInstanceOfInterface_Portable, MethodTable* pMT,
 
 extern FCDECL1(Object*, JIT_NewS_MP_FastPortable, CORINFO_CLASS_HANDLE typeHnd_);
 extern FCDECL1(Object*, JIT_New, CORINFO_CLASS_HANDLE typeHnd_);
+extern FCDECL2(Object*, JIT_Box_MP_FastPortable, CORINFO_CLASS_HANDLE type, void* data);
 
 #ifndef JIT_NewCrossContext
 #define JIT_NewCrossContext JIT_NewCrossContext_Portable
@@ -302,6 +303,11 @@ public:
         WRITE_BARRIER_POSTGROW64,
 #ifdef FEATURE_SVR_GC
         WRITE_BARRIER_SVR64,
+#endif // FEATURE_SVR_GC
+        WRITE_BARRIER_PRECISE_POSTGROW64,
+        WRITE_BARRIER_GEN0_FILTER_POSTGROW64,
+#ifdef FEATURE_SVR_GC
+        WRITE_BARRIER_PRECISE_SVR64,
 #endif // FEATURE_SVR_GC
 #ifdef FEATURE_USE_SOFTWARE_WRITE_WATCH_FOR_GC_HEAP
         WRITE_BARRIER_WRITE_WATCH_PREGROW64,
@@ -336,12 +342,15 @@ private:
     void Validate();
     
     WriteBarrierType    m_currentWriteBarrier;
+    bool                m_usePreciseCardMarking;
+    bool                m_useGen0Filter;
 
     PBYTE   m_pWriteWatchTableImmediate;    // PREGROW | POSTGROW | SVR | WRITE_WATCH |
-    PBYTE   m_pLowerBoundImmediate;         // PREGROW | POSTGROW |     | WRITE_WATCH |
-    PBYTE   m_pCardTableImmediate;          // PREGROW | POSTGROW | SVR | WRITE_WATCH |
-    PBYTE   m_pCardBundleTableImmediate;    // PREGROW | POSTGROW | SVR | WRITE_WATCH |
-    PBYTE   m_pUpperBoundImmediate;         //         | POSTGROW |     | WRITE_WATCH |
+    PBYTE   m_pLowerBoundImmediate;         // PREGROW | POSTGROW |     | WRITE_WATCH | PRECISE | GEN0_FILTER
+    PBYTE   m_pCardTableImmediate;          // PREGROW | POSTGROW | SVR | WRITE_WATCH | PRECISE | GEN0_FILTER
+    PBYTE   m_pCardBundleTableImmediate;    // PREGROW | POSTGROW | SVR | WRITE_WATCH | PRECISE | GEN0_FILTER
+    PBYTE   m_pUpperBoundImmediate;         //         | POSTGROW |     | WRITE_WATCH | PRECISE | GEN0_FILTER
+    PBYTE   m_pGen0LowImmediate;            //         |          |     |             |         | GEN0_FILTER
 };
 
 #endif // _TARGET_AMD64_
@@ -1057,6 +1057,69 @@ void LoaderAllocator::ActivateManagedTracking()
 #define COLLECTIBLE_CODEHEAP_SIZE                  (7 * GetOsPageSize())
 #define COLLECTIBLE_VIRTUALSTUBDISPATCH_HEAP_SPACE (5 * GetOsPageSize())
 
+#ifndef CROSSGEN_COMPILE
+// The initial reservations of unloaded collectible LoaderAllocators are decommitted and kept
+// here for reuse by new collectible LoaderAllocators, so that repeatedly loading and unloading
+// collectible assemblies does not keep reserving fresh address space.
+#define MAX_CACHED_COLLECTIBLE_RESERVATIONS 16
+
+static BYTE * s_cachedCollectibleReservations[MAX_CACHED_COLLECTIBLE_RESERVATIONS];
+
+static DWORD GetCollectibleReserveMemSize()
+{
+    LIMITED_METHOD_CONTRACT;
+
+    DWORD dwSize = COLLECTIBLE_LOW_FREQUENCY_HEAP_SIZE
+                 + COLLECTIBLE_HIGH_FREQUENCY_HEAP_SIZE
+                 + COLLECTIBLE_STUB_HEAP_SIZE
+                 + COLLECTIBLE_CODEHEAP_SIZE
+                 + COLLECTIBLE_VIRTUALSTUBDISPATCH_HEAP_SPACE;
+
+    return (DWORD) ALIGN_UP(dwSize, VIRTUAL_ALLOC_RESERVE_GRANULARITY);
+}
+
+static BYTE * TakeCachedCollectibleReservation()
+{
+    LIMITED_METHOD_CONTRACT;
+
+    for (int i = 0; i < MAX_CACHED_COLLECTIBLE_RESERVATIONS; i++)
+    {
+        BYTE * pMem = VolatileLoad(&s_cachedCollectibleReservations[i]);
+        if ((pMem != NULL) &&
+            (InterlockedCompareExchangeT(&s_cachedCollectibleReservations[i], (BYTE *)NULL, pMem) == pMem))
+        {
+            return pMem;
+        }
+    }
+
+    return NULL;
+}
+
+static void ReleaseCollectibleReservation(BYTE * pMem)
+{
+    CONTRACTL {
+        NOTHROW;
+        GC_NOTRIGGER;
+        MODE_ANY;
+    } CONTRACTL_END;
+
+    // Drop all the pages committed by the loader heaps; only the reservation is kept around
+    if (ClrVirtualFree(pMem, GetCollectibleReserveMemSize(), MEM_DECOMMIT))
+    {
+        for (int i = 0; i < MAX_CACHED_COLLECTIBLE_RESERVATIONS; i++)
+        {
+            if ((VolatileLoad(&s_cachedCollectibleReservations[i]) == NULL) &&
+                (InterlockedCompareExchangeT(&s_cachedCollectibleReservations[i], pMem, (BYTE *)NULL) == NULL))
+            {
+                return;
+            }
+        }
+    }
+
+    ClrVirtualFree(pMem, 0, MEM_RELEASE);
+}
+#endif // !CROSSGEN_COMPILE
+
 void LoaderAllocator::Init(BaseDomain *pDomain, BYTE *pExecutableHeapMemory)
 {
     STANDARD_VM_CONTRACT;
@@ -1129,7 +1192,20 @@ void LoaderAllocator::Init(BaseDomain *pDomain, BYTE *pExecutableHeapMemory)
     _ASSERTE(dwTotalReserveMemSize <= VIRTUAL_ALLOC_RESERVE_GRANULARITY);
 #endif
 
-    BYTE * initReservedMem = ClrVirtualAllocExecutable(dwTotalReserveMemSize, MEM_RESERVE, PAGE_NOACCESS);
+    BYTE * initReservedMem = NULL;
+
+#ifndef CROSSGEN_COMPILE
+    if (IsCollectible())
+    {
+        _ASSERTE(dwTotalReserveMemSize == GetCollectibleReserveMemSize());
+        initReservedMem = TakeCachedCollectibleReservation();
+    }
+
+    if (initReservedMem == NULL)
+#endif // !CROSSGEN_COMPILE
+    {
+        initReservedMem = ClrVirtualAllocExecutable(dwTotalReserveMemSize, MEM_RESERVE, PAGE_NOACCESS);
+    }
 
     m_InitialReservedMemForLoaderHeaps = initReservedMem;
 
@@ -1387,7 +1463,10 @@ void LoaderAllocator::Terminate()
     // This was the block reserved by BaseDomain::Init for the loaderheaps.
     if (m_InitialReservedMemForLoaderHeaps)
     {
-        ClrVirtualFree (m_InitialReservedMemForLoaderHeaps, 0, MEM_RELEASE);
+        if (IsCollectible())
+            ReleaseCollectibleReservation(m_InitialReservedMemForLoaderHeaps);
+        else
+            ClrVirtualFree (m_InitialReservedMemForLoaderHeaps, 0, MEM_RELEASE);
         m_InitialReservedMemForLoaderHeaps=NULL;
     }
 
@@ -1695,7 +1774,7 @@ STRINGREF *LoaderAllocator::GetStringObjRefPtrFromUnicodeString(EEStringData *pS
         LazyInitStringLiteralMap();
     }
     _ASSERTE(m_pStringLiteralMap);
-    return m_pStringLiteralMap->GetStringLiteral(pStringData, TRUE, !CanUnload());
+    return m_pStringLiteralMap->GetStringLiteral(pStringData, TRUE);
 }
 
 //*****************************************************************************
@@ -1753,7 +1832,7 @@ STRINGREF *LoaderAllocator::IsStringInterned(STRINGREF *pString)
         LazyInitStringLiteralMap();
     }
     _ASSERTE(m_pStringLiteralMap);
-    return m_pStringLiteralMap->GetInternedString(pString, FALSE, !CanUnload());
+    return m_pStringLiteralMap->GetInternedString(pString, FALSE);
 }
 
 STRINGREF *LoaderAllocator::GetOrInternString(STRINGREF *pString)
@@ -1772,7 +1851,7 @@ STRINGREF *LoaderAllocator::GetOrInternString(STRINGREF *pString)
         LazyInitStringLiteralMap();
     }
     _ASSERTE(m_pStringLiteralMap);
-    return m_pStringLiteralMap->GetInternedString(pString, TRUE, !CanUnload());
+    return m_pStringLiteralMap->GetInternedString(pString, TRUE);
 }
 
 void AssemblyLoaderAllocator::RegisterHandleForCleanup(OBJECTHANDLE objHandle)
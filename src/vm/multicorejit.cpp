@@ -779,6 +779,40 @@ void MulticoreJitRecorder::RecordMethodJit(MethodDesc * pMethod, bool applicatio
 }
 
 
+// Mark the method as promoted to tier 1 so that playback can jit it optimized, skipping tier 0.
+// Only methods already in the profile are marked, the playback order is determined by the first JIT.
+
+void MulticoreJitRecorder::RecordMethodTier1(MethodDesc * pMethod)
+{
+    STANDARD_VM_CONTRACT;
+
+    Module * pModule = pMethod->GetModule_NoLogging();
+
+    unsigned moduleIndex = FindModule(pModule);
+
+    if (moduleIndex < UINT_MAX)
+    {
+        unsigned methodIndex = pMethod->GetMemberDef_NoLogging() & 0xFFFFFF;
+
+        if (methodIndex <= METHODINDEX_MASK)
+        {
+            unsigned info = Pack8_24(moduleIndex, methodIndex);
+
+            for (LONG i = m_JitInfoCount - 1; i >= 0; i --)
+            {
+                unsigned info0 = m_JitInfoArray[i];
+
+                if (((info0 & MODULE_DEPENDENCY) == 0) && ((info0 & ~(JIT_BY_APP_THREAD | JIT_AT_TIER1)) == info))
+                {
+                    m_JitInfoArray[i] = info0 | JIT_AT_TIER1;
+                    return;
+                }
+            }
+        }
+    }
+}
+
+
 // Called from AppDomain::RaiseAssemblyResolveEvent, make it simple
 
 void MulticoreJitRecorder::AbortProfile()
@@ -1331,6 +1365,22 @@ void MulticoreJitManager::RecordMethodJit(MethodDesc * pMethod)
 }
 
 
+// Call back from TieredCompilationManager::OptimizeMethod
+// Threading: protected by m_playerLock
+
+void MulticoreJitManager::RecordMethodTier1(MethodDesc * pMethod)
+{
+    STANDARD_VM_CONTRACT;
+
+    CrstHolder hold(& m_playerLock);
+
+    if (m_pMulticoreJitRecorder != NULL)
+    {
+        m_pMulticoreJitRecorder->RecordMethodTier1(pMethod);
+    }
+}
+
+
 // static 
 bool MulticoreJitManager::IsMethodSupported(MethodDesc * pMethod)
 {
@@ -217,6 +217,8 @@ public:
 
     void RecordMethodJit(MethodDesc * pMethod);
 
+    void RecordMethodTier1(MethodDesc * pMethod);
+
     MulticoreJitPlayerStat & GetStats()
     {
         LIMITED_METHOD_CONTRACT;
@@ -41,6 +41,7 @@ const int      MULTICOREJITBLOCKLIMIT = 10 * 1000;  // 10 seconds
                                                     // Method JIT information: 8-bit module 4-bit flag 20-bit method index
 const unsigned MODULE_DEPENDENCY = 0x800000;        //  1-bit module dependency mask
 const unsigned JIT_BY_APP_THREAD = 0x400000;        //  1-bit application thread
+const unsigned JIT_AT_TIER1      = 0x200000;        //  1-bit method was promoted to tier 1
 
 const unsigned METHODINDEX_MASK  = 0x0FFFFF;        // 20-bit method index
 
@@ -79,6 +80,7 @@ inline unsigned Pack8_24(unsigned up, unsigned low)
 //  5  Simple module name stored
 //  6  Maximum method index: 20-bit, could extend to 22 bits
 //  7  JIT_BY_APP_THREAD is for diagnosis only
+//  8  JIT_AT_TIER1 marks methods that were promoted to tier 1 while recording, they are jitted optimized during playback
 
 // <HeaderRecord>::= <recordID> <version> <timeStamp> <moduleCount> <methodCount> <DependencyCount> <unsigned short counter>*14 <unsigned counter>*3
 // <ModuleRecord>::= <recordID> <ModuleVersion> <JitMethodCount> <loadLevel> <lenModuleName> char*lenModuleName <padding>
@@ -92,7 +94,7 @@ inline unsigned Pack8_24(unsigned up, unsigned low)
 
 // <methodJitInfo>::
 //    8-bit module index,         current always 0 until we track per module dependency
-//    4-bit flag                  MODULE_DEPENDENCY is 0, JIT_BY_APP_THREAD could be 1
+//    4-bit flag                  MODULE_DEPENDENCY is 0, JIT_BY_APP_THREAD and JIT_AT_TIER1 could be 1
 //   20-bit method index
 
 
@@ -273,7 +275,7 @@ private:
     HRESULT HandleModuleRecord(const ModuleRecord * pModule);
     HRESULT HandleMethodRecord(unsigned * buffer, int count);
 
-    bool CompileMethodDesc(Module * pModule, MethodDesc * pMD);
+    bool CompileMethodDesc(Module * pModule, MethodDesc * pMD, bool optimize);
 
     HRESULT PlayProfile();
 
@@ -295,6 +297,8 @@ private:
 
     DomainAssembly * LoadAssembly(SString & assemblyName);
 
+    void PreloadAssemblies();
+
 public:
 
     MulticoreJitProfilePlayer(ICLRPrivBinder * pBinderContext, LONG nSession, bool fAppxMode);
@@ -430,6 +434,8 @@ public:
 
     void RecordMethodJit(MethodDesc * pMethod, bool application);
 
+    void RecordMethodTier1(MethodDesc * pMethod);
+
     PCODE RequestMethodCode(MethodDesc * pMethod, MulticoreJitManager * pManager);
     
     HRESULT StartProfile(const WCHAR * pRoot, const WCHAR * pFileName, int suffix, LONG nSession);
@@ -507,9 +507,12 @@ HRESULT MulticoreJitProfilePlayer::HandleModuleRecord(const ModuleRecord * pMod)
 #ifndef DACCESS_COMPILE
 class MulticoreJitPrepareCodeConfig : public PrepareCodeConfig
 {
+    bool m_optimize;
+
 public:
-    MulticoreJitPrepareCodeConfig(MethodDesc* pMethod) :
-        PrepareCodeConfig(NativeCodeVersion(pMethod), FALSE, FALSE)
+    MulticoreJitPrepareCodeConfig(MethodDesc* pMethod, bool optimize) :
+        PrepareCodeConfig(NativeCodeVersion(pMethod), FALSE, FALSE),
+        m_optimize(optimize)
     {}
     
     virtual BOOL SetNativeCode(PCODE pCode, PCODE * ppAlternateCodeToUse)
@@ -518,12 +521,32 @@ public:
         mcJitManager.GetMulticoreJitCodeStorage().StoreMethodCode(GetMethodDesc(), pCode);
         return TRUE;
     }
+
+    virtual CORJIT_FLAGS GetJitCompilationFlags()
+    {
+        STANDARD_VM_CONTRACT;
+
+        CORJIT_FLAGS flags = PrepareCodeConfig::GetJitCompilationFlags();
+
+#ifdef FEATURE_TIERED_COMPILATION
+        // The method was promoted to tier 1 when the profile was recorded, skip tier 0. This is handled like a JIT switch
+        // to optimized code, the code version's tier is updated and call counting disabled once the code is generated.
+        if (m_optimize && flags.IsSet(CORJIT_FLAGS::CORJIT_FLAG_TIER0))
+        {
+            flags.Clear(CORJIT_FLAGS::CORJIT_FLAG_TIER0);
+            flags.Clear(CORJIT_FLAGS::CORJIT_FLAG_BBINSTR);
+            SetJitSwitchedToOptimized();
+        }
+#endif
+
+        return flags;
+    }
 };
 #endif
 
 // Call JIT to compile a method
 
-bool MulticoreJitProfilePlayer::CompileMethodDesc(Module * pModule, MethodDesc * pMD)
+bool MulticoreJitProfilePlayer::CompileMethodDesc(Module * pModule, MethodDesc * pMD, bool optimize)
 {
     STANDARD_VM_CONTRACT;
     
@@ -544,7 +567,7 @@ bool MulticoreJitProfilePlayer::CompileMethodDesc(Module * pModule, MethodDesc *
         ThreadStateNCStackHolder holder(-1, Thread::TSNC_CallingManagedCodeDisabled);
 
         // PrepareCode calls back to MulticoreJitCodeStorage::StoreMethodCode under MethodDesc lock
-        MulticoreJitPrepareCodeConfig config(pMD);
+        MulticoreJitPrepareCodeConfig config(pMD, optimize);
         pMD->PrepareCode(&config);
 
         return true;
@@ -569,6 +592,8 @@ void MulticoreJitProfilePlayer::JITMethod(Module * pModule, unsigned methodIndex
 		return;
 	}
 
+    bool optimize = (methodIndex & JIT_AT_TIER1) != 0;
+
     methodIndex &= METHODINDEX_MASK; // 20-bit
 
     unsigned token = TokenFromRid(methodIndex, mdtMethodDef);
@@ -602,7 +627,7 @@ void MulticoreJitProfilePlayer::JITMethod(Module * pModule, unsigned methodIndex
         {                    
             m_busyWith = methodIndex;
 
-            bool rslt = CompileMethodDesc(pModule, pMethod);
+            bool rslt = CompileMethodDesc(pModule, pMethod, optimize);
 
             m_busyWith = EmptyToken;
 
@@ -956,6 +981,53 @@ DomainAssembly * MulticoreJitProfilePlayer::LoadAssembly(SString & assemblyName)
 }
 
 
+// Load the assemblies of all recorded modules that are not loaded yet, in recorded order, so that
+// binding and loading happens on the background thread ahead of the main thread instead of
+// one assembly at a time when the first method depending on it is reached.
+void MulticoreJitProfilePlayer::PreloadAssemblies()
+{
+    STANDARD_VM_CONTRACT;
+
+    AppDomain * pAppDomain = GetAppDomain();
+    _ASSERTE(pAppDomain != NULL);
+
+    MulticoreJitPlayerModuleEnumerator moduleEnumerator(this);
+    moduleEnumerator.EnumerateLoadedModules(pAppDomain);
+
+    unsigned nLoaded = 0;
+
+    for (unsigned i = 0; i < m_moduleCount; i++)
+    {
+        if (ShouldAbort(false))
+        {
+            break;
+        }
+
+        PlayerModuleInfo & mod = m_pModules[i];
+
+        if (mod.m_pModule != NULL)
+        {
+            continue;
+        }
+
+        SString assemblyName;
+        assemblyName.SetASCII(mod.m_pRecord->GetAssemblyName(), mod.m_pRecord->AssemblyNameLen());
+
+        DomainAssembly * pDomainAssembly = LoadAssembly(assemblyName);
+
+        if (pDomainAssembly != NULL)
+        {
+            moduleEnumerator.HandleAssembly(pDomainAssembly);
+            nLoaded ++;
+        }
+    }
+
+    MulticoreJitTrace(("PreloadAssemblies loaded %d assemblies", nLoaded));
+
+    _FireEtwMulticoreJit(W("PRELOAD"), W(""), nLoaded, m_moduleCount, 0);
+}
+
+
 inline bool MethodJifInfo(unsigned inst)
 {
     LIMITED_METHOD_CONTRACT;
@@ -1237,6 +1309,8 @@ HRESULT MulticoreJitProfilePlayer::PlayProfile()
 
     unsigned nSize = m_nFileSize;
 
+    bool fPreloadAssemblies = CLRConfig::GetConfigValue(CLRConfig::INTERNAL_MultiCoreJitPreloadAssemblies) != 0;
+
     MulticoreJitTrace(("PlayProfile %d bytes in (%s)", 
         nSize,
         GetAppDomain()->GetFriendlyNameForLogging()));
@@ -1271,6 +1345,14 @@ HRESULT MulticoreJitProfilePlayer::PlayProfile()
             }
             else if (rcdTyp == MULTICOREJIT_JITINF_RECORD_ID)
             {
+                // All module records precede the method records
+                if (fPreloadAssemblies)
+                {
+                    fPreloadAssemblies = false;
+
+                    PreloadAssemblies();
+                }
+
                 int mCount = (rcdLen - sizeof(unsigned)) / sizeof(unsigned);
 
                 hr = HandleMethodRecord((unsigned *) (pBuffer + sizeof(unsigned)), mCount);
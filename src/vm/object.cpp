@@ -1511,7 +1511,12 @@ void StackTraceArray::Grow(size_t grow_size)
 
     if (!m_array)
     {
-        SetArray(I1ARRAYREF(AllocatePrimitiveArray(ELEMENT_TYPE_I1, static_cast<DWORD>(raw_size))));
+        // The stack trace of a thrown exception is built one frame at a time during the
+        // first pass. Start with room for a few frames so that typical throws don't have
+        // to reallocate and copy the array at every level.
+        size_t initial_size = Max(grow_size, (size_t)INITIAL_CAPACITY) * sizeof(StackTraceElement) + sizeof(ArrayHeader);
+
+        SetArray(I1ARRAYREF(AllocatePrimitiveArray(ELEMENT_TYPE_I1, static_cast<DWORD>(initial_size))));
         SetSize(0);
         SetObjectThread();
     }
@@ -2227,6 +2227,9 @@ typedef DPTR(StackTraceElement) PTR_StackTraceElement;
 
 class StackTraceArray
 {
+    // Number of elements allocated when the array is first created
+    static const size_t INITIAL_CAPACITY = 8;
+
     struct ArrayHeader
     {
         size_t m_size;
@@ -68,10 +68,46 @@ void PerfMap::Initialize()
         }
 
         PAL_PerfJitDump_Start(jitdumpPath);
+
+        // Lines are only written when the buffer fills up, so flush it periodically as well.
+        HANDLE flushThread = Thread::CreateUtilityThread(Thread::StackSize_Small, FlushThreadStart, NULL, W(".NET Perf Map Flush"));
+        if (flushThread != NULL)
+        {
+            CloseHandle(flushThread);
+        }
 #endif // CROSSGEN_COMPILE
     }
 }
 
+#ifndef CROSSGEN_COMPILE
+// Write out the buffered lines every c_FlushIntervalMs until the map is destroyed.
+DWORD WINAPI PerfMap::FlushThreadStart(LPVOID args)
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        GC_NOTRIGGER;
+        MODE_PREEMPTIVE;
+    }
+    CONTRACTL_END;
+
+    while (true)
+    {
+        ClrSleepEx(c_FlushIntervalMs, FALSE);
+
+        // The map is never deleted, so it's safe to flush after Destroy has run.
+        if (!s_enabled)
+        {
+            break;
+        }
+
+        s_Current->FlushWriteBuffer();
+    }
+
+    return 0;
+}
+#endif // CROSSGEN_COMPILE
+
 // Destroy the map for the process - called from EEShutdownHelper.
 void PerfMap::Destroy()
 {
@@ -80,6 +116,7 @@ void PerfMap::Destroy()
     if (s_enabled)
     {
         s_enabled = false;
+        s_Current->FlushWriteBuffer();
         // PAL_PerfJitDump_Finish is lock protected and can safely be called multiple times
         PAL_PerfJitDump_Finish();
     }
@@ -95,6 +132,9 @@ PerfMap::PerfMap(int pid)
 
     m_StubsMapped = 0;
 
+    m_WriteBufferUsed = 0;
+    m_WriteBufferLock.Init(CrstLeafLock, CrstFlags(CRST_REENTRANCY | CRST_UNSAFE_ANYMODE));
+
     // Build the path to the map file on disk.
     WCHAR tempPath[MAX_LONGPATH+1];
     if(!GetTempPathW(MAX_LONGPATH, tempPath))
@@ -123,6 +163,9 @@ PerfMap::PerfMap()
     m_ErrorEncountered = false;
 
     m_StubsMapped = 0;
+
+    m_WriteBufferUsed = 0;
+    m_WriteBufferLock.Init(CrstLeafLock, CrstFlags(CRST_REENTRANCY | CRST_UNSAFE_ANYMODE));
 }
 
 // Clean-up resources.
@@ -130,6 +173,9 @@ PerfMap::~PerfMap()
 {
     LIMITED_METHOD_CONTRACT;
 
+    FlushWriteBuffer();
+    m_WriteBufferLock.Destroy();
+
     delete m_FileStream;
     m_FileStream = nullptr;
 
@@ -162,25 +208,67 @@ void PerfMap::WriteLine(SString& line)
 
     EX_TRY
     {
-        // Write the line.
-        // The PAL already takes a lock when writing, so we don't need to do so here.
+        // Lines are small and there can be thousands of them during startup, so rather than
+        // issuing a write for each one, copy them into the buffer and write it out when full.
         StackScratchBuffer scratch;
         const char * strLine = line.GetANSI(scratch);
         ULONG inCount = line.GetCount();
-        ULONG outCount;
-        m_FileStream->Write(strLine, inCount, &outCount);
 
-        if (inCount != outCount)
+        CrstHolder ch(&m_WriteBufferLock);
+
+        if (m_WriteBufferUsed + inCount > c_WriteBufferSize)
         {
-            // This will cause us to stop writing to the file.
-            // The file will still remain open until shutdown so that we don't have to take a lock at this level when we touch the file stream.
-            m_ErrorEncountered = true;
+            FlushWriteBuffer();
         }
 
+        if (inCount > c_WriteBufferSize)
+        {
+            WriteToFile(strLine, inCount);
+        }
+        else
+        {
+            memcpy(m_WriteBuffer + m_WriteBufferUsed, strLine, inCount);
+            m_WriteBufferUsed += inCount;
+        }
     }
     EX_CATCH{} EX_END_CATCH(SwallowAllExceptions);
 }
 
+// Write out any buffered lines to the map file.
+void PerfMap::FlushWriteBuffer()
+{
+    LIMITED_METHOD_CONTRACT;
+
+    CrstHolder ch(&m_WriteBufferLock);
+
+    if (m_WriteBufferUsed != 0)
+    {
+        WriteToFile(m_WriteBuffer, m_WriteBufferUsed);
+        m_WriteBufferUsed = 0;
+    }
+}
+
+// Write data directly to the map file.
+void PerfMap::WriteToFile(const char * data, ULONG count)
+{
+    LIMITED_METHOD_CONTRACT;
+
+    if (m_FileStream == nullptr || m_ErrorEncountered)
+    {
+        return;
+    }
+
+    ULONG outCount;
+    m_FileStream->Write(data, count, &outCount);
+
+    if (count != outCount)
+    {
+        // This will cause us to stop writing to the file.
+        // The file will still remain open until shutdown so that we don't have to take a lock at this level when we touch the file stream.
+        m_ErrorEncountered = true;
+    }
+}
+
 // Log a method to the map.
 void PerfMap::LogMethod(MethodDesc * pMethod, PCODE pCode, size_t codeSize, const char *optimizationTier)
 {
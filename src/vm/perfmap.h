@@ -37,12 +37,33 @@ private:
     // Set to true if an error is encountered when writing to the file.
     unsigned m_StubsMapped;
 
+    // Lines are accumulated here and written to the file in large chunks.
+    static const ULONG c_WriteBufferSize = 64 * 1024;
+    char m_WriteBuffer[c_WriteBufferSize];
+    ULONG m_WriteBufferUsed;
+
+    // Protects the write buffer.
+    CrstExplicitInit m_WriteBufferLock;
+
     // Construct a new map for the specified pid.
     PerfMap(int pid);
 
     // Write a line to the map file.
     void WriteLine(SString & line);
 
+    // Write data directly to the map file.
+    void WriteToFile(const char * data, ULONG count);
+
+    // Write out any buffered lines.
+    void FlushWriteBuffer();
+
+    // How often the flush thread writes out buffered lines, so that tools reading the map
+    // while the process runs don't miss methods that were logged after the last full buffer.
+    static const DWORD c_FlushIntervalMs = 1000;
+
+    // Periodically writes out buffered lines until the map is destroyed.
+    static DWORD WINAPI FlushThreadStart(LPVOID args);
+
 protected:
     // Construct a new map without a specified file name.
     // Used for offline creation of NGEN map files.
@@ -0,0 +1,126 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+// See the LICENSE file in the project root for more information.
+// ===========================================================================
+// File: pgo.cpp
+//
+// ===========================================================================
+
+#include "common.h"
+#include "log.h"
+#include "pgo.h"
+
+#if defined(FEATURE_TIERED_COMPILATION) && !defined(DACCESS_COMPILE)
+
+PgoManager::Header* volatile PgoManager::s_buckets[PgoManager::s_bucketCount];
+
+UINT32 PgoManager::GetBucket(MethodDesc* pMD)
+{
+    LIMITED_METHOD_CONTRACT;
+
+    // MethodDescs are at least pointer aligned, drop the low bits before hashing
+    size_t key = (size_t)pMD / sizeof(void*);
+    return (UINT32)((key ^ (key >> 12)) % s_bucketCount);
+}
+
+bool PgoManager::IsEligibleForInstrumentation(MethodDesc* pMD)
+{
+    WRAPPER_NO_CONTRACT;
+
+    // Profile data is never freed, so don't collect any for methods that can be
+    // unloaded. Their MethodDescs could be reused by another method later on.
+    return g_pConfig->TieredPGO() &&
+        pMD->IsEligibleForTieredCompilation() &&
+        !pMD->IsDynamicMethod() &&
+        !pMD->GetLoaderAllocator()->IsCollectible();
+}
+
+HRESULT PgoManager::allocMethodBlockCounts(MethodDesc* pMD, UINT32 count,
+    ICorJitInfo::BlockCounts** pBlockCounts, unsigned ilSize)
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        GC_NOTRIGGER;
+        MODE_ANY;
+    }
+    CONTRACTL_END;
+
+    *pBlockCounts = NULL;
+
+    if (!IsEligibleForInstrumentation(pMD))
+    {
+        return E_NOTIMPL;
+    }
+
+    S_SIZE_T size = S_SIZE_T(sizeof(Header)) + S_SIZE_T(count) * S_SIZE_T(sizeof(ICorJitInfo::BlockCounts));
+    if (size.IsOverflow())
+    {
+        return E_OUTOFMEMORY;
+    }
+
+    BYTE* pMemory = new (nothrow) BYTE[size.Value()];
+    if (pMemory == NULL)
+    {
+        return E_OUTOFMEMORY;
+    }
+    memset(pMemory, 0, size.Value());
+
+    Header* pHeader = (Header*)pMemory;
+    pHeader->method = pMD;
+    pHeader->ilSize = ilSize;
+    pHeader->recordCount = count;
+
+    Header* volatile* pBucket = &s_buckets[GetBucket(pMD)];
+    Header* pHead;
+    do
+    {
+        pHead = *pBucket;
+        pHeader->next = pHead;
+    }
+    while (InterlockedCompareExchangeT((Header**)pBucket, pHeader, pHead) != pHead);
+
+    LOG((LF_JIT, LL_INFO10000, "PgoManager: allocated %u block counts for MethodDesc %p\n", count, pMD));
+
+    *pBlockCounts = pHeader->GetRecords();
+    return S_OK;
+}
+
+HRESULT PgoManager::getMethodBlockCounts(MethodDesc* pMD, unsigned ilSize, UINT32* pCount,
+    ICorJitInfo::BlockCounts** pBlockCounts, UINT32* pNumRuns)
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        GC_NOTRIGGER;
+        MODE_ANY;
+    }
+    CONTRACTL_END;
+
+    *pCount = 0;
+    *pBlockCounts = NULL;
+    *pNumRuns = 0;
+
+    // The newest header for a method is closest to the head of its bucket
+    for (Header* pHeader = s_buckets[GetBucket(pMD)]; pHeader != NULL; pHeader = pHeader->next)
+    {
+        if (pHeader->method != pMD)
+        {
+            continue;
+        }
+
+        *pBlockCounts = pHeader->GetRecords();
+        if (pHeader->ilSize != ilSize)
+        {
+            return E_FAIL;
+        }
+
+        *pCount = pHeader->recordCount;
+        *pNumRuns = 1;
+        return S_OK;
+    }
+
+    return E_NOTIMPL;
+}
+
+#endif // FEATURE_TIERED_COMPILATION && !DACCESS_COMPILE
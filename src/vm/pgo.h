@@ -0,0 +1,59 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+// See the LICENSE file in the project root for more information.
+// ===========================================================================
+// File: pgo.h
+//
+// In-process storage for the profile data that instrumented tier0 code
+// collects when TieredPGO is enabled, so tier1 can be jitted with it.
+// ===========================================================================
+
+#ifndef PGO_H
+#define PGO_H
+
+#if defined(FEATURE_TIERED_COMPILATION) && !defined(DACCESS_COMPILE)
+
+class PgoManager
+{
+public:
+    // Allocates a zero initialized buffer of count block count records for the
+    // method. The buffer lives as long as the process and the most recently
+    // allocated one is what getMethodBlockCounts hands out.
+    static HRESULT allocMethodBlockCounts(MethodDesc* pMD, UINT32 count,
+        ICorJitInfo::BlockCounts** pBlockCounts, unsigned ilSize);
+
+    // Returns the block counts collected for the method. Fails if there are
+    // none or if the IL size no longer matches, in which case pBlockCounts is
+    // still set so the JIT can tell the two apart.
+    static HRESULT getMethodBlockCounts(MethodDesc* pMD, unsigned ilSize, UINT32* pCount,
+        ICorJitInfo::BlockCounts** pBlockCounts, UINT32* pNumRuns);
+
+    // Whether jitting the method at tier0 should add instrumentation.
+    static bool IsEligibleForInstrumentation(MethodDesc* pMD);
+
+private:
+    struct Header
+    {
+        Header*     next;
+        MethodDesc* method;
+        unsigned    ilSize;
+        UINT32      recordCount;
+
+        ICorJitInfo::BlockCounts* GetRecords()
+        {
+            LIMITED_METHOD_CONTRACT;
+            return (ICorJitInfo::BlockCounts*)(this + 1);
+        }
+    };
+
+    // Headers are pushed onto lock free lists hashed by method, they are never
+    // removed.
+    static const UINT32 s_bucketCount = 4096;
+    static Header* volatile s_buckets[s_bucketCount];
+
+    static UINT32 GetBucket(MethodDesc* pMD);
+};
+
+#endif // FEATURE_TIERED_COMPILATION && !DACCESS_COMPILE
+
+#endif // PGO_H
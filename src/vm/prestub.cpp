@@ -1052,7 +1052,9 @@ PCODE MethodDesc::JitCompileCodeLocked(PrepareCodeConfig* pConfig, JitListLockEn
 #endif
 
 #ifdef FEATURE_TIERED_COMPILATION
-    if (pFlags->IsSet(CORJIT_FLAGS::CORJIT_FLAG_TIER0))
+    // Multicore JIT playback may skip tier 0 for methods that were promoted to tier 1 when the profile was recorded, in
+    // which case the tier 0 flag is not passed to the JIT but the config reports a switch to optimized code.
+    if (pFlags->IsSet(CORJIT_FLAGS::CORJIT_FLAG_TIER0) || pConfig->JitSwitchedToOptimized())
     {
         _ASSERTE(pConfig->GetCodeVersion().GetOptimizationTier() == NativeCodeVersion::OptimizationTier0);
         _ASSERTE(pConfig->GetMethodDesc()->IsEligibleForTieredCompilation());
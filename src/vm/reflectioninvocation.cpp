@@ -982,8 +982,6 @@ FCIMPL5(Object*, RuntimeMethodHandle::InvokeMethod,
    
     HELPER_METHOD_FRAME_BEGIN_RET_PROTECT(gc);
 
-    Assembly *pAssem = pMeth->GetAssembly();
-
     if (ownerType.IsSharedByGenericInstantiations())
         COMPlusThrow(kNotSupportedException, W("NotSupported_Type"));
  
@@ -1167,7 +1165,6 @@ FCIMPL5(Object*, RuntimeMethodHandle::InvokeMethod,
     {
         // We stack-allocate this ret buff, to preserve the invariant that ret-buffs are always in the
         // caller's stack frame.  We'll copy into gc.retVal later.
-        TypeHandle retTH = gc.pSig->GetReturnTypeHandle();
         MethodTable* pMT = retTH.GetMethodTable();
         if (pMT->IsStructRequiringStackAllocRetBuf())
         {
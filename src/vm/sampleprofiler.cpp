@@ -26,6 +26,7 @@ SampleProfiler::SampleProfilerPayload SampleProfiler::s_ExternalPayload = {Sampl
 SampleProfiler::SampleProfilerPayload SampleProfiler::s_ManagedPayload = {SampleProfilerSampleType::Managed};
 CLREventStatic SampleProfiler::s_threadShutdownEvent;
 unsigned long SampleProfiler::s_samplingRateInNs = NUM_NANOSECONDS_IN_1_MS; // 1ms
+bool SampleProfiler::s_managedThreadsOnly = false;
 bool SampleProfiler::s_timePeriodIsSet = FALSE;
 int32_t SampleProfiler::s_RefCount = 0;
 
@@ -91,6 +92,7 @@ void SampleProfiler::Enable(EventPipeProviderCallbackDataQueue *pEventPipeProvid
     if (!s_profilingEnabled)
     {
         s_profilingEnabled = true;
+        s_managedThreadsOnly = CLRConfig::GetConfigValue(CLRConfig::INTERNAL_EventPipeSampleManagedThreadsOnly) != 0;
         s_pSamplingThread = SetupUnstartedThread();
         if (s_pSamplingThread->CreateNewThread(0, ThreadProc, NULL))
         {
@@ -235,6 +237,12 @@ void SampleProfiler::WalkManagedThreads()
     // Assumes that the ThreadStoreLock is held because we've suspended all threads.
     while ((pTargetThread = ThreadStore::GetThreadList(pTargetThread)) != NULL)
     {
+        // Threads that were in preemptive mode are blocked or running native code. Walking their
+        // stacks is most of the time spent here with the runtime suspended, so skip them if only
+        // managed samples were asked for.
+        if (s_managedThreadsOnly && !pTargetThread->GetGCModeOnSuspension())
+            continue;
+
         StackContents stackContents;
 
         // Walk the stack and write it out as an event.
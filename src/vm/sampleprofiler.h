@@ -103,6 +103,9 @@ private:
     // The sampling rate.
     static unsigned long s_samplingRateInNs;
 
+    // Whether to skip threads that were not running managed code when the runtime was suspended.
+    static bool s_managedThreadsOnly;
+
     // Whether or not timeBeginPeriod has been used to set the scheduler period
     static bool s_timePeriodIsSet;
 
@@ -447,6 +447,15 @@ private:
 
     static const DWORD WaiterStarvationDurationMsBeforeStoppingPreemptingWaiters = 100;
 
+    // Number of spin iterations to perform before waiting on contention. Starts at g_SpinConstants.dwMonitorSpinCount and
+    // is adjusted based on whether recent spins managed to acquire the lock, see RecordSpinResult(). Updates are not
+    // synchronized, a lost update only delays the adjustment.
+    DWORD m_spinCount;
+
+    static const DWORD MinimumSpinCount = 2;
+    static const DWORD SpinCountSuccessIncrement = 4;
+    static const DWORD SpinCountFailureDecrement = 1;
+
     // Only SyncBlocks can create AwareLocks.  Hence this private constructor.
     AwareLock(DWORD indx)
         : m_Recursion(0),
@@ -456,7 +465,8 @@ private:
 #endif // DACCESS_COMPILE          
           m_TransientPrecious(0),
           m_dwSyncIndex(indx),
-          m_waiterStarvationStartTimeMs(0)
+          m_waiterStarvationStartTimeMs(0),
+          m_spinCount(g_SpinConstants.dwMonitorSpinCount)
     {
         LIMITED_METHOD_CONTRACT;
     }
@@ -521,6 +531,10 @@ private:
     void RecordWaiterStarvationStartTime();
     bool ShouldStopPreemptingWaiters() const;
 
+public:
+    DWORD GetSpinCount() const;
+    void RecordSpinResult(bool acquiredLock);
+
 private: // friend access is required for this unsafe function
     void InitializeToLockedWithNoWaiters(ULONG recursionLevel, PTR_Thread holdingThread)
     {
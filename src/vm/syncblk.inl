@@ -458,6 +458,41 @@ FORCEINLINE bool AwareLock::ShouldStopPreemptingWaiters() const
         GetTickCount() - waiterStarvationStartTimeMs >= WaiterStarvationDurationMsBeforeStoppingPreemptingWaiters;
 }
 
+FORCEINLINE DWORD AwareLock::GetSpinCount() const
+{
+    LIMITED_METHOD_CONTRACT;
+
+    _ASSERTE(m_spinCount <= g_SpinConstants.dwMonitorSpinCount);
+    return VolatileLoadWithoutBarrier(&m_spinCount);
+}
+
+// Spinning is only worthwhile if the lock tends to be released while the thread is spinning. Each successful spin raises the
+// spin count and each failed spin lowers it, so the spin count settles down when roughly one in five spins succeeds and goes
+// down to MinimumSpinCount for locks that are held for long periods. A small amount of spinning is always kept so that the
+// spin count may recover when the lock's usage pattern changes.
+FORCEINLINE void AwareLock::RecordSpinResult(bool acquiredLock)
+{
+    LIMITED_METHOD_CONTRACT;
+
+    DWORD spinCount = VolatileLoadWithoutBarrier(&m_spinCount);
+    DWORD newSpinCount;
+    if (acquiredLock)
+    {
+        newSpinCount = min(spinCount + SpinCountSuccessIncrement, g_SpinConstants.dwMonitorSpinCount);
+    }
+    else
+    {
+        newSpinCount = spinCount > MinimumSpinCount + SpinCountFailureDecrement
+            ? spinCount - SpinCountFailureDecrement
+            : min(MinimumSpinCount, g_SpinConstants.dwMonitorSpinCount);
+    }
+
+    if (newSpinCount != spinCount)
+    {
+        VolatileStoreWithoutBarrier(&m_spinCount, newSpinCount);
+    }
+}
+
 FORCEINLINE void AwareLock::SpinWait(const YieldProcessorNormalizationInfo &normalizationInfo, DWORD spinIteration)
 {
     WRAPPER_NO_CONTRACT;
@@ -100,4 +100,5 @@ void SyncClean::CleanUp ()
 
     // Give others we want to reclaim during the GC sync point a chance to do it
     VirtualCallStubManager::ReclaimAll();
+    ExecutionManager::ReclaimRangeSectionArrays();
 }
@@ -60,24 +60,6 @@ SPTR_IMPL(ThreadStore, ThreadStore, s_pThreadStore);
 CONTEXT *ThreadStore::s_pOSContext = NULL;
 CLREvent *ThreadStore::s_pWaitForStackCrawlEvent;
 
-PTR_ThreadLocalModule ThreadLocalBlock::GetTLMIfExists(ModuleIndex index)
-{
-    WRAPPER_NO_CONTRACT;
-    SUPPORTS_DAC;
-
-    if (index.m_dwIndex >= m_TLMTableSize)
-        return NULL;
-
-    return m_pTLMTable[index.m_dwIndex].pTLM;
-}
-
-PTR_ThreadLocalModule ThreadLocalBlock::GetTLMIfExists(MethodTable* pMT)
-{
-    WRAPPER_NO_CONTRACT;
-    ModuleIndex index = pMT->GetModuleForStatics()->GetModuleIndex();
-    return GetTLMIfExists(index);
-}
-
 #ifndef DACCESS_COMPILE
 
 BOOL Thread::s_fCleanFinalizedThread = FALSE;
@@ -1426,6 +1408,7 @@ Thread::Thread()
 #ifdef FEATURE_HIJACK
     m_ppvHJRetAddrPtr = (VOID**) 0xCCCCCCCCCCCCCCCC;
     m_pvHJRetAddr = (VOID*) 0xCCCCCCCCCCCCCCCC;
+    m_LastSuspensionIP = NULL;
 
 #ifndef PLATFORM_UNIX
     X86_ONLY(m_LastRedirectIP = 0);
@@ -3175,6 +3158,7 @@ DWORD Thread::DoAppropriateWait(int countHandles, HANDLE *handles, BOOL waitAll,
         DWORD millis;
         WaitMode mode;
         DWORD dwRet;
+        BOOL fBlockedWorker;
     } param;
     param.pThis = this;
     param.countHandles = countHandles;
@@ -3183,11 +3167,21 @@ DWORD Thread::DoAppropriateWait(int countHandles, HANDLE *handles, BOOL waitAll,
     param.millis = millis;
     param.mode = mode;
     param.dwRet = (DWORD) -1;
+    param.fBlockedWorker = FALSE;
 
     EE_TRY_FOR_FINALLY(Param *, pParam, &param) {
+        if ((pParam->pThis->m_State & TS_TPWorkerThread) && (pParam->millis != 0))
+        {
+            ThreadpoolMgr::WorkerThreadBlocked();
+            pParam->fBlockedWorker = TRUE;
+        }
+
         pParam->dwRet = pParam->pThis->DoAppropriateWaitWorker(pParam->countHandles, pParam->handles, pParam->waitAll, pParam->millis, pParam->mode);
     }
     EE_FINALLY {
+        if (param.fBlockedWorker)
+            ThreadpoolMgr::WorkerThreadUnblocked();
+
         if (syncState) {
             if (!GOT_EXCEPTION() &&
                 param.dwRet >= WAIT_OBJECT_0 && param.dwRet < (DWORD)(WAIT_OBJECT_0 + countHandles)) {
@@ -3223,6 +3217,7 @@ DWORD Thread::DoAppropriateWait(AppropriateWaitFunc func, void *args,
         DWORD millis;
         WaitMode mode;
         DWORD dwRet;
+        BOOL fBlockedWorker;
     } param;
     param.pThis = this;
     param.func = func;
@@ -3230,11 +3225,21 @@ DWORD Thread::DoAppropriateWait(AppropriateWaitFunc func, void *args,
     param.millis = millis;
     param.mode = mode;
     param.dwRet = (DWORD) -1;
+    param.fBlockedWorker = FALSE;
 
     EE_TRY_FOR_FINALLY(Param *, pParam, &param) {
+        if ((pParam->pThis->m_State & TS_TPWorkerThread) && (pParam->millis != 0))
+        {
+            ThreadpoolMgr::WorkerThreadBlocked();
+            pParam->fBlockedWorker = TRUE;
+        }
+
         pParam->dwRet = pParam->pThis->DoAppropriateWaitWorker(pParam->func, pParam->args, pParam->millis, pParam->mode);
     }
     EE_FINALLY {
+        if (param.fBlockedWorker)
+            ThreadpoolMgr::WorkerThreadUnblocked();
+
         if (syncState) {
             if (!GOT_EXCEPTION() && WAIT_OBJECT_0 == param.dwRet) {
                 // This thread has been removed from syncblk waiting list by the signalling thread
@@ -232,8 +232,9 @@ public:
 
     void SetModuleSlot(ModuleIndex index, PTR_ThreadLocalModule pLocalModule);
 
-    PTR_ThreadLocalModule GetTLMIfExists(ModuleIndex index);
-    PTR_ThreadLocalModule GetTLMIfExists(MethodTable* pMT);
+    // Defined in threadstatics.h so that the thread static base helpers can inline them
+    inline PTR_ThreadLocalModule GetTLMIfExists(ModuleIndex index);
+    inline PTR_ThreadLocalModule GetTLMIfExists(MethodTable* pMT);
 
 #ifdef DACCESS_COMPILE
     void EnumMemoryRegions(CLRDataEnumMemoryFlags flags);
@@ -3568,6 +3569,14 @@ public:
     // register context.
     BOOL GetSafelyRedirectableThreadContext(DWORD dwOptions, T_CONTEXT * pCtx, REGDISPLAY * pRD);
 
+#ifdef FEATURE_HIJACK
+    PCODE GetLastSuspensionIP()
+    {
+        LIMITED_METHOD_CONTRACT;
+        return m_LastSuspensionIP;
+    }
+#endif // FEATURE_HIJACK
+
 private:
 #ifdef FEATURE_HIJACK
     void    HijackThread(VOID *pvHijackAddr, ExecutionState *esb);
@@ -3575,6 +3584,7 @@ private:
     VOID        *m_pvHJRetAddr;           // original return address (before hijack)
     VOID       **m_ppvHJRetAddrPtr;       // place we bashed a new return address
     MethodDesc  *m_HijackedFunction;      // remember what we hijacked
+    PCODE        m_LastSuspensionIP;      // managed code the thread was last interrupted in while suspending for GC
 
 #ifndef PLATFORM_UNIX
     BOOL    HandledJITCase(BOOL ForTaskSwitchIn = FALSE);
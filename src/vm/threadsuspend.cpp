@@ -59,6 +59,15 @@ extern "C" void             RedirectedHandledJITCaseForGCStress_Stub(void);
 // our chances of snagging it at a safe spot).
 #define PING_JIT_TIMEOUT        10
 
+#if defined(FEATURE_HIJACK) && defined(PLATFORM_UNIX)
+// Retrying an injected activation only costs a signal per thread that is still in
+// cooperative mode, so the first few retries use a much shorter timeout. This bounds
+// the time to suspend threads that were interrupted at a spot where they could be
+// neither redirected nor hijacked (e.g. in a prolog or epilog of a tight loop callee).
+#define ACTIVATION_RETRY_TIMEOUT    1
+#define ACTIVATION_FAST_RETRIES     10
+#endif // FEATURE_HIJACK && PLATFORM_UNIX
+
 // When we find a thread in a spot that's not safe to abort -- how long to wait before
 // we try again.
 #define ABORT_POLL_TIMEOUT      10
@@ -3770,6 +3779,28 @@ COR_PRF_SUSPEND_REASON GCSuspendReasonToProfSuspendReason(ThreadSuspend::SUSPEND
 }
 #endif // PROFILING_SUPPORTED
 
+// Logs a thread that took longer than the SuspendStragglerThreshold to reach a safe point,
+// along with the managed method it was last interrupted in, if any.
+static void LogSuspendStraggler(Thread *pThread, DWORD elapsedMs)
+{
+    CONTRACTL {
+        NOTHROW;
+        GC_NOTRIGGER;
+    }
+    CONTRACTL_END;
+
+    PCODE ip = NULL;
+    MethodDesc *pMD = NULL;
+#ifdef FEATURE_HIJACK
+    ip = pThread->GetLastSuspensionIP();
+    if (ip != NULL)
+        pMD = ExecutionManager::GetCodeMethodDesc(ip);
+#endif // FEATURE_HIJACK
+
+    STRESS_LOG4(LF_SYNC, LL_ALWAYS, "Thread::SuspendRuntime() - Thread %p took %d ms to reach a safe point, last interrupted at %p in %pM\n",
+        pThread, elapsedMs, ip, pMD);
+}
+
 //************************************************************************************
 //
 // SuspendRuntime is responsible for ensuring that all managed threads reach a
@@ -3841,6 +3872,10 @@ HRESULT ThreadSuspend::SuspendRuntime(ThreadSuspend::SUSPEND_REASON reason)
 
     STRESS_LOG1(LF_SYNC, LL_INFO1000, "Thread::SuspendRuntime(reason=0x%x)\n", reason);
 
+    static ConfigDWORD stragglerThreshold;
+    DWORD dwStragglerThreshold = stragglerThreshold.val(CLRConfig::UNSUPPORTED_SuspendStragglerThreshold);
+    ULONGLONG suspendStartTime = (dwStragglerThreshold != 0) ? CLRGetTickCount64() : 0;
+
 
 #ifdef PROFILING_SUPPORTED
     // If the profiler desires information about GCs, then let it know that one
@@ -3910,6 +3945,10 @@ HRESULT ThreadSuspend::SuspendRuntime(ThreadSuspend::SUSPEND_REASON reason)
             thread->ResetThreadState(Thread::TS_GCSuspendPending);
         }
 
+#ifdef FEATURE_HIJACK
+        thread->m_LastSuspensionIP = NULL;
+#endif // FEATURE_HIJACK
+
         if (thread == pCurThread)
             continue;
 
@@ -4091,6 +4130,10 @@ HRESULT ThreadSuspend::SuspendRuntime(ThreadSuspend::SUSPEND_REASON reason)
 
 #endif
 
+#if defined(FEATURE_HIJACK) && defined(PLATFORM_UNIX)
+    DWORD activationRetries = 0;
+#endif
+
     //
     // Now we keep retrying until we find that no threads are in cooperative mode.  This should be merged into 
     // the first loop.
@@ -4131,6 +4174,13 @@ HRESULT ThreadSuspend::SuspendRuntime(ThreadSuspend::SUSPEND_REASON reason)
                 STRESS_LOG1(LF_SYNC, LL_INFO1000, "    Thread %x went preemptive it is at a GC safe point\n", thread);
                 countThreads--;
                 thread->ResetThreadState(Thread::TS_GCSuspendPending);
+
+                if (dwStragglerThreshold != 0)
+                {
+                    DWORD elapsedMs = (DWORD)(CLRGetTickCount64() - suspendStartTime);
+                    if (elapsedMs >= dwStragglerThreshold)
+                        LogSuspendStraggler(thread, elapsedMs);
+                }
             }
         }
 
@@ -4188,7 +4238,16 @@ HRESULT ThreadSuspend::SuspendRuntime(ThreadSuspend::SUSPEND_REASON reason)
         // For now, we simply wait.
         //
 
-        res = g_pGCSuspendEvent->Wait(PING_JIT_TIMEOUT, FALSE);
+        DWORD waitTimeout = PING_JIT_TIMEOUT;
+#if defined(FEATURE_HIJACK) && defined(PLATFORM_UNIX)
+        if (activationRetries < ACTIVATION_FAST_RETRIES)
+        {
+            activationRetries++;
+            waitTimeout = ACTIVATION_RETRY_TIMEOUT;
+        }
+#endif
+
+        res = g_pGCSuspendEvent->Wait(waitTimeout, FALSE);
 
 
 #ifdef TIME_SUSPEND
@@ -6144,6 +6203,8 @@ BOOL Thread::HandledJITCase(BOOL ForTaskSwitchIn)
         return FALSE;
     }
 
+    m_LastSuspensionIP = ip;
+
 #ifdef WORKAROUND_RACES_WITH_KERNEL_MODE_EXCEPTION_HANDLING
     if (ThreadCaughtInKernelModeExceptionHandling(this, &ctx))
     {
@@ -6696,6 +6757,8 @@ void HandleGCSuspensionForInterruptedThread(CONTEXT *interruptedContext)
     // an activation safe point.
     _ASSERTE(CheckActivationSafePoint(ip, /* checkingCurrentThread */ TRUE));
 
+    pThread->m_LastSuspensionIP = ip;
+
     Thread::WorkingOnThreadContextHolder workingOnThreadContext(pThread);
     if (!workingOnThreadContext.Acquired())
         return;
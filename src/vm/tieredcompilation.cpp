@@ -14,6 +14,7 @@
 #include "win32threadpool.h"
 #include "threadsuspend.h"
 #include "tieredcompilation.h"
+#include "pgo.h"
 
 // TieredCompilationManager determines which methods should be recompiled and
 // how they should be recompiled to best optimize the running code. It then
@@ -38,11 +39,13 @@
 //
 // Methods initially call into OnMethodCalled() and once the call count exceeds
 // a fixed limit we queue work on to our internal list of methods needing to
-// be recompiled (m_methodsToOptimize). If there is currently no thread
-// servicing our queue asynchronously then we use the runtime threadpool
-// QueueUserWorkItem to recruit one. During the callback for each threadpool work
-// item we handle as many methods as possible in a fixed period of time, then
-// queue another threadpool work item if m_methodsToOptimize hasn't been drained.
+// be recompiled (m_methodsToOptimize). Methods that reached the limit quickly
+// are queued on a separate list (m_hotMethodsToOptimize) that is serviced first.
+// If there are fewer threads servicing our queue asynchronously than queued
+// methods, and fewer than TieredCompilation_BackgroundWorkerMaxCount, then we use
+// the runtime threadpool QueueUserWorkItem to recruit one. During the callback for
+// each threadpool work item we handle as many methods as possible in a fixed period
+// of time, then queue another threadpool work item if the queue hasn't been drained.
 //
 // The background thread enters at StaticOptimizeMethodsCallback(), enters the
 // appdomain, and then begins calling OptimizeMethod on each method in the
@@ -225,7 +228,7 @@ bool TieredCompilationManager::OnMethodCodeVersionCalledSubsequently(MethodDesc*
     return success;
 }
 
-void TieredCompilationManager::AsyncPromoteMethodToTier1(MethodDesc* pMethodDesc)
+void TieredCompilationManager::AsyncPromoteMethodToTier1(MethodDesc* pMethodDesc, bool isHot)
 {
     STANDARD_VM_CONTRACT;
 
@@ -279,13 +282,20 @@ void TieredCompilationManager::AsyncPromoteMethodToTier1(MethodDesc* pMethodDesc
         CrstHolder holder(&m_lock);
         if (pMethodListItem != NULL)
         {
-            m_methodsToOptimize.InsertTail(pMethodListItem);
+            if (isHot)
+            {
+                m_hotMethodsToOptimize.InsertTail(pMethodListItem);
+            }
+            else
+            {
+                m_methodsToOptimize.InsertTail(pMethodListItem);
+            }
             ++m_countOfMethodsToOptimize;
         }
 
-        LOG((LF_TIEREDCOMPILATION, LL_INFO10000, "TieredCompilationManager::AsyncPromoteMethodToTier1 Method=0x%pM (%s::%s), code version id=0x%x queued\n",
+        LOG((LF_TIEREDCOMPILATION, LL_INFO10000, "TieredCompilationManager::AsyncPromoteMethodToTier1 Method=0x%pM (%s::%s), code version id=0x%x queued%s\n",
             pMethodDesc, pMethodDesc->m_pszDebugClassName, pMethodDesc->m_pszDebugMethodName,
-            t1NativeCodeVersion.GetVersionId()));
+            t1NativeCodeVersion.GetVersionId(), isHot ? " as hot" : ""));
 
         if (!IncrementWorkerThreadCountIfNeeded())
         {
@@ -633,6 +643,7 @@ void TieredCompilationManager::OptimizeMethods()
         GCX_PREEMP();
         while (true)
         {
+            bool startAnotherWorker;
             {
                 CrstHolder holder(&m_lock);
 
@@ -648,6 +659,15 @@ void TieredCompilationManager::OptimizeMethods()
                     DecrementWorkerThreadCount();
                     break;
                 }
+
+                // Methods may have been queued faster than this thread can jit them, recruit another thread to help
+                startAnotherWorker = IncrementWorkerThreadCountIfNeeded();
+            }
+
+            if (startAnotherWorker && !TryAsyncOptimizeMethods())
+            {
+                CrstHolder holder(&m_lock);
+                DecrementWorkerThreadCount();
             }
 
             OptimizeMethod(nativeCodeVersion);
@@ -696,6 +716,19 @@ void TieredCompilationManager::OptimizeMethod(NativeCodeVersion nativeCodeVersio
     if (CompileCodeVersion(nativeCodeVersion))
     {
         ActivateCodeVersion(nativeCodeVersion);
+
+#ifdef FEATURE_MULTICOREJIT
+        // Let the multicore JIT profile know that the method reached tier 1 so that playback on the next launch can
+        // skip tier 0 for it
+        MethodDesc* pMethod = nativeCodeVersion.GetMethodDesc();
+        MulticoreJitManager & mcJitManager = GetAppDomain()->GetMulticoreJitManager();
+        if (mcJitManager.IsRecorderActive() &&
+            nativeCodeVersion.GetILCodeVersion().IsDefaultVersion() &&
+            MulticoreJitManager::IsMethodSupported(pMethod))
+        {
+            mcJitManager.RecordMethodTier1(pMethod);
+        }
+#endif
     }
 }
 
@@ -805,14 +838,18 @@ void TieredCompilationManager::ActivateCodeVersion(NativeCodeVersion nativeCodeV
     }
 }
 
-// Dequeues the next method in the optmization queue.
+// Dequeues the next method in the optmization queue, hot methods first.
 // This should be called with m_lock already held and runs
 // on the background thread.
 NativeCodeVersion TieredCompilationManager::GetNextMethodToOptimize()
 {
     STANDARD_VM_CONTRACT;
 
-    SListElem<NativeCodeVersion>* pElem = m_methodsToOptimize.RemoveHead();
+    SListElem<NativeCodeVersion>* pElem = m_hotMethodsToOptimize.RemoveHead();
+    if (pElem == NULL)
+    {
+        pElem = m_methodsToOptimize.RemoveHead();
+    }
     if (pElem != NULL)
     {
         NativeCodeVersion nativeCodeVersion = pElem->GetValue();
@@ -828,13 +865,13 @@ bool TieredCompilationManager::IncrementWorkerThreadCountIfNeeded()
     WRAPPER_NO_CONTRACT;
     // m_lock should be held
 
-    if (0 == m_countOptimizationThreadsRunning &&
+    if (m_countOptimizationThreadsRunning < g_pConfig->TieredCompilation_BackgroundWorkerMaxCount() &&
+        m_countOptimizationThreadsRunning < m_countOfMethodsToOptimize &&
         !m_isAppDomainShuttingDown &&
-        !m_methodsToOptimize.IsEmpty() &&
         !IsTieringDelayActive())
     {
-        // Our current policy throttles at 1 thread, but in the future we
-        // could experiment with more parallelism.
+        // Each running thread will take a queued method, only add a thread
+        // when there are more queued methods than running threads.
         m_countOptimizationThreadsRunning++;
         return true;
     }
@@ -863,7 +900,7 @@ DWORD TieredCompilationManager::DebugGetWorkerThreadCount()
 //static
 CORJIT_FLAGS TieredCompilationManager::GetJitFlags(NativeCodeVersion nativeCodeVersion)
 {
-    LIMITED_METHOD_CONTRACT;
+    WRAPPER_NO_CONTRACT;
 
     CORJIT_FLAGS flags;
     MethodDesc *methodDesc = nativeCodeVersion.GetMethodDesc();
@@ -882,6 +919,10 @@ CORJIT_FLAGS TieredCompilationManager::GetJitFlags(NativeCodeVersion nativeCodeV
             if (g_pConfig->TieredCompilation_QuickJit())
             {
                 flags.Set(CORJIT_FLAGS::CORJIT_FLAG_TIER0);
+                if (PgoManager::IsEligibleForInstrumentation(methodDesc))
+                {
+                    flags.Set(CORJIT_FLAGS::CORJIT_FLAG_BBINSTR);
+                }
                 return flags;
             }
         }
@@ -904,10 +945,19 @@ CORJIT_FLAGS TieredCompilationManager::GetJitFlags(NativeCodeVersion nativeCodeV
                 goto OptTierOptimized;
             }
             flags.Set(CORJIT_FLAGS::CORJIT_FLAG_TIER0);
+            if (PgoManager::IsEligibleForInstrumentation(methodDesc))
+            {
+                flags.Set(CORJIT_FLAGS::CORJIT_FLAG_BBINSTR);
+            }
             break;
 
         case NativeCodeVersion::OptimizationTier1:
             flags.Set(CORJIT_FLAGS::CORJIT_FLAG_TIER1);
+            if (PgoManager::IsEligibleForInstrumentation(methodDesc))
+            {
+                // Pick up the block counts recorded by the instrumented tier0 code
+                flags.Set(CORJIT_FLAGS::CORJIT_FLAG_BBOPT);
+            }
             // fall through
 
         case NativeCodeVersion::OptimizationTierOptimized:
@@ -36,7 +36,7 @@ public:
 public:
     bool OnMethodCodeVersionCalledFirstTime(MethodDesc* pMethodDesc);
     bool OnMethodCodeVersionCalledSubsequently(MethodDesc* pMethodDesc);
-    void AsyncPromoteMethodToTier1(MethodDesc* pMethodDesc);
+    void AsyncPromoteMethodToTier1(MethodDesc* pMethodDesc, bool isHot = false);
     void Shutdown();
     static CORJIT_FLAGS GetJitFlags(NativeCodeVersion nativeCodeVersion);
 
@@ -63,6 +63,7 @@ private:
 #endif
 
     Crst m_lock;
+    SList<SListElem<NativeCodeVersion>> m_hotMethodsToOptimize;
     SList<SListElem<NativeCodeVersion>> m_methodsToOptimize;
     UINT32 m_countOfMethodsToOptimize;
     BOOL m_isAppDomainShuttingDown;
@@ -3615,9 +3615,6 @@ void BucketTable::LogStats()
 }
 
 DispatchCache::DispatchCache()
-#ifdef CHAIN_LOOKUP 
-    : m_writeLock(CrstStubDispatchCache, CRST_UNSAFE_ANYMODE)
-#endif
 {
     CONTRACTL
     {
@@ -3627,6 +3624,11 @@ DispatchCache::DispatchCache()
     }
     CONTRACTL_END
 
+#ifdef CHAIN_LOOKUP 
+    for (int i = 0; i < CALL_STUB_CACHE_WRITE_LOCKS; i++)
+        m_writeLocks[i].Init(CrstStubDispatchCache, CRST_UNSAFE_ANYMODE);
+#endif
+
     //initialize the cache to be empty, i.e. all slots point to the empty entry
     ResolveCacheElem* e = new ResolveCacheElem();
     e->pMT = (void *) (-1); //force all method tables to be misses
@@ -3689,10 +3691,6 @@ BOOL DispatchCache::Insert(ResolveCacheElem* elem, InsertKind insertKind)
         PRECONDITION(insertKind != IK_NONE);
     } CONTRACTL_END;
 
-#ifdef CHAIN_LOOKUP 
-    CrstHolder lh(&m_writeLock);
-#endif
-
     // Figure out what bucket this element belongs in
     UINT16 tokHash = HashToken(elem->token);
     UINT16 hash    = HashMT(tokHash, elem->pMT);
@@ -3702,6 +3700,10 @@ BOOL DispatchCache::Insert(ResolveCacheElem* elem, InsertKind insertKind)
     BOOL   hit     = FALSE;
     BOOL   collide = FALSE;
 
+#ifdef CHAIN_LOOKUP 
+    CrstHolder lh(GetWriteLock(idx));
+#endif
+
 #ifdef _DEBUG 
     elem->debug_hash = tokHash;
     elem->debug_index = idx;
@@ -3805,14 +3807,21 @@ void DispatchCache::PromoteChainEntry(ResolveCacheElem* elem)
         FORBID_FAULT;
     } CONTRACTL_END;
 
-    CrstHolder lh(&m_writeLock);
-    g_chained_entry_promoted++;
-
     // Figure out what bucket this element belongs in
     UINT16 tokHash = HashToken(elem->token);
     UINT16 hash    = HashMT(tokHash, elem->pMT);
     UINT16 idx     = hash;
 
+    // Many threads may hit the chain success counter limit for the same element at
+    // about the same time, don't bother taking the lock if it has already been promoted.
+    if (GetCacheEntry(idx) == elem)
+    {
+        return;
+    }
+
+    CrstHolder lh(GetWriteLock(idx));
+    g_chained_entry_promoted++;
+
     ResolveCacheElem *curElem = GetCacheEntry(idx);
 
     // If someone raced in and promoted this element before us,
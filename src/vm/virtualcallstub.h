@@ -1032,6 +1032,8 @@ extern UINT32 STUB_COLLIDE_MONO_PCT;
 #define CALL_STUB_EMPTY_ENTRY   0
 // number of successes for a chained element before it gets moved to the front
 #define CALL_STUB_CACHE_INITIAL_SUCCESS_COUNT (0x100)
+// number of locks guarding writes to the resolve cache chains, must be a power of two
+#define CALL_STUB_CACHE_WRITE_LOCKS 16
 
 /*******************************************************************************************************
 Entry is an abstract class.  We will make specific subclasses for each kind of
@@ -1344,7 +1346,7 @@ public:
           cacheData[idx].numWrites++;
 #endif
 #ifdef CHAIN_LOOKUP 
-        CONSISTENCY_CHECK(m_writeLock.OwnedByCurrentThread());
+        CONSISTENCY_CHECK(GetWriteLock(idx)->OwnedByCurrentThread());
 #endif
           cache[idx] = elem;
         }
@@ -1402,7 +1404,16 @@ public:
 
 private:
 #ifdef CHAIN_LOOKUP 
-    Crst m_writeLock;
+    // Each chain is only modified by Insert and PromoteChainEntry, both need to hold the lock
+    // of the chain's cache entry. Lookups do not lock. The locks are striped so that threads
+    // resolving unrelated megamorphic call sites do not contend.
+    CrstStatic m_writeLocks[CALL_STUB_CACHE_WRITE_LOCKS];
+
+    inline CrstStatic *GetWriteLock(size_t idx)
+    {
+        LIMITED_METHOD_CONTRACT;
+        return &m_writeLocks[idx & (CALL_STUB_CACHE_WRITE_LOCKS - 1)];
+    }
 #endif
 
     //the following hash computation is also inlined in the resolve stub in asm (SO NO TOUCHIE)
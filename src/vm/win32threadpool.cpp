@@ -119,6 +119,7 @@ LONG ThreadpoolMgr::Initialization=0;           // indicator of whether the thre
 
 // Cacheline aligned, hot variable
 DECLSPEC_ALIGN(MAX_CACHE_LINE_SIZE) unsigned int ThreadpoolMgr::LastDequeueTime; // used to determine if work items are getting thread starved
+DECLSPEC_ALIGN(MAX_CACHE_LINE_SIZE) LONG ThreadpoolMgr::NumBlockedWorkers; // number of worker threads currently blocked in a wait
 
 // Move out of from preceeding variables' cache line
 DECLSPEC_ALIGN(MAX_CACHE_LINE_SIZE) int ThreadpoolMgr::offset_counter = 0;
@@ -4316,6 +4317,11 @@ DWORD WINAPI ThreadpoolMgr::GateThreadStart(LPVOID lpArgs)
             {
                 DangerousNonHostedSpinLockHolder tal(&ThreadAdjustmentLock);
 
+                // Workers blocked in waits are not going to pick up the pending work. Compensate for
+                // them all at once (up to one thread per processor per gate thread tick) rather than
+                // adding a single thread every tick.
+                LONG numToAdd = max(1, min(VolatileLoad(&NumBlockedWorkers), (LONG)NumberOfProcessors));
+
                 ThreadCounter::Counts counts = WorkerCounter.GetCleanCounts();
                 while (counts.NumActive < MaxLimitTotalWorkerThreads && //don't add a thread if we're at the max
                        counts.NumActive >= counts.MaxWorking)            //don't add a thread if we're already in the process of adding threads
@@ -4328,13 +4334,16 @@ DWORD WINAPI ThreadpoolMgr::GateThreadStart(LPVOID lpArgs)
                     }
 
                     ThreadCounter::Counts newCounts = counts;
-                    newCounts.MaxWorking = newCounts.NumActive + 1;
+                    newCounts.MaxWorking = (int)min((LONG)newCounts.NumActive + numToAdd, MaxLimitTotalWorkerThreads);
 
                     ThreadCounter::Counts oldCounts = WorkerCounter.CompareExchangeCounts(newCounts, counts);
                     if (oldCounts == counts)
                     {
                         HillClimbingInstance.ForceChange(newCounts.MaxWorking, Starvation);
-                        MaybeAddWorkingWorker();
+                        for (int i = counts.NumActive; i < newCounts.MaxWorking; i++)
+                        {
+                            MaybeAddWorkingWorker();
+                        }
                         break;
                     }
                     else
@@ -4393,7 +4402,8 @@ BOOL ThreadpoolMgr::SufficientDelaySinceLastDequeue()
     unsigned delay = GetTickCount() - VolatileLoad(&LastDequeueTime);
     unsigned tooLong;
 
-    if(cpuUtilization < CpuUtilizationLow)
+    // Blocked workers don't use CPU, so the utilization based threshold would only delay compensating for them
+    if(cpuUtilization < CpuUtilizationLow || VolatileLoad(&NumBlockedWorkers) > 0)
     {
         tooLong = GATE_THREAD_DELAY;
     }
@@ -302,6 +302,21 @@ public:
         VolatileStore(&LastDequeueTime, (unsigned int)GetTickCount());
     }
 
+    // Called by worker threads around blocking waits (see Thread::DoAppropriateWait) so that the
+    // gate thread can compensate for blocked workers without waiting for the CPU based starvation
+    // heuristics to kick in.
+    static inline void WorkerThreadBlocked()
+    {
+        LIMITED_METHOD_CONTRACT;
+        FastInterlockIncrement(&NumBlockedWorkers);
+    }
+
+    static inline void WorkerThreadUnblocked()
+    {
+        LIMITED_METHOD_CONTRACT;
+        FastInterlockDecrement(&NumBlockedWorkers);
+    }
+
     static BOOL CreateTimerQueueTimer(PHANDLE phNewTimer,
                                         WAITORTIMERCALLBACK Callback,
                                         PVOID Parameter,
@@ -1013,6 +1028,7 @@ private:
     SVAL_DECL(LONG,MaxLimitTotalWorkerThreads);         // same as MaxLimitTotalCPThreads
         
     DECLSPEC_ALIGN(MAX_CACHE_LINE_SIZE) static unsigned int LastDequeueTime;      // used to determine if work items are getting thread starved
+    DECLSPEC_ALIGN(MAX_CACHE_LINE_SIZE) static LONG NumBlockedWorkers;            // number of worker threads currently blocked in a wait
     
     static HillClimbing HillClimbingInstance;
 
@@ -1622,6 +1622,83 @@ void ZapImage::ProfileDisableInlining()
     }
 }
 
+//  CompileMethodOrderFile
+//     Compiles the methods listed in the file specified by ZapMethodOrderFile, in file order,
+//     so that they are placed contiguously in the "Hot" code region. This allows a startup
+//     method order (e.g. collected from a trace) to be used when no IBC data is available.
+//     The file contains one hexadecimal MethodDef token per line; empty lines and lines
+//     starting with '#' are ignored.
+//
+void ZapImage::CompileMethodOrderFile()
+{
+    NewArrayHolder<WCHAR> pszMethodOrderFile(CLRConfig::GetConfigValue(CLRConfig::INTERNAL_ZapMethodOrderFile));
+    if (pszMethodOrderFile == NULL || *pszMethodOrderFile == W('\0'))
+        return;
+
+    HandleHolder hFile = WszCreateFile(pszMethodOrderFile,
+                                       GENERIC_READ,
+                                       FILE_SHARE_READ,
+                                       NULL,
+                                       OPEN_EXISTING,
+                                       FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN,
+                                       NULL);
+    if (hFile == INVALID_HANDLE_VALUE)
+    {
+        m_zapper->Warning(W("Warning: Could not open method order file %s\n"), (LPCWSTR)pszMethodOrderFile);
+        return;
+    }
+
+    DWORD dwFileLen = SafeGetFileSize(hFile, 0);
+    if (dwFileLen == INVALID_FILE_SIZE)
+        return;
+
+    NewArrayHolder<char> pBuffer = new char[dwFileLen + 1];
+    DWORD cbRead = 0;
+    if (!ReadFile(hFile, pBuffer, dwFileLen, &cbRead, NULL))
+    {
+        m_zapper->Warning(W("Warning: Could not read method order file %s\n"), (LPCWSTR)pszMethodOrderFile);
+        return;
+    }
+    pBuffer[cbRead] = '\0';
+
+    m_zapper->Info(W("Using method order file %s.\n"), (LPCWSTR)pszMethodOrderFile);
+
+    // record the start of the ordered methods, they are laid out like hot IBC methods.
+    m_iIBCMethod = m_MethodCompilationOrder.GetCount();
+
+    char * pLine = pBuffer;
+    while (*pLine != '\0')
+    {
+        char * pNext = strchr(pLine, '\n');
+        if (pNext != NULL)
+            *pNext++ = '\0';
+        else
+            pNext = pLine + strlen(pLine);
+
+        while (*pLine == ' ' || *pLine == '\t')
+            pLine++;
+
+        if (*pLine != '\0' && *pLine != '\r' && *pLine != '#')
+        {
+            char * pEnd;
+            mdToken token = (mdToken)strtoul(pLine, &pEnd, 16);
+
+            if (pEnd == pLine)
+            {
+                m_zapper->Info(W("Warning: Invalid line in method order file.\n"));
+            }
+            else
+            {
+                CompileProfileDataWorker(token, 1 << ReadMethodCode);
+            }
+        }
+
+        pLine = pNext;
+    }
+
+    m_iGenericsMethod = m_MethodCompilationOrder.GetCount();
+}
+
 //  CompileHotRegion
 //     Performs the compilation and placement for all methods in the the "Hot" code region
 //     Methods placed in this region typically correspond to all of the methods that were
@@ -1703,6 +1780,11 @@ void ZapImage::CompileHotRegion()
         // record the start of hot Generics methods.
         m_iGenericsMethod = m_MethodCompilationOrder.GetCount();
     }
+    else
+    {
+        // Without IBC data fall back to the method order file, if any.
+        CompileMethodOrderFile();
+    }
 
     // record the start of untrained code
     m_iUntrainedMethod = m_MethodCompilationOrder.GetCount();
@@ -861,6 +861,7 @@ public:
     CompileStatus     CompileProfileDataWorker(mdToken token, unsigned methodProfilingDataFlags);
 
     void              ProfileDisableInlining();
+    void              CompileMethodOrderFile();
     void              CompileHotRegion();
     void              CompileColdRegion();
     void              PlaceMethodIL();
@@ -132,6 +132,79 @@ unsafe class SuppressGCTransitionTest
         return n + 1;
     }
     [MethodImpl(MethodImplOptions.NoInlining)]
+    private static int Inline_NoGCTransition_InTry(int expected)
+    {
+        Console.WriteLine($"{nameof(Inline_NoGCTransition_InTry)} ({expected}) ...");
+        int n = 0;
+        bool caught = false;
+        try
+        {
+            // On 64-bit targets this call is inlined even though it is in a try region
+            SuppressGCTransitionNative.NextUInt_Inline_NoGCTransition(&n);
+            if (n == expected)
+            {
+                throw new InvalidOperationException();
+            }
+        }
+        catch (InvalidOperationException)
+        {
+            caught = true;
+            GC.Collect();
+        }
+
+        Assert.IsTrue(caught);
+        Assert.AreEqual(expected, n);
+
+        // Make the call again after the handler, in the same frame
+        SuppressGCTransitionNative.NextUInt_Inline_NoGCTransition(&n);
+        Assert.AreEqual(expected + 1, n);
+        return n + 1;
+    }
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    private static int Mixed_InTry(int expected)
+    {
+        Console.WriteLine($"{nameof(Mixed_InTry)} ({expected}) ...");
+        int n = 0;
+        try
+        {
+            SuppressGCTransitionNative.NextUInt_Inline_GCTransition(&n);
+            Assert.AreEqual(expected++, n);
+            SuppressGCTransitionNative.NextUInt_Inline_NoGCTransition(&n);
+            Assert.AreEqual(expected++, n);
+            throw new InvalidOperationException();
+        }
+        catch (InvalidOperationException)
+        {
+            SuppressGCTransitionNative.NextUInt_Inline_GCTransition(&n);
+            Assert.AreEqual(expected++, n);
+        }
+
+        SuppressGCTransitionNative.NextUInt_Inline_NoGCTransition(&n);
+        Assert.AreEqual(expected, n);
+        return n + 1;
+    }
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    private static int Inline_NoGCTransition_InRareBlock(int expected)
+    {
+        Console.WriteLine($"{nameof(Inline_NoGCTransition_InRareBlock)} ({expected}) ...");
+        int n = 0;
+        try
+        {
+            if (expected > 0)
+            {
+                // This block ends in a throw, so it is rarely run
+                SuppressGCTransitionNative.NextUInt_Inline_NoGCTransition(&n);
+                throw new InvalidOperationException();
+            }
+        }
+        catch (InvalidOperationException)
+        {
+        }
+
+        Assert.AreEqual(expected, n);
+        return n + 1;
+    }
+    [MethodImpl(MethodImplOptions.NoInlining)]
     private static int CallAsFunctionPointer(int expected)
     {
         Console.WriteLine($"{nameof(CallAsFunctionPointer)} ({expected}) ...");
@@ -159,6 +232,9 @@ unsafe class SuppressGCTransitionTest
             n = NoInline_GCTransition(n);
             n = Mixed(n);
             n = Mixed_TightLoop(n);
+            n = Inline_NoGCTransition_InTry(n);
+            n = Mixed_InTry(n);
+            n = Inline_NoGCTransition_InRareBlock(n);
             n = CallAsFunctionPointer(n);
         }
         catch (Exception e)
@@ -0,0 +1,202 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+// See the LICENSE file in the project root for more information.
+//
+
+using System;
+using System.Runtime.CompilerServices;
+
+// Conditional local stores that lowering turns into cmov/csel. Covers int, long and
+// unsigned compares, constant and local values, values that stay live after the
+// select, a select whose operands are the same local, and loop reductions.
+
+internal static class IfConversion
+{
+    private const int Pass = 100;
+    private const int Fail = -1;
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    private static int Min(int a, int b)
+    {
+        int r = a;
+        if (b < a)
+        {
+            r = b;
+        }
+        return r;
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    private static long Max(long a, long b)
+    {
+        long r = a;
+        if (b > a)
+        {
+            r = b;
+        }
+        return r;
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    private static uint ClampUnsigned(uint a, uint limit)
+    {
+        if (a > limit)
+        {
+            a = limit;
+        }
+        return a;
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    private static int SelectConstant(int a, int b)
+    {
+        int r = 7;
+        if (a == b)
+        {
+            r = -3;
+        }
+        return r;
+    }
+
+    // The selected value is used again after the select, so it can't share the
+    // select's register.
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    private static int ValueLiveAfter(int a, int b, int c)
+    {
+        int r = a;
+        if (c != 0)
+        {
+            r = b;
+        }
+        return r * 1000 + b;
+    }
+
+    // Both operands of the select are the same local.
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    private static int SameLocal(int a, int b)
+    {
+        int r = a;
+        if (b >= 0)
+        {
+            r = a;
+        }
+        return r + b;
+    }
+
+    // Keeps many values live across the select so the allocator is short of registers.
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    private static int HighPressure(int a, int b, int c, int d, int e, int f, int g, int h)
+    {
+        int x0 = a * 3;
+        int x1 = b * 5;
+        int x2 = c * 7;
+        int x3 = d * 11;
+        int x4 = e * 13;
+        int x5 = f * 17;
+        int x6 = g * 19;
+        int x7 = h * 23;
+
+        int r = x0;
+        if (x1 < x2)
+        {
+            r = x3;
+        }
+        int s = x4;
+        if (x5 > x6)
+        {
+            s = x7;
+        }
+
+        return r + s + x0 + x1 + x2 + x3 + x4 + x5 + x6 + x7;
+    }
+
+    private static int HighPressureExpected(int a, int b, int c, int d, int e, int f, int g, int h)
+    {
+        int x0 = a * 3, x1 = b * 5, x2 = c * 7, x3 = d * 11, x4 = e * 13, x5 = f * 17, x6 = g * 19, x7 = h * 23;
+        return ((x1 < x2) ? x3 : x0) + ((x5 > x6) ? x7 : x4) + x0 + x1 + x2 + x3 + x4 + x5 + x6 + x7;
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    private static int ArrayMin(int[] a)
+    {
+        int min = int.MaxValue;
+        for (int i = 0; i < a.Length; i++)
+        {
+            int v = a[i];
+            if (v < min)
+            {
+                min = v;
+            }
+        }
+        return min;
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    private static int CountAbove(int[] a, int limit)
+    {
+        int count = 0;
+        for (int i = 0; i < a.Length; i++)
+        {
+            int next = count + 1;
+            if (a[i] <= limit)
+            {
+                next = count;
+            }
+            count = next;
+        }
+        return count;
+    }
+
+    private static int Main()
+    {
+        int[] values = { int.MinValue, -100, -1, 0, 1, 2, 100, int.MaxValue };
+
+        foreach (int a in values)
+        {
+            foreach (int b in values)
+            {
+                if (Min(a, b) != Math.Min(a, b) || Max(a, b) != Math.Max((long)a, (long)b) ||
+                    ClampUnsigned((uint)a, (uint)b) != Math.Min((uint)a, (uint)b) ||
+                    SelectConstant(a, b) != ((a == b) ? -3 : 7) ||
+                    ValueLiveAfter(a, b, a & 1) != (((a & 1) != 0) ? b : a) * 1000 + b ||
+                    SameLocal(a, b) != a + b ||
+                    HighPressure(a, b, a ^ b, b - a, a | 1, b & 7, a >> 3, b) !=
+                        HighPressureExpected(a, b, a ^ b, b - a, a | 1, b & 7, a >> 3, b))
+                {
+                    Console.WriteLine($"FAILED: {a}, {b}");
+                    return Fail;
+                }
+            }
+        }
+
+        if (Max(long.MinValue, long.MaxValue) != long.MaxValue || Max(1L << 40, 1L << 35) != 1L << 40)
+        {
+            Console.WriteLine("FAILED: Max(long)");
+            return Fail;
+        }
+
+        int[] array = new int[1000];
+        int expectedMin = int.MaxValue;
+        int expectedCount = 0;
+        for (int i = 0; i < array.Length; i++)
+        {
+            array[i] = (int)((i * 2654435761u) >> 7) - 1000000;
+            expectedMin = Math.Min(expectedMin, array[i]);
+            expectedCount += (array[i] > 0) ? 1 : 0;
+        }
+
+        if (ArrayMin(array) != expectedMin || ArrayMin(new int[0]) != int.MaxValue)
+        {
+            Console.WriteLine("FAILED: ArrayMin");
+            return Fail;
+        }
+
+        if (CountAbove(array, 0) != expectedCount)
+        {
+            Console.WriteLine("FAILED: CountAbove");
+            return Fail;
+        }
+
+        return Pass;
+    }
+}
@@ -0,0 +1,170 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+// See the LICENSE file in the project root for more information.
+//
+
+using System;
+using System.Runtime.CompilerServices;
+
+// Helpers with pinned locals inlined at call sites inside try regions. The helpers
+// throw part of the time so the handlers run with the inlinee's pinned temps in
+// scope, including catch handlers that pass the exception straight to a call.
+
+internal static unsafe class InlinePinnedInTry
+{
+    private const int Pass = 100;
+    private const int Fail = -1;
+
+    private static int s_caught;
+
+    private static int Sum(byte[] a, int count)
+    {
+        fixed (byte* p = a)
+        {
+            int sum = 0;
+            for (int i = 0; i < count; i++)
+            {
+                sum += p[i];
+            }
+            if (sum > 1000)
+            {
+                throw new ArgumentException("too big");
+            }
+            return sum;
+        }
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    private static void Record(Exception e)
+    {
+        if (e is ArgumentException)
+        {
+            s_caught++;
+        }
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    private static int SumInTryFinally(byte[] a, int count, ref int finallyCount)
+    {
+        try
+        {
+            return Sum(a, count);
+        }
+        finally
+        {
+            finallyCount++;
+        }
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    private static int SumInTryCatch(byte[] a, int count)
+    {
+        try
+        {
+            return Sum(a, count);
+        }
+        catch (Exception e)
+        {
+            Record(e);
+            return -1;
+        }
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    private static int SumInTryFilter(byte[] a, int count)
+    {
+        try
+        {
+            return Sum(a, count) + Sum(a, count / 2);
+        }
+        catch (ArgumentException e) when (e.Message.Length != 0)
+        {
+            return -2;
+        }
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    private static int SumInNestedTry(byte[] a, int count)
+    {
+        int result = 0;
+        try
+        {
+            try
+            {
+                result = Sum(a, count);
+            }
+            finally
+            {
+                result += 1;
+            }
+        }
+        catch (IndexOutOfRangeException)
+        {
+            result = -3;
+        }
+        catch (ArgumentException)
+        {
+            result = -4;
+        }
+        return result;
+    }
+
+    private static int Main()
+    {
+        byte[] a = new byte[64];
+        for (int i = 0; i < a.Length; i++)
+        {
+            a[i] = (byte)(i + 1);
+        }
+
+        for (int iter = 0; iter < 100; iter++)
+        {
+            int finallyCount = 0;
+
+            // 1 + ... + 10 = 55, 1 + ... + 64 = 2080 throws.
+            if (SumInTryFinally(a, 10, ref finallyCount) != 55 || finallyCount != 1)
+            {
+                Console.WriteLine("FAILED: SumInTryFinally");
+                return Fail;
+            }
+
+            bool threw = false;
+            try
+            {
+                SumInTryFinally(a, 64, ref finallyCount);
+            }
+            catch (ArgumentException)
+            {
+                threw = true;
+            }
+            if (!threw || finallyCount != 2)
+            {
+                Console.WriteLine("FAILED: SumInTryFinally throwing");
+                return Fail;
+            }
+
+            s_caught = 0;
+            if (SumInTryCatch(a, 10) != 55 || SumInTryCatch(a, 64) != -1 || s_caught != 1)
+            {
+                Console.WriteLine("FAILED: SumInTryCatch");
+                return Fail;
+            }
+
+            if (SumInTryFilter(a, 10) != 55 + 15 || SumInTryFilter(a, 64) != -2)
+            {
+                Console.WriteLine("FAILED: SumInTryFilter");
+                return Fail;
+            }
+
+            if (SumInNestedTry(a, 10) != 56 || SumInNestedTry(a, 64) != -4)
+            {
+                Console.WriteLine("FAILED: SumInNestedTry");
+                return Fail;
+            }
+
+            GC.Collect();
+        }
+
+        return Pass;
+    }
+}
@@ -0,0 +1,203 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+// See the LICENSE file in the project root for more information.
+//
+
+using System;
+using System.Runtime.CompilerServices;
+
+// Array fill and copy loops that the JIT replaces with block operations. Covers
+// lengths around the 64KB chunk size, partial ranges, both limit kinds (array length
+// and a cloned loop limit) and loops that throw part way through.
+
+internal static class LoopBlockOps
+{
+    private const int Pass = 100;
+    private const int Fail = -1;
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    private static void FillBytes(byte[] a, int start, byte value)
+    {
+        for (int i = start; i < a.Length; i++)
+        {
+            a[i] = value;
+        }
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    private static void ZeroInts(int[] a, int start, int end)
+    {
+        for (int i = start; i < end; i++)
+        {
+            a[i] = 0;
+        }
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    private static void CopyShorts(short[] dst, short[] src, int end)
+    {
+        for (int i = 0; i < end; i++)
+        {
+            dst[i] = src[i];
+        }
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    private static void CopyLongs(long[] dst, long[] src)
+    {
+        for (int i = 0; i < dst.Length; i++)
+        {
+            dst[i] = src[i];
+        }
+    }
+
+    private static bool CheckBytes(byte[] a, int start, byte value, byte other)
+    {
+        for (int i = 0; i < a.Length; i++)
+        {
+            if (a[i] != ((i < start) ? other : value))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    private static bool TestFillBytes(int length, int start)
+    {
+        byte[] a = new byte[length];
+        for (int i = 0; i < a.Length; i++)
+        {
+            a[i] = 0x11;
+        }
+
+        FillBytes(a, start, 0xA5);
+        return CheckBytes(a, start, 0xA5, 0x11);
+    }
+
+    private static bool TestZeroInts(int length, int start, int end)
+    {
+        int[] a = new int[length];
+        for (int i = 0; i < a.Length; i++)
+        {
+            a[i] = i + 1;
+        }
+
+        bool threw = false;
+        try
+        {
+            ZeroInts(a, start, end);
+        }
+        catch (IndexOutOfRangeException)
+        {
+            threw = true;
+        }
+
+        if (threw != ((end > length) && (start < end)))
+        {
+            return false;
+        }
+
+        for (int i = 0; i < a.Length; i++)
+        {
+            bool zeroed = (i >= start) && (i < end);
+            if (a[i] != (zeroed ? 0 : i + 1))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    private static bool TestCopyShorts(int length, int end)
+    {
+        short[] src = new short[length];
+        short[] dst = new short[length];
+        for (int i = 0; i < length; i++)
+        {
+            src[i] = (short)(i * 7);
+            dst[i] = -1;
+        }
+
+        bool threw = false;
+        try
+        {
+            CopyShorts(dst, src, end);
+        }
+        catch (IndexOutOfRangeException)
+        {
+            threw = true;
+        }
+
+        if (threw != (end > length))
+        {
+            return false;
+        }
+
+        for (int i = 0; i < length; i++)
+        {
+            if (dst[i] != ((i < end) ? (short)(i * 7) : (short)-1))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    private static bool TestCopyLongs(int length)
+    {
+        long[] src = new long[length];
+        long[] dst = new long[length];
+        for (int i = 0; i < length; i++)
+        {
+            src[i] = ((long)i << 33) | (uint)i;
+        }
+
+        CopyLongs(dst, src);
+
+        for (int i = 0; i < length; i++)
+        {
+            if (dst[i] != src[i])
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    private static int Main()
+    {
+        int[] lengths = { 0, 1, 2, 3, 100, 16383, 16384, 16385, 32768, 65535, 65536, 65537, 200003 };
+
+        foreach (int length in lengths)
+        {
+            if (!TestFillBytes(length, 0) || ((length > 1) && !TestFillBytes(length, length / 2)))
+            {
+                Console.WriteLine($"FAILED: FillBytes({length})");
+                return Fail;
+            }
+
+            if (!TestZeroInts(length, 0, length) || !TestZeroInts(length, length / 3, length) ||
+                !TestZeroInts(length, 0, length + 5))
+            {
+                Console.WriteLine($"FAILED: ZeroInts({length})");
+                return Fail;
+            }
+
+            if (!TestCopyShorts(length, length) || !TestCopyShorts(length, length / 2) ||
+                !TestCopyShorts(length, length + 1))
+            {
+                Console.WriteLine($"FAILED: CopyShorts({length})");
+                return Fail;
+            }
+
+            if (!TestCopyLongs(length))
+            {
+                Console.WriteLine($"FAILED: CopyLongs({length})");
+                return Fail;
+            }
+        }
+
+        return Pass;
+    }
+}
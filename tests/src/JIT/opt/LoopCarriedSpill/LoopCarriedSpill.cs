@@ -0,0 +1,178 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+// See the LICENSE file in the project root for more information.
+//
+
+using System;
+using System.Runtime.CompilerServices;
+
+// Loops with more live values than registers, where some of the values are carried around the
+// loop but only read again after it, in a colder block. The register allocator must not treat
+// those as cheap to spill in the loop body, and whatever it spills must be reloaded correctly on
+// the backedge. Each loop is checked against the same loop compiled without optimization.
+
+internal static class LoopCarriedSpill
+{
+    private const int Pass = 100;
+    private const int Fail = -1;
+
+    private static int s_calls;
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    private static int Touch(int x)
+    {
+        s_calls++;
+        return x ^ s_calls;
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    private static long Pressure(int[] a, int n, bool report)
+    {
+        long carried0 = 1;
+        long carried1 = 2;
+        int  t0 = 0, t1 = 1, t2 = 2, t3 = 3, t4 = 4, t5 = 5, t6 = 6, t7 = 7;
+
+        for (int i = 0; i < n; i++)
+        {
+            int v = a[i];
+            t0 += v;
+            t1 ^= t0 + i;
+            t2 += t1 * 3;
+            t3 -= t2 >> 1;
+            t4 += t3 ^ v;
+            t5 ^= t4 + t0;
+            t6 += t5 - t1;
+            t7 ^= t6 + t2;
+
+            // Only carried around the loop; read again after it
+            carried0 = carried0 * 31 + t7;
+            carried1 += carried0 >> 3;
+        }
+
+        long result = t0 + t1 + t2 + t3 + t4 + t5 + t6 + t7;
+
+        if (report)
+        {
+            result ^= carried0 - carried1;
+        }
+
+        return result;
+    }
+
+    [MethodImpl(MethodImplOptions.NoOptimization)]
+    private static long PressureRef(int[] a, int n, bool report)
+    {
+        long carried0 = 1;
+        long carried1 = 2;
+        int  t0 = 0, t1 = 1, t2 = 2, t3 = 3, t4 = 4, t5 = 5, t6 = 6, t7 = 7;
+
+        for (int i = 0; i < n; i++)
+        {
+            int v = a[i];
+            t0 += v;
+            t1 ^= t0 + i;
+            t2 += t1 * 3;
+            t3 -= t2 >> 1;
+            t4 += t3 ^ v;
+            t5 ^= t4 + t0;
+            t6 += t5 - t1;
+            t7 ^= t6 + t2;
+
+            carried0 = carried0 * 31 + t7;
+            carried1 += carried0 >> 3;
+        }
+
+        long result = t0 + t1 + t2 + t3 + t4 + t5 + t6 + t7;
+
+        if (report)
+        {
+            result ^= carried0 - carried1;
+        }
+
+        return result;
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    private static int PressureWithCall(int[] a, int n)
+    {
+        int carried = 17;
+        int t0 = 0, t1 = 1, t2 = 2, t3 = 3, t4 = 4;
+
+        for (int i = 0; i < n; i++)
+        {
+            int v = Touch(a[i]);
+            t0 += v;
+            t1 ^= t0;
+            t2 += t1 - i;
+            t3 ^= t2 + v;
+            t4 += t3 ^ t0;
+
+            carried = carried * 7 + (t4 & 0xff);
+        }
+
+        if (n > 10)
+        {
+            // Colder than the loop
+            return carried ^ (t0 + t1 + t2 + t3 + t4);
+        }
+
+        return t0 + t1 + t2 + t3 + t4;
+    }
+
+    [MethodImpl(MethodImplOptions.NoOptimization)]
+    private static int PressureWithCallRef(int[] a, int n)
+    {
+        int carried = 17;
+        int t0 = 0, t1 = 1, t2 = 2, t3 = 3, t4 = 4;
+
+        for (int i = 0; i < n; i++)
+        {
+            int v = Touch(a[i]);
+            t0 += v;
+            t1 ^= t0;
+            t2 += t1 - i;
+            t3 ^= t2 + v;
+            t4 += t3 ^ t0;
+
+            carried = carried * 7 + (t4 & 0xff);
+        }
+
+        if (n > 10)
+        {
+            return carried ^ (t0 + t1 + t2 + t3 + t4);
+        }
+
+        return t0 + t1 + t2 + t3 + t4;
+    }
+
+    private static int Main()
+    {
+        int[] a = new int[64];
+        for (int i = 0; i < a.Length; i++)
+        {
+            a[i] = (i * 13) - 40;
+        }
+
+        for (int n = 0; n <= a.Length; n++)
+        {
+            if ((Pressure(a, n, true) != PressureRef(a, n, true)) || (Pressure(a, n, false) != PressureRef(a, n, false)))
+            {
+                Console.WriteLine("FAILED: Pressure({0})", n);
+                return Fail;
+            }
+
+            s_calls = 0;
+            int actual = PressureWithCall(a, n);
+            s_calls = 0;
+            int expected = PressureWithCallRef(a, n);
+
+            if (actual != expected)
+            {
+                Console.WriteLine("FAILED: PressureWithCall({0})", n);
+                return Fail;
+            }
+        }
+
+        return Pass;
+    }
+}
@@ -0,0 +1,246 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+// See the LICENSE file in the project root for more information.
+//
+
+using System;
+using System.Runtime.CompilerServices;
+using System.Runtime.InteropServices;
+
+// Stores of references to older objects into just allocated objects, which may skip
+// the write barrier. The new objects are kept alive across gen0 and gen1 GCs, so a
+// barrier elided for an object that isn't in gen0 shows up as a missed reference.
+// Also covers classes whose size is just below and just above the large object
+// threshold, and finalizable classes.
+
+internal static class NewObjWriteBarriers
+{
+    private const int Pass = 100;
+    private const int Fail = -1;
+
+    private sealed class Node
+    {
+        public object A;
+        public object B;
+        public Node Next;
+        public int Value;
+    }
+
+    private sealed class Finalizable
+    {
+        public object A;
+        public object B;
+
+        ~Finalizable()
+        {
+        }
+    }
+
+    // Padding for object sizes around the 85000 byte large object threshold. Large is
+    // under 85000 bytes without the object header but is on the large object heap.
+    [StructLayout(LayoutKind.Sequential, Size = 84900)]
+    private struct Padding84900
+    {
+        public byte B;
+    }
+
+    [StructLayout(LayoutKind.Sequential, Size = 84960)]
+    private struct Padding84960
+    {
+        public byte B;
+    }
+
+    [StructLayout(LayoutKind.Sequential, Size = 84976)]
+    private struct Padding84976
+    {
+        public byte B;
+    }
+
+    private sealed class AlmostLarge
+    {
+        public object A;
+        public object B;
+        public Padding84900 P;
+    }
+
+    private sealed class JustBelowLarge
+    {
+        public object A;
+        public object B;
+        public Padding84960 P;
+    }
+
+    private sealed class Large
+    {
+        public object A;
+        public object B;
+        public Padding84976 P;
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    private static Node MakeNode(object a, object b, Node next, int value)
+    {
+        Node n = new Node();
+        n.A = a;
+        n.B = b;
+        n.Next = next;
+        n.Value = value;
+        return n;
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    private static Finalizable MakeFinalizable(object a, object b)
+    {
+        Finalizable f = new Finalizable();
+        f.A = a;
+        f.B = b;
+        return f;
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    private static AlmostLarge MakeAlmostLarge(object a, object b)
+    {
+        AlmostLarge o = new AlmostLarge();
+        o.A = a;
+        o.B = b;
+        return o;
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    private static JustBelowLarge MakeJustBelowLarge(object a, object b)
+    {
+        JustBelowLarge o = new JustBelowLarge();
+        o.A = a;
+        o.B = b;
+        return o;
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    private static Large MakeLarge(object a, object b)
+    {
+        Large o = new Large();
+        o.A = a;
+        o.B = b;
+        return o;
+    }
+
+    private static bool CheckString(object o, int i)
+    {
+        return (o is string s) && (s == i.ToString());
+    }
+
+    private static bool TestList()
+    {
+        // Old objects, promoted to gen2.
+        object[] old = new object[64];
+        for (int i = 0; i < old.Length; i++)
+        {
+            old[i] = i.ToString();
+        }
+        GC.Collect();
+        GC.Collect();
+
+        // New objects pointing at each other and at the old objects; they get promoted
+        // part way through so later ones are younger than earlier ones.
+        Node list = null;
+        for (int i = 0; i < 20000; i++)
+        {
+            list = MakeNode(old[i % old.Length], (i % 3 == 0) ? new object() : null, list, i);
+            if (i % 1000 == 0)
+            {
+                GC.Collect(i % 2000 == 0 ? 1 : 0);
+            }
+        }
+
+        old = null;
+        GC.Collect(0);
+        GC.Collect(1);
+
+        int expected = 19999;
+        for (Node n = list; n != null; n = n.Next)
+        {
+            if ((n.Value != expected) || !CheckString(n.A, expected % 64) || ((n.B != null) != (expected % 3 == 0)))
+            {
+                return false;
+            }
+            expected--;
+        }
+        return expected == -1;
+    }
+
+    private static bool TestLargeSizes()
+    {
+        object a = "a";
+        object b = new object();
+        GC.Collect();
+
+        for (int i = 0; i < 20; i++)
+        {
+            AlmostLarge x = MakeAlmostLarge(a, b);
+            JustBelowLarge y = MakeJustBelowLarge(a, b);
+            Large z = MakeLarge(a, b);
+
+            // Stores into objects on the large object heap need the barrier since
+            // the object is already in gen2.
+            z.A = new string('z', i + 1);
+            GC.Collect(0);
+            GC.Collect(1);
+
+            if ((x.A != a) || (x.B != b) || (y.A != a) || (y.B != b) || (z.B != b) ||
+                !(z.A is string s) || (s.Length != i + 1) || (GC.GetGeneration(z) != 2))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    private static bool TestFinalizable()
+    {
+        object[] old = { "x", "y" };
+        GC.Collect();
+
+        Finalizable[] items = new Finalizable[1000];
+        for (int i = 0; i < items.Length; i++)
+        {
+            items[i] = MakeFinalizable(old[i & 1], new string('f', i % 10));
+            if (i % 100 == 0)
+            {
+                GC.Collect(0);
+            }
+        }
+        GC.Collect(1);
+
+        for (int i = 0; i < items.Length; i++)
+        {
+            if ((items[i].A != old[i & 1]) || !(items[i].B is string s) || (s.Length != i % 10))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    private static int Main()
+    {
+        if (!TestList())
+        {
+            Console.WriteLine("FAILED: TestList");
+            return Fail;
+        }
+
+        if (!TestLargeSizes())
+        {
+            Console.WriteLine("FAILED: TestLargeSizes");
+            return Fail;
+        }
+
+        if (!TestFinalizable())
+        {
+            Console.WriteLine("FAILED: TestFinalizable");
+            return Fail;
+        }
+
+        return Pass;
+    }
+}
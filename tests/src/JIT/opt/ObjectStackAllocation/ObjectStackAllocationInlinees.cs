@@ -0,0 +1,178 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+// See the LICENSE file in the project root for more information.
+//
+
+using System;
+using System.Runtime.CompilerServices;
+
+// Objects that only flow into inlined callees don't escape and are allocated on the stack
+// with COMPlus_JitObjectStackAllocation=1. Each scenario is checked for its result and for
+// not allocating on the heap, measured with GC.GetAllocatedBytesForCurrentThread.
+
+internal struct Tag
+{
+    public int id;
+    public int version;
+}
+
+internal class Point
+{
+    public int x;
+    public int y;
+    public Tag tag;
+
+    public Point(int x, int y)
+    {
+        this.x = x;
+        this.y = y;
+    }
+
+    [MethodImpl(MethodImplOptions.AggressiveInlining)]
+    public int Sum()
+    {
+        return x + y;
+    }
+
+    [MethodImpl(MethodImplOptions.AggressiveInlining)]
+    public int ScaledSum(int scale)
+    {
+        return Scale(this, scale).Sum();
+    }
+
+    [MethodImpl(MethodImplOptions.AggressiveInlining)]
+    private static Point Scale(Point p, int scale)
+    {
+        p.x *= scale;
+        p.y *= scale;
+        return p;
+    }
+}
+
+internal static class ObjectStackAllocationInlinees
+{
+    private const int Pass = 100;
+    private const int Fail = -1;
+    private const int Iterations = 100;
+
+    private static volatile int s_x = 3;
+    private static volatile int s_y = 4;
+
+    [MethodImpl(MethodImplOptions.AggressiveInlining)]
+    private static int Product(Point p)
+    {
+        return p.x * p.y;
+    }
+
+    [MethodImpl(MethodImplOptions.AggressiveInlining)]
+    private static Point Identity(Point p)
+    {
+        return p;
+    }
+
+    [MethodImpl(MethodImplOptions.AggressiveInlining)]
+    private static int IgnoreFields(Point p)
+    {
+        // The discarded struct field load leaves only a null check of p after inlining
+        Tag unused = p.tag;
+        return 1;
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    private static int Consume(Point p)
+    {
+        return p.x - p.y;
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    private static int PassToStaticInlinee()
+    {
+        Point p = new Point(s_x, s_y);
+        return Product(p);
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    private static int CallInlinedInstanceMethod()
+    {
+        Point p = new Point(s_x, s_y);
+        return p.Sum();
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    private static int CallNestedInlinees()
+    {
+        Point p = new Point(s_x, s_y);
+        return p.ScaledSum(2);
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    private static int PassThroughInlinee()
+    {
+        Point p = Identity(new Point(s_x, s_y));
+        return p.y - p.x;
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    private static int PassToInlineeThatOnlyNullChecks()
+    {
+        Point p = new Point(s_x, s_y);
+        return IgnoreFields(p) + p.y;
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    private static int PassToCall()
+    {
+        Point p = new Point(s_x, s_y);
+        return Consume(p);
+    }
+
+    private static bool Check(string name, Func<int> scenario, int expected, bool expectHeapAllocation)
+    {
+        // Jit the scenario first
+        if (scenario() != expected)
+        {
+            Console.WriteLine("FAILED: {0} returned a wrong result", name);
+            return false;
+        }
+
+        long before = GC.GetAllocatedBytesForCurrentThread();
+        int  sum    = 0;
+
+        for (int i = 0; i < Iterations; i++)
+        {
+            sum += scenario();
+        }
+
+        long allocated = GC.GetAllocatedBytesForCurrentThread() - before;
+
+        if (sum != expected * Iterations)
+        {
+            Console.WriteLine("FAILED: {0} returned a wrong result", name);
+            return false;
+        }
+
+        if ((allocated != 0) != expectHeapAllocation)
+        {
+            Console.WriteLine("FAILED: {0} allocated {1} bytes on the heap", name, allocated);
+            return false;
+        }
+
+        return true;
+    }
+
+    private static int Main()
+    {
+        bool passed = true;
+
+        passed &= Check(nameof(PassToStaticInlinee), PassToStaticInlinee, 12, false);
+        passed &= Check(nameof(CallInlinedInstanceMethod), CallInlinedInstanceMethod, 7, false);
+        passed &= Check(nameof(CallNestedInlinees), CallNestedInlinees, 14, false);
+        passed &= Check(nameof(PassThroughInlinee), PassThroughInlinee, 1, false);
+        passed &= Check(nameof(PassToInlineeThatOnlyNullChecks), PassToInlineeThatOnlyNullChecks, 5, false);
+
+        // The object escapes to a call that isn't inlined, so it must be on the heap.
+        passed &= Check(nameof(PassToCall), PassToCall, -1, true);
+
+        return passed ? Pass : Fail;
+    }
+}
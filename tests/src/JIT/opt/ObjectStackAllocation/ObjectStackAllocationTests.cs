@@ -0,0 +1,173 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+// See the LICENSE file in the project root for more information.
+//
+
+using System;
+using System.Runtime.CompilerServices;
+
+// Exercises object stack allocation (COMPlus_JitObjectStackAllocation=1): objects that
+// don't escape, objects that do, objects holding GC references across a collection and
+// promotion of the fields of stack-allocated objects.
+
+internal class SimpleClassA
+{
+    public int f1;
+    public int f2;
+
+    public SimpleClassA(int f1, int f2)
+    {
+        this.f1 = f1;
+        this.f2 = f2;
+    }
+}
+
+internal sealed class ClassWithFiveFields
+{
+    public int f1;
+    public int f2;
+    public long f3;
+    public int f4;
+    public int f5;
+}
+
+internal class ClassWithGCField
+{
+    public string s;
+    public int i;
+}
+
+internal static class ObjectStackAllocationTests
+{
+    private const int Pass = 100;
+    private const int Fail = -1;
+
+    private static volatile int s_f1 = 5;
+    private static volatile int s_f2 = 7;
+    private static SimpleClassA s_escaped;
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    private static int AllocateSimpleClassAndAddFields()
+    {
+        SimpleClassA a = new SimpleClassA(s_f1, s_f2);
+        GC.Collect();
+        return a.f1 + a.f2;
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    private static long AllocateClassWithFiveFields()
+    {
+        ClassWithFiveFields c = new ClassWithFiveFields();
+        c.f1 = s_f1;
+        c.f2 = s_f2;
+        c.f3 = (long)s_f1 << 32;
+        c.f4 = c.f1 * c.f2;
+        c.f5 = c.f4 - c.f1;
+        return c.f1 + c.f2 + c.f3 + c.f4 + c.f5;
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    private static int AllocateClassWithGCFieldAndCollect()
+    {
+        ClassWithGCField c = new ClassWithGCField();
+        c.s = new string('x', s_f1);
+        c.i = s_f2;
+        GC.Collect();
+        GC.Collect();
+        return c.s.Length + c.i;
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    private static bool AllocateAndCheckType()
+    {
+        // The method table is observed, the object must keep it even if it doesn't escape.
+        object o = new SimpleClassA(s_f1, s_f2);
+        return o.GetType() == typeof(SimpleClassA) && o is SimpleClassA;
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    private static bool AllocateAndCompareIdentity()
+    {
+        SimpleClassA a = new SimpleClassA(s_f1, s_f2);
+        SimpleClassA b = new SimpleClassA(s_f1, s_f2);
+        SimpleClassA c = (s_f1 > 0) ? a : b;
+        return ReferenceEquals(a, c) && !ReferenceEquals(b, c) && (c.f1 == s_f1);
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    private static int AllocateAndEscapeToStatic()
+    {
+        SimpleClassA a = new SimpleClassA(s_f1, s_f2);
+        s_escaped = a;
+        return a.f1;
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    private static int AllocateAndNullCheck()
+    {
+        SimpleClassA a = new SimpleClassA(s_f1, s_f2);
+        // Only the null check of the argument survives inlining
+        return IgnoreFields(a) + a.f2;
+    }
+
+    private static int IgnoreFields(SimpleClassA a)
+    {
+        int unused = a.f1;
+        return 1;
+    }
+
+    private static int Main()
+    {
+        if (AllocateSimpleClassAndAddFields() != 12)
+        {
+            Console.WriteLine("FAILED: AllocateSimpleClassAndAddFields");
+            return Fail;
+        }
+
+        if (AllocateClassWithFiveFields() != (5 + 7 + (5L << 32) + 35 + 30))
+        {
+            Console.WriteLine("FAILED: AllocateClassWithFiveFields");
+            return Fail;
+        }
+
+        if (AllocateClassWithGCFieldAndCollect() != 12)
+        {
+            Console.WriteLine("FAILED: AllocateClassWithGCFieldAndCollect");
+            return Fail;
+        }
+
+        if (!AllocateAndCheckType())
+        {
+            Console.WriteLine("FAILED: AllocateAndCheckType");
+            return Fail;
+        }
+
+        if (!AllocateAndCompareIdentity())
+        {
+            Console.WriteLine("FAILED: AllocateAndCompareIdentity");
+            return Fail;
+        }
+
+        if (AllocateAndEscapeToStatic() != 5)
+        {
+            Console.WriteLine("FAILED: AllocateAndEscapeToStatic");
+            return Fail;
+        }
+
+        GC.Collect();
+
+        if ((s_escaped == null) || (s_escaped.f1 != 5) || (s_escaped.f2 != 7))
+        {
+            Console.WriteLine("FAILED: escaped object was not heap allocated");
+            return Fail;
+        }
+
+        if (AllocateAndNullCheck() != 8)
+        {
+            Console.WriteLine("FAILED: AllocateAndNullCheck");
+            return Fail;
+        }
+
+        return Pass;
+    }
+}
@@ -0,0 +1,369 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+// See the LICENSE file in the project root for more information.
+//
+
+using System;
+using System.Runtime.CompilerServices;
+
+// Counted loops whose trip count isn't a constant, which the JIT partially unrolls with
+// COMPlus_JitPartialUnrollLoops=1. Each loop is checked against the same loop compiled
+// without optimization, for trip counts around the unroll factors. Covers nested loops,
+// loops with calls, loops with early exits and loops that throw part way through.
+
+internal static class PartialUnroll
+{
+    private const int Pass = 100;
+    private const int Fail = -1;
+
+    private static int s_calls;
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    private static int Sum(int[] a, int start, int end)
+    {
+        int sum = 0;
+        for (int i = start; i < end; i++)
+        {
+            sum += a[i];
+        }
+        return sum;
+    }
+
+    [MethodImpl(MethodImplOptions.NoOptimization)]
+    private static int SumRef(int[] a, int start, int end)
+    {
+        int sum = 0;
+        for (int i = start; i < end; i++)
+        {
+            sum += a[i];
+        }
+        return sum;
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    private static long WeightedSumToLength(int[] a, int start)
+    {
+        long sum = 0;
+        for (int i = start; i < a.Length; i++)
+        {
+            sum += (long)a[i] * i;
+        }
+        return sum;
+    }
+
+    [MethodImpl(MethodImplOptions.NoOptimization)]
+    private static long WeightedSumToLengthRef(int[] a, int start)
+    {
+        long sum = 0;
+        for (int i = start; i < a.Length; i++)
+        {
+            sum += (long)a[i] * i;
+        }
+        return sum;
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    private static int Mix(int x, int i)
+    {
+        s_calls++;
+        return (x * 31) ^ i;
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    private static int LoopWithCall(int start, int end)
+    {
+        int x = 1;
+        for (int i = start; i < end; i++)
+        {
+            x = Mix(x, i);
+        }
+        return x;
+    }
+
+    [MethodImpl(MethodImplOptions.NoOptimization)]
+    private static int LoopWithCallRef(int start, int end)
+    {
+        int x = 1;
+        for (int i = start; i < end; i++)
+        {
+            x = Mix(x, i);
+        }
+        return x;
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    private static int Nested(int[][] rows, int cols)
+    {
+        int sum = 0;
+        for (int r = 0; r < rows.Length; r++)
+        {
+            int[] row = rows[r];
+            for (int c = 0; c < cols; c++)
+            {
+                sum += row[c] * (r + 1);
+            }
+        }
+        return sum;
+    }
+
+    [MethodImpl(MethodImplOptions.NoOptimization)]
+    private static int NestedRef(int[][] rows, int cols)
+    {
+        int sum = 0;
+        for (int r = 0; r < rows.Length; r++)
+        {
+            int[] row = rows[r];
+            for (int c = 0; c < cols; c++)
+            {
+                sum += row[c] * (r + 1);
+            }
+        }
+        return sum;
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    private static int FindFirst(int[] a, int end, int value)
+    {
+        int i = 0;
+        for (; i < end; i++)
+        {
+            if (a[i] == value)
+            {
+                break;
+            }
+        }
+        return i;
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    private static int SumUntilNegative(int[] a, int end)
+    {
+        int sum = 0;
+        for (int i = 0; i < end; i++)
+        {
+            if (a[i] < 0)
+            {
+                return -sum;
+            }
+            sum += a[i];
+        }
+        return sum;
+    }
+
+    [MethodImpl(MethodImplOptions.NoOptimization)]
+    private static int SumUntilNegativeRef(int[] a, int end)
+    {
+        int sum = 0;
+        for (int i = 0; i < end; i++)
+        {
+            if (a[i] < 0)
+            {
+                return -sum;
+            }
+            sum += a[i];
+        }
+        return sum;
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    private static int CountUp(int start, int end)
+    {
+        int i = start;
+        int n = 0;
+        do
+        {
+            n += 3;
+            i++;
+        } while (i < end);
+        return n * 1000 + i;
+    }
+
+    [MethodImpl(MethodImplOptions.NoOptimization)]
+    private static int CountUpRef(int start, int end)
+    {
+        int i = start;
+        int n = 0;
+        do
+        {
+            n += 3;
+            i++;
+        } while (i < end);
+        return n * 1000 + i;
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    private static void Increment(int[] a, int end)
+    {
+        for (int i = 0; i < end; i++)
+        {
+            a[i]++;
+        }
+    }
+
+    private static int[] MakeArray(int length)
+    {
+        int[] a = new int[length];
+        for (int i = 0; i < length; i++)
+        {
+            a[i] = (i * 7) - 3;
+        }
+        return a;
+    }
+
+    private static bool TestSums()
+    {
+        int[] a = MakeArray(40);
+
+        for (int start = 0; start < 4; start++)
+        {
+            for (int end = 0; end <= a.Length; end++)
+            {
+                if (Sum(a, start, end) != SumRef(a, start, end))
+                {
+                    Console.WriteLine("FAILED: Sum({0}, {1})", start, end);
+                    return false;
+                }
+
+                if (LoopWithCall(start, end) != LoopWithCallRef(start, end))
+                {
+                    Console.WriteLine("FAILED: LoopWithCall({0}, {1})", start, end);
+                    return false;
+                }
+
+                if (CountUp(start, end) != CountUpRef(start, end))
+                {
+                    Console.WriteLine("FAILED: CountUp({0}, {1})", start, end);
+                    return false;
+                }
+            }
+        }
+
+        for (int length = 0; length <= 40; length++)
+        {
+            int[] b = MakeArray(length);
+
+            for (int start = 0; start < 3; start++)
+            {
+                if (WeightedSumToLength(b, start) != WeightedSumToLengthRef(b, start))
+                {
+                    Console.WriteLine("FAILED: WeightedSumToLength({0}, {1})", length, start);
+                    return false;
+                }
+            }
+        }
+
+        return true;
+    }
+
+    private static bool TestCallCount()
+    {
+        for (int end = 0; end <= 40; end++)
+        {
+            s_calls = 0;
+            LoopWithCall(0, end);
+
+            if (s_calls != end)
+            {
+                Console.WriteLine("FAILED: LoopWithCall(0, {0}) made {1} calls", end, s_calls);
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    private static bool TestNested()
+    {
+        for (int rowCount = 0; rowCount < 5; rowCount++)
+        {
+            int[][] rows = new int[rowCount][];
+
+            for (int r = 0; r < rowCount; r++)
+            {
+                rows[r] = MakeArray(20);
+            }
+
+            for (int cols = 0; cols <= 20; cols++)
+            {
+                if (Nested(rows, cols) != NestedRef(rows, cols))
+                {
+                    Console.WriteLine("FAILED: Nested({0}, {1})", rowCount, cols);
+                    return false;
+                }
+            }
+        }
+
+        return true;
+    }
+
+    private static bool TestEarlyExits()
+    {
+        int[] a = MakeArray(40);
+
+        for (int end = 0; end <= a.Length; end++)
+        {
+            for (int target = 0; target < a.Length; target += 5)
+            {
+                int expected = (target < end) ? target : end;
+
+                if (FindFirst(a, end, a[target]) != expected)
+                {
+                    Console.WriteLine("FAILED: FindFirst({0}, {1})", end, target);
+                    return false;
+                }
+            }
+
+            for (int negative = 0; negative < a.Length; negative += 7)
+            {
+                int[] b = MakeArray(40);
+                b[negative] = -1;
+
+                if (SumUntilNegative(b, end) != SumUntilNegativeRef(b, end))
+                {
+                    Console.WriteLine("FAILED: SumUntilNegative({0}, {1})", end, negative);
+                    return false;
+                }
+            }
+        }
+
+        return true;
+    }
+
+    private static bool TestThrow()
+    {
+        for (int length = 0; length < 20; length++)
+        {
+            int[] a = new int[length];
+
+            try
+            {
+                // Runs past the end of the array
+                Increment(a, length + 5);
+                Console.WriteLine("FAILED: Increment({0}) didn't throw", length);
+                return false;
+            }
+            catch (IndexOutOfRangeException)
+            {
+            }
+
+            // Every element before the faulting index must have been updated exactly once
+            for (int i = 0; i < length; i++)
+            {
+                if (a[i] != 1)
+                {
+                    Console.WriteLine("FAILED: Increment({0}) updated a[{1}] {2} times", length, i, a[i]);
+                    return false;
+                }
+            }
+        }
+
+        return true;
+    }
+
+    private static int Main()
+    {
+        bool passed = TestSums() && TestCallCount() && TestNested() && TestEarlyExits() && TestThrow();
+
+        return passed ? Pass : Fail;
+    }
+}
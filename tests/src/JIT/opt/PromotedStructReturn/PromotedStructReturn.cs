@@ -0,0 +1,177 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+// See the LICENSE file in the project root for more information.
+//
+
+using System;
+using System.Runtime.CompilerServices;
+
+// Struct locals returned in two registers (SysV x64 and arm64). Covers structs whose
+// fields line up with the return registers, structs that don't, mixed integer and
+// floating point fields, GC fields, several returns and locals that are also assigned
+// from a multi-reg call.
+
+internal static class PromotedStructReturn
+{
+    private const int Pass = 100;
+    private const int Fail = -1;
+
+    private struct LongPair
+    {
+        public long A;
+        public long B;
+    }
+
+    private struct Mixed
+    {
+        public double D;
+        public long L;
+    }
+
+    private struct FourInts
+    {
+        public int A;
+        public int B;
+        public int C;
+        public int D;
+    }
+
+    private struct RefAndInt
+    {
+        public string S;
+        public int I;
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    private static LongPair MakePair(long a, long b)
+    {
+        LongPair p;
+        p.A = a + 1;
+        p.B = b * 2;
+        return p;
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    private static (long, long) MakeTuple(long a, long b)
+    {
+        (long, long) t = (a, b);
+        t.Item1 ^= b;
+        return t;
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    private static Mixed MakeMixed(double d, long l)
+    {
+        Mixed m;
+        m.D = d * 0.5;
+        m.L = l - 3;
+        return m;
+    }
+
+    // Four fields in two return registers, returned through the stack frame.
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    private static FourInts MakeFourInts(int x)
+    {
+        FourInts f;
+        f.A = x;
+        f.B = x + 1;
+        f.C = x + 2;
+        f.D = x + 3;
+        return f;
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    private static RefAndInt MakeRefAndInt(string s, int i)
+    {
+        RefAndInt r;
+        r.S = s;
+        r.I = i + s.Length;
+        return r;
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    private static LongPair SelectPair(bool first, long a, long b)
+    {
+        LongPair p;
+        if (first)
+        {
+            p.A = a;
+            p.B = b;
+            return p;
+        }
+
+        p.A = b;
+        p.B = a;
+        return p;
+    }
+
+    // The local is assigned from a multi-reg call as well as built field by field.
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    private static LongPair PairFromCall(bool call, long a, long b)
+    {
+        LongPair p;
+        if (call)
+        {
+            p = MakePair(a, b);
+        }
+        else
+        {
+            p.A = a;
+            p.B = b;
+        }
+        return p;
+    }
+
+    private static int Main()
+    {
+        long[] values = { long.MinValue, -5, 0, 7, 1L << 40, long.MaxValue };
+
+        foreach (long a in values)
+        {
+            foreach (long b in values)
+            {
+                LongPair p = MakePair(a, b);
+                (long, long) t = MakeTuple(a, b);
+                LongPair s1 = SelectPair(true, a, b);
+                LongPair s2 = SelectPair(false, a, b);
+                LongPair c1 = PairFromCall(true, a, b);
+                LongPair c2 = PairFromCall(false, a, b);
+
+                if (p.A != a + 1 || p.B != b * 2 || t.Item1 != (a ^ b) || t.Item2 != b ||
+                    s1.A != a || s1.B != b || s2.A != b || s2.B != a ||
+                    c1.A != a + 1 || c1.B != b * 2 || c2.A != a || c2.B != b)
+                {
+                    Console.WriteLine($"FAILED: LongPair {a}, {b}");
+                    return Fail;
+                }
+
+                Mixed m = MakeMixed(a, b);
+                if (m.D != a * 0.5 || m.L != b - 3)
+                {
+                    Console.WriteLine($"FAILED: Mixed {a}, {b}");
+                    return Fail;
+                }
+            }
+        }
+
+        FourInts f = MakeFourInts(10);
+        if (f.A != 10 || f.B != 11 || f.C != 12 || f.D != 13)
+        {
+            Console.WriteLine("FAILED: FourInts");
+            return Fail;
+        }
+
+        for (int i = 0; i < 100; i++)
+        {
+            RefAndInt r = MakeRefAndInt(new string('x', i), i);
+            GC.Collect(0);
+            if (r.S.Length != i || r.I != 2 * i)
+            {
+                Console.WriteLine("FAILED: RefAndInt");
+                return Fail;
+            }
+        }
+
+        return Pass;
+    }
+}